@@ -0,0 +1,99 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Minimal benchmark harness: BENCHMARK(Name) { ... } registers a body which is timed by RunAll.
+    BENCHMARK_LIMITED(Name, MaxIterations) caps the iterations of bodies which take milliseconds.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace Benchmarks
+{
+    using Body = void (*)();
+
+    struct Benchmark
+    {
+        std::string_view mName;
+        Body mBody;
+        std::size_t mMaxIterations;
+    };
+
+    [[nodiscard]] inline std::vector<Benchmark>& GetRegistry()
+    {
+        static std::vector<Benchmark> registry{};
+        return registry;
+    }
+
+    struct Registrar
+    {
+        Registrar(std::string_view name, Body body, std::size_t max_iterations = std::numeric_limits<std::size_t>::max())
+        {
+            GetRegistry().push_back({ name, body, max_iterations });
+        }
+    };
+
+    // Keeps the optimizer from dropping the measured computation.
+    template <typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    inline void RunAll(std::size_t iterations)
+    {
+        for (const auto& [name, body, max_iterations] : GetRegistry())
+        {
+            body();
+
+            const auto count{ std::min(iterations, max_iterations) };
+
+            const auto begin{ std::chrono::steady_clock::now() };
+            for (std::size_t i{}; i < count; ++i)
+            {
+                body();
+            }
+            const auto end{ std::chrono::steady_clock::now() };
+
+            const auto total{ std::chrono::duration<double, std::nano>(end - begin).count() };
+            std::printf("%-40.*s %12.1f ns/op\n", static_cast<int>(std::size(name)), std::data(name), total / static_cast<double>(count));
+        }
+    }
+}
+
+#define BENCHMARK(name) \
+    static void name(); \
+    static const ::Benchmarks::Registrar name##Registrar{ #name, &name }; \
+    static void name()
+
+#define BENCHMARK_LIMITED(name, max_iterations) \
+    static void name(); \
+    static const ::Benchmarks::Registrar name##Registrar{ #name, &name, max_iterations }; \
+    static void name()
\ No newline at end of file
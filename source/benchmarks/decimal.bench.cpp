@@ -0,0 +1,74 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <decimal.hpp>
+
+#include <tokenizer.hpp>
+#include <rpn-converter.hpp>
+#include <rpn-evaluator.hpp>
+#include <rpn-decimal-evaluator.hpp>
+
+namespace
+{
+    [[nodiscard]] std::vector<Tokenizer::TokenPair> Compile(const QString& expression)
+    {
+        Tokenizer tokenizer{};
+        tokenizer.Init(expression);
+        tokenizer.Run();
+
+        RPNConverter rpn_converter{};
+        return rpn_converter.Convert(tokenizer.GetTokens());
+    }
+
+    const auto kSmallExpression{ Compile(QStringLiteral("0.1+0.2*(3.75-1.5)/4-12.125")) };
+    const auto kLargeExpression{ Compile(QStringLiteral("123456789012345678901234567890*98765432109876543210/7")) };
+}
+
+BENCHMARK(DoubleSmallValues)
+{
+    Benchmarks::DoNotOptimize(RPNEvaluator::Evaluate(kSmallExpression));
+}
+
+BENCHMARK(DecimalSmallValues)
+{
+    static RPNDecimalEvaluator evaluator{};
+    Benchmarks::DoNotOptimize(evaluator.Evaluate(kSmallExpression));
+}
+
+BENCHMARK(DoubleLargeValues)
+{
+    Benchmarks::DoNotOptimize(RPNEvaluator::Evaluate(kLargeExpression));
+}
+
+BENCHMARK(DecimalLargeValues)
+{
+    static RPNDecimalEvaluator evaluator{};
+    Benchmarks::DoNotOptimize(evaluator.Evaluate(kLargeExpression));
+}
+
+BENCHMARK(DecimalMultiplyLimbs)
+{
+    static const auto kFactor{ Utils::Decimal::FromString("31415926535897932384626433832795028841971693993751058209749445923") };
+    Benchmarks::DoNotOptimize(kFactor * kFactor);
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include <evaluation-pipeline.hpp>
+#include <streaming-pipeline.hpp>
+
+namespace
+{
+    const auto kExpression{ QStringLiteral("((12.5+3)*(4-1.25))^2/(7+8*(9-3))-1") };
+
+    // Typical keypad input: integer literals with + - * only.
+    const auto kIntegerExpression{ QStringLiteral("1250*36-(480+125)*12+7*(18-3)*4") };
+
+    // Stream of distinct expressions, half of them integer only.
+    const auto kStream{ []
+    {
+        std::vector<QString> expressions{};
+        for (int i{}; i < 10'000; ++i)
+        {
+            expressions.push_back((i % 2 == 0 ? kExpression : kIntegerExpression) + QStringLiteral("+") + QString::number(i));
+        }
+
+        return expressions;
+    }() };
+
+    void RunStream(std::size_t batch_size)
+    {
+        static std::vector<double> results(std::size(kStream));
+
+        StreamingPipeline pipeline{ batch_size };
+        Benchmarks::DoNotOptimize(pipeline.Run(kStream, results));
+    }
+}
+
+BENCHMARK(FreshTokenizerAndConverter)
+{
+    Tokenizer tokenizer{};
+    tokenizer.Init(kExpression);
+    tokenizer.Run();
+
+    RPNConverter rpn_converter{};
+    Benchmarks::DoNotOptimize(RPNEvaluator::Evaluate(rpn_converter.Convert(tokenizer.GetTokens())));
+}
+
+BENCHMARK(WarmEvaluationPipeline)
+{
+    static EvaluationPipeline pipeline{};
+
+    std::ignore = pipeline.Run(kExpression);
+    Benchmarks::DoNotOptimize(pipeline.GetResult());
+}
+
+// Every limit set, with a deadline which is never reached: should match WarmEvaluationPipeline.
+BENCHMARK(WarmEvaluationPipelineWithLimits)
+{
+    static EvaluationPipeline pipeline{};
+    static const bool is_limited{ [] 
+    {
+        pipeline.SetLimits({ 4096, 1024, 64, 256, Utils::ResourceLimits::Clock::now() + std::chrono::hours{ 24 } });
+        return true;
+    }() };
+
+    Benchmarks::DoNotOptimize(is_limited);
+
+    std::ignore = pipeline.Run(kExpression);
+    Benchmarks::DoNotOptimize(pipeline.GetResult());
+}
+
+BENCHMARK(IntegerExpressionAsDouble)
+{
+    static EvaluationPipeline pipeline{};
+    static std::vector<double> operands{};
+    static const bool is_converted{ pipeline.Tokenize(kIntegerExpression) && pipeline.Convert() };
+
+    Benchmarks::DoNotOptimize(is_converted);
+    Benchmarks::DoNotOptimize(RPNEvaluator::Evaluate(pipeline.GetRPNExpression(), operands));
+}
+
+BENCHMARK(IntegerExpressionAsInt64)
+{
+    static EvaluationPipeline pipeline{};
+    static std::vector<std::int64_t> operands{};
+    static const bool is_converted{ pipeline.Tokenize(kIntegerExpression) && pipeline.Convert() };
+
+    Benchmarks::DoNotOptimize(is_converted);
+    Benchmarks::DoNotOptimize(RPNIntegerEvaluator::Evaluate(pipeline.GetRPNExpression(), operands).mValue);
+}
+
+BENCHMARK_LIMITED(StreamOnOneThread, 20)
+{
+    static EvaluationPipeline pipeline{};
+
+    for (const auto& expression : kStream)
+    {
+        std::ignore = pipeline.Run(expression);
+        Benchmarks::DoNotOptimize(pipeline.GetResult());
+    }
+}
+
+BENCHMARK_LIMITED(StreamPipelinedBatch16, 20) { RunStream(16); }
+BENCHMARK_LIMITED(StreamPipelinedBatch64, 20) { RunStream(64); }
+BENCHMARK_LIMITED(StreamPipelinedBatch256, 20) { RunStream(256); }
\ No newline at end of file
@@ -0,0 +1,78 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "benchmark.hpp"
+
+#include <cstring>
+#include <string>
+
+#include <evaluation-pipeline.hpp>
+#include <input-sources.hpp>
+
+namespace
+{
+    // About 2.4 MB and 700k tokens.
+    const auto kText = []()
+    {
+        std::string text{ "0" };
+        for (int i{}; i < 100'000; ++i)
+        {
+            text += "+1.5*2-0.25/4+(-3)";
+        }
+
+        return text;
+    }();
+
+    const auto kExpression{ QString::fromLatin1(std::data(kText), std::ssize(kText)) };
+
+    Utils::InputGenerator<Utils::InputSources::Symbol> ReadText(bool& has_read_error)
+    {
+        auto reader = [position = std::size_t{}](std::span<char> buffer) mutable -> qsizetype
+        {
+            const auto size{ std::min(std::size(buffer), std::size(kText) - position) };
+            std::memcpy(std::data(buffer), std::data(kText) + position, size);
+            position += size;
+
+            return static_cast<qsizetype>(size);
+        };
+
+        return Utils::InputSources::FromChunks(std::move(reader), has_read_error);
+    }
+}
+
+BENCHMARK_LIMITED(WholeInputPipeline, 20)
+{
+    static EvaluationPipeline pipeline{};
+
+    std::ignore = pipeline.Run(kExpression);
+    Benchmarks::DoNotOptimize(pipeline.GetResult());
+}
+
+BENCHMARK_LIMITED(ChunkedInputPipeline, 20)
+{
+    static EvaluationPipeline pipeline{};
+    bool has_read_error{};
+
+    std::ignore = pipeline.RunStream(ReadText(has_read_error), has_read_error);
+    Benchmarks::DoNotOptimize(pipeline.GetResult());
+}
@@ -0,0 +1,94 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+#include "benchmark.hpp"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include <QLocale>
+#include <QString>
+
+#include <number-formatter.hpp>
+
+namespace
+{
+    // Results of an export job: mostly short decimals, some of them long fractions.
+    const auto kValues = []()
+    {
+        std::mt19937_64 generator{ 42 };
+        std::uniform_real_distribution<double> distribution{ -1e6, 1e6 };
+
+        std::vector<double> values(1'000'000);
+        for (std::size_t i{}; i < std::size(values); ++i)
+        {
+            values[i] = i % 2 == 0 ? static_cast<double>(static_cast<long long>(distribution(generator) * 100)) / 100 : distribution(generator);
+        }
+
+        return values;
+    }();
+
+    // Fits every value with 17 significant digits and a separator.
+    constexpr std::size_t kOutputSize{ 1'000'000 * 25 };
+}
+
+BENCHMARK_LIMITED(FormatMillionQStringNumber, 10)
+{
+    for (const auto value : kValues)
+    {
+        Benchmarks::DoNotOptimize(QString::number(value, 'g', QLocale::FloatingPointShortest));
+    }
+}
+
+BENCHMARK_LIMITED(FormatMillionSnprintf, 10)
+{
+    static std::vector<char> output(kOutputSize);
+
+    std::size_t length{};
+    for (const auto value : kValues)
+    {
+        length += static_cast<std::size_t>(std::snprintf(std::data(output) + length, std::size(output) - length, "%.17g\n", value));
+    }
+
+    Benchmarks::DoNotOptimize(length);
+}
+
+BENCHMARK_LIMITED(FormatMillionShortest, 10)
+{
+    static const Utils::NumberFormatter number_formatter{};
+    static std::vector<char> output(kOutputSize);
+
+    std::size_t value_count{};
+    Benchmarks::DoNotOptimize(number_formatter.Format(kValues, '\n', output, value_count));
+}
+
+BENCHMARK_LIMITED(FormatMillionFixed6, 10)
+{
+    static const Utils::NumberFormatter number_formatter{ Utils::NumberFormatter::Notation::Fixed, 6 };
+    static std::vector<char> output(kOutputSize);
+
+    std::size_t value_count{};
+    Benchmarks::DoNotOptimize(number_formatter.Format(kValues, '\n', output, value_count));
+}
@@ -0,0 +1,59 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <array>
+
+#include <tokenizer.hpp>
+
+namespace
+{
+    // Digit-heavy literals, short ones hit the exact fast path, long ones go through std::from_chars.
+    const std::array<QString, 8> kLiterals
+    {
+        QStringLiteral("7"),
+        QStringLiteral("3.14159"),
+        QStringLiteral("1234567.125"),
+        QStringLiteral("0.000001"),
+        QStringLiteral("98765432101234"),
+        QStringLiteral("2.718281828459045"),
+        QStringLiteral("12345678901234567890.5"),
+        QStringLiteral("0.30000000000000000000000000004"),
+    };
+}
+
+BENCHMARK(ParseLiteralsToDouble)
+{
+    for (const auto& literal : kLiterals)
+    {
+        Benchmarks::DoNotOptimize(literal.toDouble());
+    }
+}
+
+BENCHMARK(ParseLiteralsParseNumber)
+{
+    for (const auto& literal : kLiterals)
+    {
+        Benchmarks::DoNotOptimize(Tokenizer::ParseNumber(literal));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <tokenizer.hpp>
+#include <rpn-evaluator.hpp>
+#include <rpn-parallel-evaluator.hpp>
+
+namespace
+{
+    // Synthetic generated formula: a balanced tree of +, - and max over 2^levels literals, 
+    // written straight to RPN, tokenizing millions of characters would dominate the start up.
+    void AppendWideTree(int levels, int& next_literal, std::vector<Tokenizer::TokenPair>& rpn_expression)
+    {
+        if (levels == 0)
+        {
+            rpn_expression.emplace_back(QString::number(next_literal++ % 9 + 1), Tokenizer::Token::Integer);
+            return;
+        }
+
+        AppendWideTree(levels - 1, next_literal, rpn_expression);
+        AppendWideTree(levels - 1, next_literal, rpn_expression);
+
+        switch (levels % 3)
+        {
+        case 0:
+            rpn_expression.push_back({ QStringLiteral("max"), Tokenizer::Token::Function });
+            break;
+        case 1:
+            rpn_expression.push_back({ QStringLiteral("+"), Tokenizer::Token::Operator });
+            break;
+        default:
+            rpn_expression.push_back({ QStringLiteral("-"), Tokenizer::Token::Operator });
+            break;
+        }
+    }
+
+    // About a million tokens.
+    const auto kWideRPN = []()
+    {
+        int next_literal{};
+        std::vector<Tokenizer::TokenPair> rpn_expression{};
+
+        AppendWideTree(19, next_literal, rpn_expression);
+        return rpn_expression;
+    }();
+
+    std::vector<double> gOperands{};
+
+    // The speedup over WideTreeSequential is the ratio of the times, it is bounded by the cores of the machine.
+    void EvaluateWideTree(std::size_t thread_count)
+    {
+        static std::vector<std::unique_ptr<RPNParallelEvaluator>> evaluators(17);
+
+        auto& evaluator{ evaluators[thread_count] };
+        if (!evaluator)
+        {
+            evaluator = std::make_unique<RPNParallelEvaluator>(thread_count);
+        }
+
+        Benchmarks::DoNotOptimize(evaluator->Evaluate(kWideRPN));
+    }
+}
+
+BENCHMARK_LIMITED(WideTreeSequential, 20)
+{
+    Benchmarks::DoNotOptimize(RPNEvaluator::Evaluate(kWideRPN, gOperands));
+}
+
+BENCHMARK_LIMITED(WideTreeParallel1Thread, 20)
+{
+    EvaluateWideTree(1);
+}
+
+BENCHMARK_LIMITED(WideTreeParallel2Threads, 20)
+{
+    EvaluateWideTree(2);
+}
+
+BENCHMARK_LIMITED(WideTreeParallel4Threads, 20)
+{
+    EvaluateWideTree(4);
+}
+
+BENCHMARK_LIMITED(WideTreeParallel8Threads, 20)
+{
+    EvaluateWideTree(8);
+}
+
+BENCHMARK_LIMITED(WideTreeParallel16Threads, 20)
+{
+    EvaluateWideTree(16);
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <tokenizer.hpp>
+#include <parallel-tokenizer.hpp>
+
+namespace
+{
+    // About 8 MB of text, sums of calls, numbers and names.
+    const auto kHugeInput = []()
+    {
+        QString input{ QStringLiteral("0") };
+        for (int i{}; i < 200'000; ++i)
+        {
+            input += QStringLiteral("+max(12.375*x_1,(-4))-rate^2/(") + QString::number(i) + QStringLiteral("+sin(0.5))");
+        }
+
+        return input;
+    }();
+
+    // The speedup over HugeInputTokenizer is the ratio of the times, it is bounded by the cores of the machine.
+    void TokenizeHugeInput(std::size_t thread_count)
+    {
+        static std::vector<std::unique_ptr<ParallelTokenizer>> tokenizers(17);
+
+        auto& tokenizer{ tokenizers[thread_count] };
+        if (!tokenizer)
+        {
+            tokenizer = std::make_unique<ParallelTokenizer>(thread_count);
+        }
+
+        tokenizer->Init(kHugeInput);
+        tokenizer->Run();
+
+        Benchmarks::DoNotOptimize(std::size(tokenizer->GetTokens()));
+    }
+}
+
+BENCHMARK_LIMITED(HugeInputTokenizer, 3)
+{
+    static Tokenizer tokenizer{};
+
+    tokenizer.Init(kHugeInput);
+    tokenizer.Run();
+
+    Benchmarks::DoNotOptimize(std::size(tokenizer.GetTokens()));
+}
+
+BENCHMARK_LIMITED(HugeInputParallel1Thread, 3)
+{
+    TokenizeHugeInput(1);
+}
+
+BENCHMARK_LIMITED(HugeInputParallel2Threads, 3)
+{
+    TokenizeHugeInput(2);
+}
+
+BENCHMARK_LIMITED(HugeInputParallel4Threads, 3)
+{
+    TokenizeHugeInput(4);
+}
+
+BENCHMARK_LIMITED(HugeInputParallel8Threads, 3)
+{
+    TokenizeHugeInput(8);
+}
+
+BENCHMARK_LIMITED(HugeInputParallel16Threads, 3)
+{
+    TokenizeHugeInput(16);
+}
\ No newline at end of file
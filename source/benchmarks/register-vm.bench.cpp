@@ -0,0 +1,115 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <array>
+#include <vector>
+
+#include <tokenizer.hpp>
+#include <rpn-converter.hpp>
+#include <rpn-evaluator.hpp>
+#include <rpn-compiler.hpp>
+#include <register-compiler.hpp>
+
+namespace
+{
+    // 1+(2*(3-(4/(...)))): every literal is pushed before the first operator runs.
+    QString MakeDeepExpression(int depth)
+    {
+        constexpr std::array<const char*, 4> kOperators{ "+", "*", "-", "/" };
+
+        QString expression{ QString::number(depth + 1) };
+        for (int i{ depth }; i > 0; --i)
+        {
+            expression = QString::number(i) + QString::fromLatin1(kOperators[static_cast<std::size_t>(i) % 4]) + QStringLiteral("(") + expression + QStringLiteral(")");
+        }
+
+        return expression;
+    }
+
+    // Balanced tree of sums and products over 2^levels literals.
+    QString MakeWideExpression(int levels, int& next_literal)
+    {
+        if (levels == 0)
+        {
+            return QString::number(next_literal++ % 9 + 1);
+        }
+
+        const auto left{ MakeWideExpression(levels - 1, next_literal) };
+        const auto right{ MakeWideExpression(levels - 1, next_literal) };
+
+        return QStringLiteral("(") + left + (levels % 2 == 0 ? QStringLiteral("+") : QStringLiteral("*")) + right + QStringLiteral(")");
+    }
+
+    std::vector<Tokenizer::TokenPair> ToRPN(const QString& expression)
+    {
+        Tokenizer tokenizer{};
+        tokenizer.Init(expression);
+        tokenizer.Run();
+
+        return RPNConverter{}.Convert(tokenizer.GetTokens());
+    }
+
+    int gNextLiteral{ 0 };
+
+    const auto kDeepRPN{ ToRPN(MakeDeepExpression(200)) };
+    const auto kWideRPN{ ToRPN(MakeWideExpression(8, gNextLiteral)) };
+
+    const auto kDeepStackProgram{ RPNCompiler{}.Compile(kDeepRPN) };
+    const auto kWideStackProgram{ RPNCompiler{}.Compile(kWideRPN) };
+
+    const auto kDeepRegisterProgram{ RegisterCompiler{}.Compile(kDeepRPN) };
+    const auto kWideRegisterProgram{ RegisterCompiler{}.Compile(kWideRPN) };
+
+    std::vector<double> gOperands{};
+}
+
+BENCHMARK(DeepStackEvaluator)
+{
+    Benchmarks::DoNotOptimize(RPNEvaluator::Evaluate(kDeepRPN, gOperands));
+}
+
+BENCHMARK(DeepCompiledStackProgram)
+{
+    Benchmarks::DoNotOptimize(kDeepStackProgram.Evaluate({}));
+}
+
+BENCHMARK(DeepRegisterProgram)
+{
+    Benchmarks::DoNotOptimize(kDeepRegisterProgram.Evaluate({}));
+}
+
+BENCHMARK(WideStackEvaluator)
+{
+    Benchmarks::DoNotOptimize(RPNEvaluator::Evaluate(kWideRPN, gOperands));
+}
+
+BENCHMARK(WideCompiledStackProgram)
+{
+    Benchmarks::DoNotOptimize(kWideStackProgram.Evaluate({}));
+}
+
+BENCHMARK(WideRegisterProgram)
+{
+    Benchmarks::DoNotOptimize(kWideRegisterProgram.Evaluate({}));
+}
\ No newline at end of file
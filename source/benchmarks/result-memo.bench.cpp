@@ -0,0 +1,87 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <thread>
+#include <vector>
+
+#include <result-memo.hpp>
+
+namespace
+{
+    // 4096 distinct expressions, every thread walks all of them, so nearly every lookup is a hit.
+    const auto kExpressions = []()
+    {
+        std::vector<QString> expressions{};
+        for (int i{}; i < 4096; ++i)
+        {
+            expressions.push_back(QStringLiteral("((12.5+3)*(4-1.25))^2/(7+8*(9-3))-%1").arg(i));
+        }
+
+        return expressions;
+    }();
+
+    // Time per pass over all expressions on every thread, flat up to the core count when nothing is contended.
+    void LookUpFromThreads(ResultMemo& result_memo, std::size_t thread_count)
+    {
+        std::vector<std::thread> threads{};
+
+        for (std::size_t thread{}; thread < thread_count; ++thread)
+        {
+            threads.emplace_back([&result_memo, thread]
+            {
+                EvaluationPipeline pipeline{};
+
+                for (std::size_t i{}; i < std::size(kExpressions); ++i)
+                {
+                    // Staggered, so the threads do not visit the shards in lockstep.
+                    Benchmarks::DoNotOptimize(result_memo.Evaluate(pipeline, kExpressions[(i + thread * 97) % std::size(kExpressions)]));
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    ResultMemo& GetWarmMemo()
+    {
+        static ResultMemo result_memo{};
+        static const bool is_warm = [] { LookUpFromThreads(result_memo, 1); return true; }();
+
+        Benchmarks::DoNotOptimize(is_warm);
+        return result_memo;
+    }
+}
+
+BENCHMARK_LIMITED(MemoMissesOneThread, 5)
+{
+    ResultMemo result_memo{};
+    LookUpFromThreads(result_memo, 1);
+}
+
+BENCHMARK_LIMITED(MemoHitsOneThread, 20) { LookUpFromThreads(GetWarmMemo(), 1); }
+BENCHMARK_LIMITED(MemoHits4Threads, 20) { LookUpFromThreads(GetWarmMemo(), 4); }
+BENCHMARK_LIMITED(MemoHits32Threads, 20) { LookUpFromThreads(GetWarmMemo(), 32); }
\ No newline at end of file
@@ -0,0 +1,189 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <array>
+#include <filesystem>
+#include <vector>
+
+#include <evaluation-pipeline.hpp>
+#include <rpn-compiler.hpp>
+#include <rpn-gradient.hpp>
+#include <rpn-program-cache.hpp>
+
+namespace
+{
+    const auto kProgram{ RPNCompiler{}.Compile(QStringLiteral("principal*(1+rate/12)^months-payment*months")) };
+
+    // Long straight-line formula, dominated by dispatch rather than by pow.
+    const auto kPolynomial{ RPNCompiler{}.Compile(QStringLiteral("x*x*x*0.25-x*x*1.5+x*y*2-y*y/3+x*4-y*5+7")) };
+
+    // Written with ^ as users type it, constant integer exponents are compiled without std::pow.
+    const auto kPowers{ RPNCompiler{}.Compile(QStringLiteral("x^3*0.25-x^2*1.5+y^5/3-y^(-2)+x^7")) };
+
+    // A polynomial written out in full, as compiled and contracted into one Horner instruction.
+    const auto kWrittenPolynomial{ RPNCompiler{}.Compile(QStringLiteral("0.5*x^6-3*x^5+2*x^4+x^3/6+2*x^2-5*x+1")) };
+
+    const auto kContractedPolynomial = []()
+    {
+        RPNCompiler compiler{};
+        compiler.SetContraction(true);
+
+        return compiler.Compile(QStringLiteral("0.5*x^6-3*x^5+2*x^4+x^3/6+2*x^2-5*x+1"));
+    }();
+
+    // Eight inputs, differentiated by the tape in one sweep or by 2 * 8 + 1 evaluations.
+    const auto kLoss{ RPNCompiler{}.Compile(QStringLiteral("(a*x1+b*x2+c-y1)^2+(a*x2-b*x1+c-y2)^2+(c/a)^2+b*d")) };
+
+    // Start up of a service with 10000 formulas: compiling all of them, or mapping a cache written before.
+    const auto kFormulas = []()
+    {
+        std::vector<QString> formulas{};
+        for (int i{}; i < 10'000; ++i)
+        {
+            formulas.push_back(QStringLiteral("principal*(1+rate/12)^months-payment*months+%1*x^2").arg(i));
+        }
+
+        return formulas;
+    }();
+
+    const auto kCachePath = []()
+    {
+        const auto path{ (std::filesystem::temp_directory_path() / "rpn-program-cache.bench.bin").string() };
+
+        RPNCompiler compiler{};
+        RPNProgramCache cache{};
+
+        for (const auto& formula : kFormulas)
+        {
+            cache.Add(formula, compiler.Compile(formula));
+        }
+
+        std::ignore = cache.Save(path);
+        return path;
+    }();
+}
+
+BENCHMARK(SpliceValuesAndReparse)
+{
+    static EvaluationPipeline pipeline{};
+
+    std::ignore = pipeline.Run(QStringLiteral("1000*(1+0.05/12)^36-25*36"));
+    Benchmarks::DoNotOptimize(pipeline.GetResult());
+}
+
+BENCHMARK(RebindCompiledProgram)
+{
+    static std::array<double, 4> bindings{ 1000.0, 0.05, 36.0, 25.0 };
+
+    bindings[0] += 1.0;
+    Benchmarks::DoNotOptimize(kProgram.Evaluate(bindings));
+}
+
+BENCHMARK(RebindCompiledPolynomial)
+{
+    static std::array<double, 2> bindings{ 1.5, -0.5 };
+
+    bindings[0] += 1e-9;
+    Benchmarks::DoNotOptimize(kPolynomial.Evaluate(bindings));
+}
+
+BENCHMARK(RebindCompiledPowers)
+{
+    static std::array<double, 2> bindings{ 1.5, -0.5 };
+
+    bindings[0] += 1e-9;
+    Benchmarks::DoNotOptimize(kPowers.Evaluate(bindings));
+}
+
+BENCHMARK(RebindWrittenPolynomial)
+{
+    static std::array<double, 1> bindings{ 1.5 };
+
+    bindings[0] += 1e-9;
+    Benchmarks::DoNotOptimize(kWrittenPolynomial.Evaluate(bindings));
+}
+
+BENCHMARK(RebindContractedPolynomial)
+{
+    static std::array<double, 1> bindings{ 1.5 };
+
+    bindings[0] += 1e-9;
+    Benchmarks::DoNotOptimize(kContractedPolynomial.Evaluate(bindings));
+}
+
+BENCHMARK(GradientTape)
+{
+    static RPNGradient gradient{};
+    static std::array<double, 8> bindings{ 0.5, 1.5, -0.25, 2.0, 3.0, 1.0, 4.0, -2.0 };
+    static std::array<double, 8> partials{};
+
+    bindings[0] += 1e-9;
+    Benchmarks::DoNotOptimize(gradient.Evaluate(kLoss, bindings, partials));
+    Benchmarks::DoNotOptimize(partials[0]);
+}
+
+BENCHMARK(GradientFiniteDifferences)
+{
+    static std::array<double, 8> bindings{ 0.5, 1.5, -0.25, 2.0, 3.0, 1.0, 4.0, -2.0 };
+    static std::array<double, 8> partials{};
+
+    bindings[0] += 1e-9;
+    Benchmarks::DoNotOptimize(kLoss.Evaluate(bindings));
+
+    for (std::size_t slot{}; slot < std::size(bindings); ++slot)
+    {
+        const auto value{ bindings[slot] };
+
+        bindings[slot] = value + 1e-6;
+        const auto forward{ kLoss.Evaluate(bindings) };
+
+        bindings[slot] = value - 1e-6;
+        partials[slot] = (forward - kLoss.Evaluate(bindings)) / 2e-6;
+
+        bindings[slot] = value;
+    }
+
+    Benchmarks::DoNotOptimize(partials[0]);
+}
+
+BENCHMARK_LIMITED(StartUpCompilingFormulas, 5)
+{
+    RPNCompiler compiler{};
+
+    for (const auto& formula : kFormulas)
+    {
+        Benchmarks::DoNotOptimize(compiler.Compile(formula).GetMaxStackDepth());
+    }
+}
+
+BENCHMARK_LIMITED(StartUpFromProgramCache, 5)
+{
+    RPNProgramCache cache{};
+    Benchmarks::DoNotOptimize(cache.Open(kCachePath));
+
+    for (const auto& formula : kFormulas)
+    {
+        Benchmarks::DoNotOptimize(cache.Find(formula)->GetView().mMaxStackDepth);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "benchmark.hpp"
+
+#include <vector>
+
+#include <tokenizer.hpp>
+#include <token-stream.hpp>
+#include <rpn-converter.hpp>
+#include <rpn-evaluator.hpp>
+
+namespace
+{
+    // 1M tokens: a long sum of products with a call every few terms.
+    const auto kTokens = []()
+    {
+        QString input{ QStringLiteral("0") };
+        for (int i{}; i < 100'000; ++i)
+        {
+            input += QStringLiteral("+1.5*2-0.25/4+max(3,-1)");
+        }
+
+        Tokenizer tokenizer{};
+        tokenizer.Init(input);
+        tokenizer.Run();
+
+        return tokenizer.GetTokens();
+    }();
+
+    const auto kStream = []()
+    {
+        TokenStream stream{};
+        static_cast<void>(stream.Assign(kTokens));
+
+        return stream;
+    }();
+}
+
+BENCHMARK_LIMITED(MillionTokenPairs, 20)
+{
+    static RPNConverter converter{};
+    static std::vector<Tokenizer::TokenPair> rpn{};
+    static std::vector<double> operands{};
+
+    static_cast<void>(converter.Convert(kTokens, rpn));
+    Benchmarks::DoNotOptimize(RPNEvaluator::Evaluate(rpn, operands));
+}
+
+BENCHMARK_LIMITED(MillionTokenStream, 20)
+{
+    static RPNConverter converter{};
+    static TokenStream rpn{};
+    static std::vector<double> operands{};
+
+    static_cast<void>(converter.Convert(kStream, rpn));
+    Benchmarks::DoNotOptimize(RPNEvaluator::Evaluate(rpn, operands));
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <array>
+#include <cmath>
+#include <span>
+#include <vector>
+
+#include <rpn-compiler.hpp>
+#include <vector-math.hpp>
+
+namespace
+{
+    constexpr std::size_t kBatchSize{ 4096 };
+
+    const std::vector<double> kInput = []()
+    {
+        std::vector<double> input(kBatchSize);
+        for (std::size_t i{}; i < kBatchSize; ++i)
+        {
+            input[i] = static_cast<double>(i) * 0.013 - 20.0;
+        }
+
+        return input;
+    }();
+
+    const std::vector<double> kPositiveInput = []()
+    {
+        std::vector<double> input(kBatchSize);
+        for (std::size_t i{}; i < kBatchSize; ++i)
+        {
+            input[i] = static_cast<double>(i + 1) * 0.37;
+        }
+
+        return input;
+    }();
+
+    std::vector<double> gOutput(kBatchSize);
+
+    const auto kProgram{ RPNCompiler{}.Compile(QStringLiteral("sin(x)*exp((-x)/8)+sqrt(x*x+1)")) };
+}
+
+BENCHMARK(LibmSinBatch)
+{
+    for (std::size_t i{}; i < kBatchSize; ++i)
+    {
+        gOutput[i] = std::sin(kInput[i]);
+    }
+
+    Benchmarks::DoNotOptimize(gOutput.back());
+}
+
+BENCHMARK(VectorMathSinBatch)
+{
+    Utils::VectorMath::Sin(kInput, gOutput);
+    Benchmarks::DoNotOptimize(gOutput.back());
+}
+
+BENCHMARK(LibmExpBatch)
+{
+    for (std::size_t i{}; i < kBatchSize; ++i)
+    {
+        gOutput[i] = std::exp(kInput[i]);
+    }
+
+    Benchmarks::DoNotOptimize(gOutput.back());
+}
+
+BENCHMARK(VectorMathExpBatch)
+{
+    Utils::VectorMath::Exp(kInput, gOutput);
+    Benchmarks::DoNotOptimize(gOutput.back());
+}
+
+BENCHMARK(LibmLogBatch)
+{
+    for (std::size_t i{}; i < kBatchSize; ++i)
+    {
+        gOutput[i] = std::log(kPositiveInput[i]);
+    }
+
+    Benchmarks::DoNotOptimize(gOutput.back());
+}
+
+BENCHMARK(VectorMathLogBatch)
+{
+    Utils::VectorMath::Log(kPositiveInput, gOutput);
+    Benchmarks::DoNotOptimize(gOutput.back());
+}
+
+BENCHMARK(CompiledProgramRowByRow)
+{
+    for (std::size_t i{}; i < kBatchSize; ++i)
+    {
+        gOutput[i] = kProgram.Evaluate(std::span{ &kInput[i], 1 });
+    }
+
+    Benchmarks::DoNotOptimize(gOutput.back());
+}
+
+BENCHMARK(CompiledProgramColumns)
+{
+    const std::array<std::span<const double>, 1> columns{ kInput };
+
+    kProgram.Evaluate(columns, gOutput);
+    Benchmarks::DoNotOptimize(gOutput.back());
+}
\ No newline at end of file
@@ -22,34 +22,59 @@
 
 #include "math-evaluator-controller.hpp"
 
+#include <array>
+#include <utility>
+
+#include <QThread>
+
 MathEvaluatorController::MathEvaluatorController(QObject* parent) :
-    QObject{ parent }, mResult{}
-{ }
+    QObject{ parent }, mResult{}, mResultText{}, 
+    mPipelinePool{ static_cast<std::uint32_t>(QThread::idealThreadCount()) + 1 }, mGeneration{}, mPreviewGeneration{}
+{ 
+    mPreviewThreadPool.setMaxThreadCount(1);
+}
 
-bool MathEvaluatorController::Evaluate(const QString& expression)
+bool MathEvaluatorController::Evaluate(const QString& expression, EvaluationMode mode)
 {
-    mTokenizer.Init(expression);
-    mTokenizer.Run();
-    
-    if (mTokenizer.HasError())
+    auto pipeline{ mPipelinePool.Acquire() };
+
+    if (!pipeline->Tokenize(expression) || !pipeline->Convert())
     {
-        mErrorMessage = mTokenizer.GetErrorMessage();
+        mErrorMessage = pipeline->GetErrorMessage();
         return false;
     }
 
-    const auto& tokens{ mTokenizer.GetTokens() };
-    const auto rpn_converted_tokens{ mRPNConverter.Convert(tokens) };
-
-    if (mRPNConverter.HasError())
+    if (mode == EvaluationMode::Decimal)
     {
-        mErrorMessage = mRPNConverter.GetErrorMessage();
-        return false;
+        const auto result{ mRPNDecimalEvaluator.Evaluate(pipeline->GetRPNExpression()) };
+
+        if (mRPNDecimalEvaluator.HasError())
+        {
+            mErrorMessage = mRPNDecimalEvaluator.GetErrorMessage();
+            return false;
+        }
+
+        mResult = result.ToDouble();
+        mResultText = QString::fromStdString(result.ToString());
+        return true;
     }
 
-    mResult = RPNEvaluator::Evaluate(rpn_converted_tokens);
+    mResult = pipeline->Evaluate();
+    mResultText = MakeResultText(*pipeline, mResult, mRPNDecimalEvaluator);
+
     return true;
 }
 
+QString MathEvaluatorController::FormatNumber(double value, NumberNotation notation, int precision) const
+{
+    const Utils::NumberFormatter number_formatter{ static_cast<Utils::NumberFormatter::Notation>(notation), precision };
+
+    std::array<char, Utils::NumberFormatter::kMaxLength> buffer{};
+    const auto length{ number_formatter.Format(value, buffer) };
+
+    return QString::fromLatin1(std::data(buffer), static_cast<qsizetype>(length));
+}
+
 QString MathEvaluatorController::GetErrorMessage() const noexcept
 {
     return mErrorMessage;
@@ -58,4 +83,128 @@ QString MathEvaluatorController::GetErrorMessage() const noexcept
 double MathEvaluatorController::GetResult() const noexcept
 {
     return mResult;
+}
+
+QString MathEvaluatorController::GetResultText() const
+{
+    return mResultText;
+}
+
+void MathEvaluatorController::EvaluateAsync(const QString& expression)
+{
+    const auto generation{ mGeneration.fetch_add(1, std::memory_order_acq_rel) + 1 };
+
+    // A preview of the expression must not land after its result.
+    mPreviewGeneration.fetch_add(1, std::memory_order_acq_rel);
+
+    mThreadPool.start([this, expression, generation]()
+    {
+        // Superseded requests which have not started yet are coalesced into the latest one.
+        if (IsStale(generation)) { return; }
+
+        auto report_error = [this, generation](const QString& message)
+        {
+            QMetaObject::invokeMethod(this, [this, generation, message]()
+            {
+                if (IsStale(generation)) { return; }
+
+                mErrorMessage = message;
+                emit errorOccurred(message);
+            }, Qt::QueuedConnection);
+        };
+
+        // Every worker checks out a private pipeline, warmed up by earlier evaluations.
+        auto pipeline{ mPipelinePool.Acquire() };
+
+        if (!pipeline->Tokenize(expression))
+        {
+            report_error(pipeline->GetErrorMessage());
+            return;
+        }
+
+        if (IsStale(generation)) { return; }
+
+        if (!pipeline->Convert())
+        {
+            report_error(pipeline->GetErrorMessage());
+            return;
+        }
+
+        if (IsStale(generation)) { return; }
+
+        const auto result{ pipeline->Evaluate() };
+
+        // Built here as in Evaluate, the decimal evaluator of the GUI thread is not shared with the workers.
+        RPNDecimalEvaluator decimal_evaluator{};
+        auto text{ MakeResultText(*pipeline, result, decimal_evaluator) };
+
+        // The result is delivered on the GUI thread, where it is dropped if a newer request arrived meanwhile.
+        QMetaObject::invokeMethod(this, [this, generation, result, text = std::move(text)]()
+        {
+            if (IsStale(generation)) { return; }
+
+            mResult = result;
+            mResultText = text;
+            emit resultReady(result, text);
+        }, Qt::QueuedConnection);
+    });
+}
+
+void MathEvaluatorController::PreviewAsync(const QString& expression)
+{
+    const auto generation{ mPreviewGeneration.fetch_add(1, std::memory_order_acq_rel) + 1 };
+
+    mPreviewThreadPool.start([this, expression, generation]()
+    {
+        // Keystrokes queued behind a running preview are coalesced into the latest one.
+        if (IsPreviewStale(generation)) { return; }
+
+        if (!mIncrementalEvaluator.Update(expression)) { return; }
+
+        QMetaObject::invokeMethod(this, [this, generation, result = mIncrementalEvaluator.GetResult()]()
+        {
+            if (IsPreviewStale(generation)) { return; }
+
+            emit previewReady(result);
+        }, Qt::QueuedConnection);
+    });
+}
+
+QString MathEvaluatorController::MakeResultText(const EvaluationPipeline& pipeline, double result, RPNDecimalEvaluator& decimal_evaluator) const
+{
+    const auto& [outcome, value]{ pipeline.GetIntegerResult() };
+
+    if (outcome == RPNIntegerEvaluator::Outcome::Exact)
+    {
+        return QString::number(value);
+    }
+
+    if (outcome == RPNIntegerEvaluator::Outcome::Overflow)
+    {
+        // Integer only but wider than 64 bits: the digits come from the bignum, the double stays the result. 
+        // Powers too long for the digit cap fail right away, the deadline bounds everything else.
+        Utils::ResourceLimits limits{};
+        limits.mDeadline = Utils::ResourceLimits::Clock::now() + kResultTextBudget;
+        limits.mDeadlineCheckInterval = 1;
+
+        Utils::LimitViolation violation{};
+        const auto digits{ decimal_evaluator.Evaluate(pipeline.GetRPNExpression(), limits, violation) };
+
+        if (!decimal_evaluator.HasError())
+        {
+            return QString::fromStdString(digits.ToString());
+        }
+    }
+
+    return FormatNumber(result);
+}
+
+bool MathEvaluatorController::IsStale(std::uint64_t generation) const noexcept
+{
+    return generation != mGeneration.load(std::memory_order_acquire);
+}
+
+bool MathEvaluatorController::IsPreviewStale(std::uint64_t generation) const noexcept
+{
+    return generation != mPreviewGeneration.load(std::memory_order_acquire);
 }
\ No newline at end of file
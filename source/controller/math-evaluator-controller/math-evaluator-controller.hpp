@@ -22,29 +22,100 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
 #include <QObject>
+#include <QThreadPool>
 
 #include <tokenizer.hpp>
 #include <rpn-converter.hpp>
 #include <rpn-evaluator.hpp>
+#include <rpn-decimal-evaluator.hpp>
+#include <rpn-integer-evaluator.hpp>
+#include <incremental-evaluator.hpp>
+#include <evaluation-pipeline.hpp>
+#include <object-pool.hpp>
+#include <number-formatter.hpp>
 
 class MathEvaluatorController : public QObject
 {
     Q_OBJECT
 
 public:
+    // Decimal is exact (0.1 + 0.2 == 0.3) but slower, Double is the hardware fast path.
+    enum class EvaluationMode
+    {
+        Double,
+        Decimal
+    };
+    Q_ENUM(EvaluationMode)
+
+    // See Utils::NumberFormatter.
+    enum class NumberNotation
+    {
+        Shortest,
+        Fixed,
+        Scientific
+    };
+    Q_ENUM(NumberNotation)
+
+    // Time the bignum digits of an overflowed integer result may take, the double's text is shown past it.
+    static constexpr std::chrono::milliseconds kResultTextBudget{ 100 };
+
     explicit MathEvaluatorController(QObject* parent = nullptr);
     ~MathEvaluatorController() noexcept override = default;
 
-    Q_INVOKABLE bool Evaluate(const QString& expression);
+    Q_INVOKABLE bool Evaluate(const QString& expression, EvaluationMode mode = EvaluationMode::Double);
     Q_INVOKABLE double GetResult() const noexcept;
+
+    // Exact digits of the last Decimal or integer only evaluation, the shortest form of the double otherwise.
+    Q_INVOKABLE QString GetResultText() const;
     
     Q_INVOKABLE QString GetErrorMessage() const noexcept;
 
+    // The shortest text which reads back as the same double, unless a precision is given.
+    Q_INVOKABLE QString FormatNumber(double value, NumberNotation notation = NumberNotation::Shortest, int precision = -1) const;
+
+    // Runs the evaluation on a worker thread and reports it through resultReady/errorOccurred, with the text of GetResultText.
+    // A newer call supersedes the pending one: its remaining stages are skipped and its result is dropped.
+    Q_INVOKABLE void EvaluateAsync(const QString& expression);
+
+    // Live result while typing, reported through previewReady, only the edited tail of the expression is 
+    // processed again. Runs off the GUI thread like EvaluateAsync, a newer call or an EvaluateAsync supersedes 
+    // the pending one. An incomplete expression reports nothing.
+    Q_INVOKABLE void PreviewAsync(const QString& expression);
+
+signals:
+    void resultReady(double result, const QString& text);
+    void errorOccurred(const QString& message);
+    void previewReady(double result);
+
+private:
+    // The exact digits of an integer only evaluation, the shortest form of the double otherwise. Integers 
+    // wider than 64 bits come from the bignum, within kResultTextBudget and Utils::Decimal::kMaxPowerDigits.
+    [[nodiscard]] QString MakeResultText(const EvaluationPipeline& pipeline, double result, RPNDecimalEvaluator& decimal_evaluator) const;
+
+    [[nodiscard]] bool IsStale(std::uint64_t generation) const noexcept;
+    [[nodiscard]] bool IsPreviewStale(std::uint64_t generation) const noexcept;
+
 private:
     double mResult;
+    QString mResultText;
     QString mErrorMessage;
 
-    Tokenizer mTokenizer;
-    RPNConverter mRPNConverter;
+    // One pipeline per worker thread plus the GUI thread, so callers never wait for each other.
+    Utils::ObjectPool<EvaluationPipeline> mPipelinePool;
+    RPNDecimalEvaluator mRPNDecimalEvaluator;
+
+    IncrementalEvaluator mIncrementalEvaluator;
+
+    std::atomic<std::uint64_t> mGeneration;
+    std::atomic<std::uint64_t> mPreviewGeneration;
+
+    // Declared last so they are destroyed first, waiting for the running workers. The preview 
+    // pool has a single thread, the incremental evaluator keeps the state of the previous preview.
+    QThreadPool mThreadPool;
+    QThreadPool mPreviewThreadPool;
 };
\ No newline at end of file
@@ -0,0 +1,501 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "calc-daemon.hpp"
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <logger.hpp>
+
+namespace
+{
+    constexpr std::size_t kReadSize{ std::size_t{ 64 } << 10 };
+    constexpr std::size_t kMaxEvents{ 64 };
+}
+
+CalcDaemon::CalcDaemon() :
+    mListenDescriptor{ -1 }, mEpollDescriptor{ -1 }, mStopDescriptor{ -1 }, mSocketPath{}, mConnections{}, mBatch{}, mBatchConnections{}, 
+    mRPNCompiler{}, mRPNProgramCache{}, mCacheCapacity{ kDefaultCacheCapacity }, mReadBuffer(kReadSize), mBindings{}, mExpression{}, mStatistics{}, mErrorMessage{}
+{ }
+
+CalcDaemon::~CalcDaemon() noexcept
+{
+    while (!std::empty(mConnections))
+    {
+        Close(std::begin(mConnections)->first);
+    }
+
+    for (const auto descriptor : { mListenDescriptor, mEpollDescriptor, mStopDescriptor })
+    {
+        if (descriptor >= 0)
+        {
+            ::close(descriptor);
+        }
+    }
+
+    if (!std::empty(mSocketPath))
+    {
+        ::unlink(mSocketPath.c_str());
+    }
+}
+
+bool CalcDaemon::Listen(const std::string& socket_path)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+    mErrorMessage.clear();
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+
+    if (std::size(socket_path) >= sizeof(address.sun_path))
+    {
+        mErrorMessage = QStringLiteral("socket path too long: %1").arg(QString::fromStdString(socket_path));
+        return false;
+    }
+
+    std::memcpy(address.sun_path, socket_path.c_str(), std::size(socket_path) + 1);
+
+    mListenDescriptor = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (mListenDescriptor < 0)
+    {
+        return Fail("socket");
+    }
+
+    // A socket file left behind by a daemon which did not shut down cleanly.
+    ::unlink(socket_path.c_str());
+
+    if (::bind(mListenDescriptor, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        return Fail("bind");
+    }
+
+    mSocketPath = socket_path;
+
+    if (::listen(mListenDescriptor, SOMAXCONN) != 0)
+    {
+        return Fail("listen");
+    }
+
+    mEpollDescriptor = ::epoll_create1(EPOLL_CLOEXEC);
+    mStopDescriptor = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (mEpollDescriptor < 0 || mStopDescriptor < 0)
+    {
+        return Fail("epoll");
+    }
+
+    for (const auto descriptor : { mListenDescriptor, mStopDescriptor })
+    {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = descriptor;
+
+        if (::epoll_ctl(mEpollDescriptor, EPOLL_CTL_ADD, descriptor, &event) != 0)
+        {
+            return Fail("epoll_ctl");
+        }
+    }
+
+    UT_CC_DEFAULT_LOGGER_INFO("---- Listening on {}", socket_path);
+    return true;
+}
+
+bool CalcDaemon::Run()
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+
+    if (mEpollDescriptor < 0)
+    {
+        mErrorMessage = QStringLiteral("not listening");
+        return false;
+    }
+
+    std::array<epoll_event, kMaxEvents> events{};
+
+    for (bool is_stopping{}; !is_stopping; )
+    {
+        const auto count{ ::epoll_wait(mEpollDescriptor, std::data(events), static_cast<int>(std::size(events)), -1) };
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return Fail("epoll_wait");
+        }
+
+        for (int i{}; i < count; ++i)
+        {
+            const auto descriptor{ events[i].data.fd };
+            const auto flags{ events[i].events };
+
+            if (descriptor == mStopDescriptor)
+            {
+                is_stopping = true;
+                continue;
+            }
+
+            if (descriptor == mListenDescriptor)
+            {
+                Accept();
+                continue;
+            }
+
+            const auto iterator{ mConnections.find(descriptor) };
+            if (iterator == std::end(mConnections))
+            {
+                continue;
+            }
+
+            auto& connection{ *iterator->second };
+
+            // A hang up is reported whatever the events, writing then fails and tells whether the peer is gone.
+            if ((flags & (EPOLLOUT | EPOLLHUP | EPOLLERR)) != 0)
+            {
+                Flush(connection);
+            }
+
+            if ((connection.mEvents & EPOLLIN) != 0 && !connection.mIsBroken && (flags & (EPOLLIN | EPOLLHUP | EPOLLERR)) != 0)
+            {
+                Receive(connection);
+            }
+
+            // A connection with requests in the batch is updated after the batch.
+            if (!connection.mIsInBatch)
+            {
+                Update(connection);
+            }
+        }
+
+        EvaluateBatch();
+    }
+
+    UT_CC_DEFAULT_LOGGER_INFO("---- Stopped after {} requests in {} batches", mStatistics.mRequests, mStatistics.mBatches);
+    return true;
+}
+
+void CalcDaemon::Stop() noexcept
+{
+    if (mStopDescriptor >= 0)
+    {
+        const std::uint64_t increment{ 1 };
+        [[maybe_unused]] const auto written{ ::write(mStopDescriptor, &increment, sizeof(increment)) };
+    }
+}
+
+bool CalcDaemon::LoadCache(const std::string& path)
+{
+    mErrorMessage.clear();
+
+    if (!mRPNProgramCache.Open(path))
+    {
+        mErrorMessage = mRPNProgramCache.GetErrorMessage();
+        return false;
+    }
+
+    return true;
+}
+
+bool CalcDaemon::SaveCache(const std::string& path)
+{
+    mErrorMessage.clear();
+
+    if (!mRPNProgramCache.Save(path))
+    {
+        mErrorMessage = mRPNProgramCache.GetErrorMessage();
+        return false;
+    }
+
+    return true;
+}
+
+void CalcDaemon::SetCacheCapacity(std::size_t capacity) noexcept
+{
+    mCacheCapacity = capacity;
+}
+
+const CalcDaemon::Statistics& CalcDaemon::GetStatistics() const noexcept
+{
+    return mStatistics;
+}
+
+bool CalcDaemon::HasError() const noexcept
+{
+    return !mErrorMessage.isEmpty();
+}
+
+const QString& CalcDaemon::GetErrorMessage() const noexcept
+{
+    return mErrorMessage;
+}
+
+void CalcDaemon::Accept()
+{
+    for (;;)
+    {
+        const auto descriptor{ ::accept4(mListenDescriptor, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC) };
+        if (descriptor < 0)
+        {
+            // EAGAIN once the backlog is empty, anything else concerns only the connection being accepted.
+            return;
+        }
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = descriptor;
+
+        if (::epoll_ctl(mEpollDescriptor, EPOLL_CTL_ADD, descriptor, &event) != 0)
+        {
+            ::close(descriptor);
+            continue;
+        }
+
+        mConnections.emplace(descriptor, std::make_unique<Connection>(Connection{ descriptor, {}, 0, {}, 0, EPOLLIN, false, false, false }));
+        ++mStatistics.mConnections;
+    }
+}
+
+void CalcDaemon::Receive(Connection& connection)
+{
+    for (;;)
+    {
+        const auto size{ ::read(connection.mDescriptor, std::data(mReadBuffer), std::size(mReadBuffer)) };
+        if (size > 0)
+        {
+            connection.mInput.insert(std::end(connection.mInput), std::data(mReadBuffer), std::data(mReadBuffer) + size);
+
+            // A short read means the socket is drained, no need for the read returning EAGAIN.
+            if (static_cast<std::size_t>(size) < std::size(mReadBuffer))
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        if (size < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        // Once the peer stops sending, the requests it sent before are still answered. 
+        // After a read error nothing can be relied on.
+        connection.mIsClosing = size == 0;
+        connection.mIsBroken = size < 0 && errno != EAGAIN && errno != EWOULDBLOCK;
+        break;
+    }
+
+    const std::span<const char> input{ connection.mInput };
+    bool has_requests{};
+
+    for (;;)
+    {
+        CalcProtocol::Frame frame{};
+        const auto status{ CalcProtocol::ParseFrame(input.subspan(connection.mInputParsed), frame) };
+
+        if (status == CalcProtocol::ParseStatus::Malformed)
+        {
+            connection.mIsClosing = true;
+            break;
+        }
+
+        if (status == CalcProtocol::ParseStatus::Incomplete)
+        {
+            break;
+        }
+
+        mBatch.push_back({ &connection, frame });
+        connection.mInputParsed += frame.GetSize();
+        has_requests = true;
+    }
+
+    if (has_requests && !connection.mIsInBatch)
+    {
+        connection.mIsInBatch = true;
+        mBatchConnections.push_back(&connection);
+    }
+}
+
+void CalcDaemon::EvaluateBatch()
+{
+    if (std::empty(mBatch))
+    {
+        return;
+    }
+
+    ++mStatistics.mBatches;
+
+    for (const auto& [connection, frame] : mBatch)
+    {
+        Evaluate(frame, connection->mOutput);
+    }
+
+    mBatch.clear();
+
+    for (auto* connection : mBatchConnections)
+    {
+        // The frames of the batch pointed into the input, it can be compacted now.
+        connection->mInput.erase(std::begin(connection->mInput), std::begin(connection->mInput) + static_cast<std::ptrdiff_t>(connection->mInputParsed));
+        connection->mInputParsed = 0;
+        connection->mIsInBatch = false;
+
+        Flush(*connection);
+        Update(*connection);
+    }
+
+    mBatchConnections.clear();
+}
+
+void CalcDaemon::Evaluate(const CalcProtocol::Frame& frame, std::vector<char>& output)
+{
+    ++mStatistics.mRequests;
+
+    std::string_view expression{};
+    if (!CalcProtocol::DecodeRequest(frame, mBindings, expression))
+    {
+        CalcProtocol::AppendError(output, frame.mRequestId, "malformed request");
+        return;
+    }
+
+    mExpression = QString::fromUtf8(std::data(expression), static_cast<qsizetype>(std::size(expression)));
+
+    if (const auto cached_program{ mRPNProgramCache.Find(mExpression) })
+    {
+        ++mStatistics.mCacheHits;
+        CalcProtocol::AppendResult(output, frame.mRequestId, cached_program->Evaluate(mBindings));
+        return;
+    }
+
+    ++mStatistics.mCompilations;
+    auto program{ mRPNCompiler.Compile(mExpression) };
+
+    if (mRPNCompiler.HasError())
+    {
+        const auto error_message{ mRPNCompiler.GetErrorMessage().toUtf8() };
+        CalcProtocol::AppendError(output, frame.mRequestId, { std::data(error_message), static_cast<std::size_t>(std::size(error_message)) });
+        return;
+    }
+
+    CalcProtocol::AppendResult(output, frame.mRequestId, program.Evaluate(mBindings));
+
+    if (mRPNProgramCache.GetSize() < mCacheCapacity)
+    {
+        mRPNProgramCache.Add(mExpression, std::move(program));
+    }
+}
+
+void CalcDaemon::Flush(Connection& connection)
+{
+    auto& output{ connection.mOutput };
+
+    while (connection.mOutputWritten < std::size(output))
+    {
+        const auto size{ ::send(connection.mDescriptor, std::data(output) + connection.mOutputWritten, std::size(output) - connection.mOutputWritten, MSG_NOSIGNAL) };
+        if (size >= 0)
+        {
+            connection.mOutputWritten += static_cast<std::size_t>(size);
+            continue;
+        }
+
+        if (errno == EINTR)
+        {
+            continue;
+        }
+
+        // Otherwise the socket buffer is full, the rest goes out when epoll reports it writable.
+        connection.mIsBroken = errno != EAGAIN && errno != EWOULDBLOCK;
+
+        // Dropped once it outweighs the rest, so a client which keeps some responses unread does not grow the buffer forever.
+        if (connection.mOutputWritten >= std::size(output) / 2)
+        {
+            output.erase(std::begin(output), std::begin(output) + static_cast<std::ptrdiff_t>(connection.mOutputWritten));
+            connection.mOutputWritten = 0;
+        }
+
+        return;
+    }
+
+    output.clear();
+    connection.mOutputWritten = 0;
+}
+
+void CalcDaemon::Update(Connection& connection)
+{
+    const auto queued{ std::size(connection.mOutput) - connection.mOutputWritten };
+
+    if (connection.mIsBroken || (connection.mIsClosing && queued == 0))
+    {
+        Close(connection.mDescriptor);
+        return;
+    }
+
+    // A client which does not read its responses is not read from either, so they cannot pile up without bound.
+    std::uint32_t events{};
+    if (!connection.mIsClosing && queued <= kMaxQueuedOutput)
+    {
+        events |= EPOLLIN;
+    }
+    else if (!connection.mIsClosing && (connection.mEvents & EPOLLIN) != 0)
+    {
+        ++mStatistics.mReadPauses;
+    }
+
+    if (queued != 0)
+    {
+        events |= EPOLLOUT;
+    }
+
+    if (events != connection.mEvents)
+    {
+        epoll_event event{};
+        event.events = events;
+        event.data.fd = connection.mDescriptor;
+
+        ::epoll_ctl(mEpollDescriptor, EPOLL_CTL_MOD, connection.mDescriptor, &event);
+        connection.mEvents = events;
+    }
+}
+
+void CalcDaemon::Close(int descriptor) noexcept
+{
+    ::epoll_ctl(mEpollDescriptor, EPOLL_CTL_DEL, descriptor, nullptr);
+    ::close(descriptor);
+
+    mConnections.erase(descriptor);
+}
+
+bool CalcDaemon::Fail(std::string_view what)
+{
+    mErrorMessage = QStringLiteral("%1: %2").arg(QString::fromUtf8(std::data(what), static_cast<qsizetype>(std::size(what))), QString::fromLocal8Bit(std::strerror(errno)));
+    return false;
+}
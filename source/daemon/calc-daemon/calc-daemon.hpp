@@ -0,0 +1,160 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+/*
+    Expression evaluation for the processes of one host, served over a Unix domain socket 
+    (see CalcProtocol for the framing) from a single thread driven by epoll.
+
+    Every wakeup reads whatever all ready connections have sent, evaluates the complete 
+    requests as one batch and then writes the responses with one write per connection, so 
+    the system calls are amortised over all the requests which arrived together. Programs 
+    are compiled once and kept in one RPNProgramCache shared by every client, which can be 
+    loaded from and saved to a file to survive restarts.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <QString>
+
+#include <rpn-compiler.hpp>
+#include <rpn-program-cache.hpp>
+#include <calc-protocol.hpp>
+
+class CalcDaemon
+{
+public:
+    // Compiled programs kept in the cache at most, later ones are compiled on every request.
+    static constexpr std::size_t kDefaultCacheCapacity{ 1 << 16 };
+
+    // Responses queued for a connection at most before its requests stop being read, until it reads them.
+    static constexpr std::size_t kMaxQueuedOutput{ std::size_t{ 1 } << 20 };
+
+    struct Statistics
+    {
+        std::uint64_t mConnections;
+        std::uint64_t mRequests;
+        std::uint64_t mBatches;
+        std::uint64_t mCacheHits;
+        std::uint64_t mCompilations;
+        std::uint64_t mReadPauses;
+    };
+
+public:
+    CalcDaemon();
+    ~CalcDaemon() noexcept;
+
+    CalcDaemon(const CalcDaemon&) = delete;
+    CalcDaemon& operator=(const CalcDaemon&) = delete;
+
+    // Creates the socket, replacing a stale one left at socket_path. It is removed again on destruction.
+    [[nodiscard]] bool Listen(const std::string& socket_path);
+
+    // Serves the clients on the calling thread until Stop.
+    [[nodiscard]] bool Run();
+
+    // Safe to call from any thread and from a signal handler.
+    void Stop() noexcept;
+
+    // The cache file is optional, a missing or rejected one leaves the cache empty.
+    [[nodiscard]] bool LoadCache(const std::string& path);
+    [[nodiscard]] bool SaveCache(const std::string& path);
+
+    void SetCacheCapacity(std::size_t capacity) noexcept;
+
+    // Only read it while Run is not running.
+    [[nodiscard]] const Statistics& GetStatistics() const noexcept;
+
+    [[nodiscard]] bool HasError() const noexcept;
+    [[nodiscard]] const QString& GetErrorMessage() const noexcept;
+
+private:
+    struct Connection
+    {
+        int mDescriptor;
+
+        // Received bytes, of which the first mInputParsed belong to requests of the current batch.
+        std::vector<char> mInput;
+        std::size_t mInputParsed;
+
+        // Responses not written yet, from mOutputWritten on.
+        std::vector<char> mOutput;
+        std::size_t mOutputWritten;
+
+        // The epoll events the descriptor is registered for.
+        std::uint32_t mEvents;
+
+        // Closing: nothing more is read, it is closed once its output is written. Broken: closed right away.
+        bool mIsClosing;
+        bool mIsBroken;
+        bool mIsInBatch;
+    };
+
+    struct PendingRequest
+    {
+        Connection* mConnection;
+        CalcProtocol::Frame mFrame;
+    };
+
+private:
+    void Accept();
+    void Receive(Connection& connection);
+    void EvaluateBatch();
+    void Evaluate(const CalcProtocol::Frame& frame, std::vector<char>& output);
+    void Flush(Connection& connection);
+
+    // Closes a connection which is done, otherwise registers it for the events it waits for now.
+    void Update(Connection& connection);
+    void Close(int descriptor) noexcept;
+
+    [[nodiscard]] bool Fail(std::string_view what);
+
+private:
+    int mListenDescriptor;
+    int mEpollDescriptor;
+    int mStopDescriptor;
+    std::string mSocketPath;
+
+    std::unordered_map<int, std::unique_ptr<Connection>> mConnections;
+    std::vector<PendingRequest> mBatch;
+    std::vector<Connection*> mBatchConnections;
+
+    RPNCompiler mRPNCompiler;
+    RPNProgramCache mRPNProgramCache;
+    std::size_t mCacheCapacity;
+
+    // Reused for every read and every request.
+    std::vector<char> mReadBuffer;
+    std::vector<double> mBindings;
+    QString mExpression;
+
+    Statistics mStatistics;
+    QString mErrorMessage;
+};
@@ -0,0 +1,87 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <csignal>
+#include <cstdio>
+#include <string>
+
+#include <logger.hpp>
+
+#include "calc-daemon.hpp"
+
+namespace
+{
+    CalcDaemon* gCalcDaemon{};
+
+    void OnStopSignal(int)
+    {
+        gCalcDaemon->Stop();
+    }
+}
+
+// Usage: calc-daemon [socket path] [cache file]
+int main(int argc, char** argv)
+{
+    UT_CC_DEFAULT_LOGGER_INIT();
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+
+    const std::string socket_path{ argc > 1 ? argv[1] : "/tmp/calc-daemon.sock" };
+    const std::string cache_path{ argc > 2 ? argv[2] : "" };
+
+    CalcDaemon calc_daemon{};
+
+    if (!std::empty(cache_path) && !calc_daemon.LoadCache(cache_path))
+    {
+        UT_CC_DEFAULT_LOGGER_WARN("---- Starting with an empty cache: {}", calc_daemon.GetErrorMessage().toStdString());
+    }
+
+    if (!calc_daemon.Listen(socket_path))
+    {
+        std::fprintf(stderr, "calc-daemon: %s\n", calc_daemon.GetErrorMessage().toStdString().c_str());
+        return 1;
+    }
+
+    gCalcDaemon = &calc_daemon;
+    std::signal(SIGINT, OnStopSignal);
+    std::signal(SIGTERM, OnStopSignal);
+
+    if (!calc_daemon.Run())
+    {
+        std::fprintf(stderr, "calc-daemon: %s\n", calc_daemon.GetErrorMessage().toStdString().c_str());
+        return 1;
+    }
+
+    const auto& statistics{ calc_daemon.GetStatistics() };
+    std::printf("calc-daemon: %llu connections, %llu requests in %llu batches, %llu cache hits, %llu compilations, %llu read pauses\n",
+        static_cast<unsigned long long>(statistics.mConnections), static_cast<unsigned long long>(statistics.mRequests),
+        static_cast<unsigned long long>(statistics.mBatches), static_cast<unsigned long long>(statistics.mCacheHits),
+        static_cast<unsigned long long>(statistics.mCompilations), static_cast<unsigned long long>(statistics.mReadPauses));
+
+    if (!std::empty(cache_path) && !calc_daemon.SaveCache(cache_path))
+    {
+        std::fprintf(stderr, "calc-daemon: %s\n", calc_daemon.GetErrorMessage().toStdString().c_str());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,246 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+/*
+    Load generator for calc-daemon. Every connection runs on its own thread and keeps a fixed 
+    number of requests in flight, the latency of a request is measured from just before it is 
+    sent to the parsing of its response.
+
+    Usage: calc-load [socket path] [connections] [requests per connection] [requests in flight]
+*/
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <calc-protocol.hpp>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr std::array<std::string_view, 4> kExpressions
+    {
+        "3*x^3+2*x^2+5*x+1",
+        "sqrt(x*x+y*y)",
+        "max(x,y)-min(x,y)/2",
+        "(1250*36-(480+125)*12)/7+x",
+    };
+
+    struct ConnectionResult
+    {
+        std::vector<double> mLatencies;
+        std::size_t mErrors;
+        bool mIsFailed;
+    };
+
+    [[nodiscard]] int Connect(const std::string& socket_path)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+
+        if (std::size(socket_path) >= sizeof(address.sun_path))
+        {
+            return -1;
+        }
+
+        std::memcpy(address.sun_path, socket_path.c_str(), std::size(socket_path) + 1);
+
+        const auto descriptor{ ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0) };
+        if (descriptor >= 0 && ::connect(descriptor, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+        {
+            ::close(descriptor);
+            return -1;
+        }
+
+        return descriptor;
+    }
+
+    [[nodiscard]] bool SendAll(int descriptor, std::span<const char> bytes)
+    {
+        while (!std::empty(bytes))
+        {
+            const auto size{ ::send(descriptor, std::data(bytes), std::size(bytes), MSG_NOSIGNAL) };
+            if (size <= 0)
+            {
+                return false;
+            }
+
+            bytes = bytes.subspan(static_cast<std::size_t>(size));
+        }
+
+        return true;
+    }
+
+    void RunConnection(const std::string& socket_path, std::size_t request_count, std::size_t in_flight, std::size_t seed, ConnectionResult& result)
+    {
+        const auto descriptor{ Connect(socket_path) };
+        if (descriptor < 0)
+        {
+            result.mIsFailed = true;
+            return;
+        }
+
+        std::vector<Clock::time_point> send_times(request_count);
+        std::vector<char> output{};
+        std::vector<char> input{};
+        std::vector<char> read_buffer(std::size_t{ 64 } << 10);
+
+        result.mLatencies.reserve(request_count);
+
+        std::size_t sent{};
+        std::size_t received{};
+
+        while (received < request_count)
+        {
+            output.clear();
+
+            for (; sent < request_count && sent - received < in_flight; ++sent)
+            {
+                const auto x{ static_cast<double>((seed + sent) % 1000) / 10.0 };
+                const std::array bindings{ x, 100.0 - x };
+
+                CalcProtocol::AppendRequest(output, static_cast<std::uint32_t>(sent), bindings, kExpressions[(seed + sent) % std::size(kExpressions)]);
+                send_times[sent] = Clock::now();
+            }
+
+            if (!SendAll(descriptor, output))
+            {
+                result.mIsFailed = true;
+                break;
+            }
+
+            const auto size{ ::read(descriptor, std::data(read_buffer), std::size(read_buffer)) };
+            if (size <= 0)
+            {
+                result.mIsFailed = true;
+                break;
+            }
+
+            input.insert(std::end(input), std::data(read_buffer), std::data(read_buffer) + size);
+
+            std::size_t parsed{};
+            CalcProtocol::Frame frame{};
+
+            while (CalcProtocol::ParseFrame(std::span<const char>{ input }.subspan(parsed), frame) == CalcProtocol::ParseStatus::Complete)
+            {
+                const auto now{ Clock::now() };
+                parsed += frame.GetSize();
+
+                CalcProtocol::Response response{};
+                if (!CalcProtocol::DecodeResponse(frame, response) || frame.mRequestId >= request_count)
+                {
+                    result.mIsFailed = true;
+                    break;
+                }
+
+                result.mErrors += response.mStatus != CalcProtocol::Status::Ok;
+                result.mLatencies.push_back(std::chrono::duration<double, std::micro>(now - send_times[frame.mRequestId]).count());
+                ++received;
+            }
+
+            if (result.mIsFailed)
+            {
+                break;
+            }
+
+            input.erase(std::begin(input), std::begin(input) + static_cast<std::ptrdiff_t>(parsed));
+        }
+
+        ::close(descriptor);
+    }
+
+    [[nodiscard]] double Percentile(const std::vector<double>& sorted, double fraction)
+    {
+        const auto index{ static_cast<std::size_t>(fraction * static_cast<double>(std::size(sorted))) };
+        return sorted[std::min(index, std::size(sorted) - 1)];
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::string socket_path{ argc > 1 ? argv[1] : "/tmp/calc-daemon.sock" };
+    const std::size_t connection_count{ argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 4 };
+    const std::size_t request_count{ argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 100'000 };
+    const std::size_t in_flight{ argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 32 };
+
+    if (connection_count == 0 || request_count == 0 || in_flight == 0)
+    {
+        std::fprintf(stderr, "usage: calc-load [socket path] [connections] [requests per connection] [requests in flight]\n");
+        return 1;
+    }
+
+    std::vector<ConnectionResult> results(connection_count);
+    std::vector<std::thread> threads{};
+
+    const auto begin{ Clock::now() };
+
+    for (std::size_t i{}; i < connection_count; ++i)
+    {
+        threads.emplace_back(RunConnection, std::cref(socket_path), request_count, in_flight, i * 7919, std::ref(results[i]));
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const std::chrono::duration<double> elapsed{ Clock::now() - begin };
+
+    std::vector<double> latencies{};
+    std::size_t errors{};
+
+    for (const auto& result : results)
+    {
+        if (result.mIsFailed)
+        {
+            std::fprintf(stderr, "calc-load: cannot talk to the daemon at %s\n", socket_path.c_str());
+            return 1;
+        }
+
+        latencies.insert(std::end(latencies), std::begin(result.mLatencies), std::end(result.mLatencies));
+        errors += result.mErrors;
+    }
+
+    std::sort(std::begin(latencies), std::end(latencies));
+
+    std::printf("calc-load: %zu connections x %zu requests, %zu in flight\n", connection_count, request_count, in_flight);
+    std::printf("    requests/s  %.0f\n", static_cast<double>(std::size(latencies)) / elapsed.count());
+    std::printf("    p50         %.1f us\n", Percentile(latencies, 0.50));
+    std::printf("    p99         %.1f us\n", Percentile(latencies, 0.99));
+    std::printf("    max         %.1f us\n", latencies.back());
+    std::printf("    errors      %zu\n", errors);
+
+    return 0;
+}
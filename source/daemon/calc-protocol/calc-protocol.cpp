@@ -0,0 +1,163 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "calc-protocol.hpp"
+
+#include <cstring>
+
+namespace CalcProtocol
+{
+    namespace
+    {
+        template <typename TValue>
+        [[nodiscard]] TValue Load(const char* source) noexcept
+        {
+            TValue value{};
+            std::memcpy(&value, source, sizeof(TValue));
+
+            return value;
+        }
+
+        template <typename TValue>
+        void Store(std::vector<char>& output, const TValue& value)
+        {
+            const auto* bytes{ reinterpret_cast<const char*>(&value) };
+            output.insert(std::end(output), bytes, bytes + sizeof(TValue));
+        }
+
+        void AppendHeader(std::vector<char>& output, std::uint32_t request_id, std::size_t payload_size)
+        {
+            Store(output, static_cast<std::uint32_t>(payload_size));
+            Store(output, request_id);
+        }
+    }
+
+    ParseStatus ParseFrame(std::span<const char> input, Frame& frame) noexcept
+    {
+        if (std::size(input) < kHeaderSize)
+        {
+            return ParseStatus::Incomplete;
+        }
+
+        const auto payload_size{ Load<std::uint32_t>(std::data(input)) };
+        if (payload_size > kMaxPayloadSize)
+        {
+            return ParseStatus::Malformed;
+        }
+
+        if (std::size(input) - kHeaderSize < payload_size)
+        {
+            return ParseStatus::Incomplete;
+        }
+
+        frame.mRequestId = Load<std::uint32_t>(std::data(input) + sizeof(std::uint32_t));
+        frame.mPayload = input.subspan(kHeaderSize, payload_size);
+
+        return ParseStatus::Complete;
+    }
+
+    bool DecodeRequest(const Frame& frame, std::vector<double>& bindings, std::string_view& expression)
+    {
+        const auto payload{ frame.mPayload };
+        if (std::size(payload) < sizeof(std::uint32_t))
+        {
+            return false;
+        }
+
+        const auto binding_count{ Load<std::uint32_t>(std::data(payload)) };
+        const auto bindings_end{ sizeof(std::uint32_t) + std::size_t{ binding_count } * sizeof(double) };
+
+        if (bindings_end > std::size(payload))
+        {
+            return false;
+        }
+
+        bindings.resize(binding_count);
+        std::memcpy(std::data(bindings), std::data(payload) + sizeof(std::uint32_t), binding_count * sizeof(double));
+
+        expression = { std::data(payload) + bindings_end, std::size(payload) - bindings_end };
+        return true;
+    }
+
+    bool DecodeResponse(const Frame& frame, Response& response) noexcept
+    {
+        const auto payload{ frame.mPayload };
+        if (std::empty(payload))
+        {
+            return false;
+        }
+
+        response.mStatus = static_cast<Status>(payload[0]);
+        switch (response.mStatus)
+        {
+        case Status::Ok:
+        {
+            if (std::size(payload) != 1 + sizeof(double))
+            {
+                return false;
+            }
+
+            response.mValue = Load<double>(std::data(payload) + 1);
+            response.mErrorMessage = {};
+            return true;
+        }
+
+        case Status::Error:
+        {
+            response.mValue = 0.0;
+            response.mErrorMessage = { std::data(payload) + 1, std::size(payload) - 1 };
+            return true;
+        }
+        }
+
+        return false;
+    }
+
+    void AppendRequest(std::vector<char>& output, std::uint32_t request_id, std::span<const double> bindings, std::string_view expression)
+    {
+        AppendHeader(output, request_id, sizeof(std::uint32_t) + std::size(bindings) * sizeof(double) + std::size(expression));
+        Store(output, static_cast<std::uint32_t>(std::size(bindings)));
+
+        for (const auto binding : bindings)
+        {
+            Store(output, binding);
+        }
+
+        output.insert(std::end(output), std::begin(expression), std::end(expression));
+    }
+
+    void AppendResult(std::vector<char>& output, std::uint32_t request_id, double value)
+    {
+        AppendHeader(output, request_id, 1 + sizeof(double));
+        Store(output, Status::Ok);
+        Store(output, value);
+    }
+
+    void AppendError(std::vector<char>& output, std::uint32_t request_id, std::string_view error_message)
+    {
+        AppendHeader(output, request_id, 1 + std::size(error_message));
+        Store(output, Status::Error);
+
+        output.insert(std::end(output), std::begin(error_message), std::end(error_message));
+    }
+}
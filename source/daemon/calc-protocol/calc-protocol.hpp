@@ -0,0 +1,91 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+/*
+    Binary framing of the calc-daemon protocol. It is only spoken over a local Unix domain socket, 
+    so integers and doubles are in native byte order and nothing is aligned.
+
+        Frame       u32 payload size, u32 request id, payload
+        Request     u32 binding count, the bindings as doubles (values of the variables in order 
+                    of first appearance), UTF-8 expression text up to the end of the payload
+        Response    u8 status, then a double for Status::Ok or a UTF-8 error message
+
+    A client may send any number of requests without waiting for the responses, which come back 
+    in the order of the requests of that connection. The request id is only echoed.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace CalcProtocol
+{
+    inline constexpr std::size_t kHeaderSize{ 2 * sizeof(std::uint32_t) };
+
+    // Larger frames are malformed, the daemon closes the connection.
+    inline constexpr std::uint32_t kMaxPayloadSize{ 1 << 20 };
+
+    enum class Status : std::uint8_t
+    {
+        Ok,
+        Error
+    };
+
+    enum class ParseStatus : std::uint8_t
+    {
+        Complete,
+        Incomplete,
+        Malformed
+    };
+
+    struct Frame
+    {
+        std::uint32_t mRequestId;
+        std::span<const char> mPayload;
+
+        // Header and payload, what to skip to the next frame.
+        [[nodiscard]] std::size_t GetSize() const noexcept { return kHeaderSize + std::size(mPayload); }
+    };
+
+    struct Response
+    {
+        Status mStatus;
+        double mValue;
+        std::string_view mErrorMessage;
+    };
+
+    // The frame at the beginning of input, its payload points into input.
+    [[nodiscard]] ParseStatus ParseFrame(std::span<const char> input, Frame& frame) noexcept;
+
+    // Bindings are copied out into the caller's buffer, the expression points into the frame.
+    [[nodiscard]] bool DecodeRequest(const Frame& frame, std::vector<double>& bindings, std::string_view& expression);
+    [[nodiscard]] bool DecodeResponse(const Frame& frame, Response& response) noexcept;
+
+    void AppendRequest(std::vector<char>& output, std::uint32_t request_id, std::span<const double> bindings, std::string_view expression);
+    void AppendResult(std::vector<char>& output, std::uint32_t request_id, double value);
+    void AppendError(std::vector<char>& output, std::uint32_t request_id, std::string_view error_message);
+}
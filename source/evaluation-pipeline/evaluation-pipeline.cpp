@@ -0,0 +1,263 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "evaluation-pipeline.hpp"
+
+#include <algorithm>
+#include <limits>
+
+EvaluationPipeline::EvaluationPipeline() :
+    mTokenizer{}, mParenthesisMatcher{}, mRPNConverter{}, mRPNExpression{}, mOperands{}, mIntegerOperands{}, mIsReassociating{}, mLimits{}, mIsLimited{}, mResult{}, mIntegerResult{}, mErrorMessage{}
+{ }
+
+bool EvaluationPipeline::Tokenize(const QString& expression)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+    mErrorMessage.clear();
+
+    // An input over the length limit is rejected by the tokenizer right away, there is no point in scanning it.
+    const auto is_within_limit{ static_cast<std::size_t>(expression.size()) <= mLimits.mMaxInputLength };
+
+    if (expression.size() >= kParenthesisCheckThreshold && is_within_limit && !mParenthesisMatcher.Check(expression))
+    {
+        mErrorMessage = mParenthesisMatcher.GetErrorMessage();
+        return false;
+    }
+
+    // The RPN of the previous expression shares the lexemes of its tokens, released here so the 
+    // tokenizer finds them unshared and collects the new lexemes in their storage.
+    mRPNExpression.clear();
+
+    // One-shot, so no checkpoints; the token buffer and the coroutine frames are reused all the same.
+    mTokenizer.Init(expression);
+    mTokenizer.Run();
+
+    if (mTokenizer.HasError())
+    {
+        mErrorMessage = mTokenizer.GetErrorMessage();
+        return false;
+    }
+
+    return !HasUnboundVariable(mTokenizer.GetTokens());
+}
+
+bool EvaluationPipeline::Convert()
+{
+    if (!mRPNConverter.Convert(mTokenizer.GetTokens(), mRPNExpression))
+    {
+        mErrorMessage = mRPNConverter.GetErrorMessage();
+        return false;
+    }
+
+    if (mIsReassociating)
+    {
+        // Copied back so the buffer keeps its capacity.
+        const auto reassociated{ RPNReassociator::Reassociate(mRPNExpression) };
+        mRPNExpression.assign(std::cbegin(reassociated), std::cend(reassociated));
+    }
+
+    return true;
+}
+
+double EvaluationPipeline::Evaluate()
+{
+    if (!mIsLimited)
+    {
+        mIntegerResult = RPNIntegerEvaluator::Evaluate(mRPNExpression, mIntegerOperands);
+
+        mResult = mIntegerResult.mOutcome == RPNIntegerEvaluator::Outcome::Exact ? 
+            static_cast<double>(mIntegerResult.mValue) : RPNEvaluator::Evaluate(mRPNExpression, mOperands);
+
+        return mResult;
+    }
+
+    // Both paths are governed, the double one only runs when the integer one gave up for another reason.
+    Utils::LimitViolation violation{};
+    mIntegerResult = RPNIntegerEvaluator::Evaluate(mRPNExpression, mIntegerOperands, mLimits, violation);
+
+    if (mIntegerResult.mOutcome == RPNIntegerEvaluator::Outcome::Exact)
+    {
+        mResult = static_cast<double>(mIntegerResult.mValue);
+    }
+    else if (mIntegerResult.mOutcome != RPNIntegerEvaluator::Outcome::LimitExceeded)
+    {
+        mResult = RPNEvaluator::Evaluate(mRPNExpression, mOperands, mLimits, violation);
+    }
+    else
+    {
+        mResult = std::numeric_limits<double>::quiet_NaN();
+    }
+
+    if (violation != Utils::LimitViolation::None)
+    {
+        mErrorMessage = Utils::DescribeLimitViolation(violation, mLimits);
+    }
+
+    return mResult;
+}
+
+void EvaluationPipeline::SetReassociation(bool is_enabled) noexcept
+{
+    mIsReassociating = is_enabled;
+}
+
+bool EvaluationPipeline::IsReassociating() const noexcept
+{
+    return mIsReassociating;
+}
+
+void EvaluationPipeline::SetLimits(const Utils::ResourceLimits& limits) noexcept
+{
+    mLimits = limits;
+    mIsLimited = limits.mMaxInputLength != Utils::ResourceLimits::kUnlimited || limits.mMaxTokenCount != Utils::ResourceLimits::kUnlimited || 
+        limits.mMaxNestingDepth != Utils::ResourceLimits::kUnlimited || limits.mMaxOperandStackDepth != Utils::ResourceLimits::kUnlimited || 
+        limits.mDeadline != Utils::ResourceLimits::Clock::time_point::max();
+
+    mTokenizer.SetLimits(limits);
+    mRPNConverter.SetLimits(limits);
+}
+
+const Utils::ResourceLimits& EvaluationPipeline::GetLimits() const noexcept
+{
+    return mLimits;
+}
+
+bool EvaluationPipeline::Run(const QString& expression)
+{
+    if (!Tokenize(expression) || !Convert())
+    {
+        return false;
+    }
+
+    std::ignore = Evaluate();
+    return mErrorMessage.isEmpty();
+}
+
+bool EvaluationPipeline::RunStream(Utils::InputGenerator<Tokenizer::Symbol> input_generator, const bool& has_read_error, std::size_t batch_size)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+    mErrorMessage.clear();
+
+    mOperands.clear();
+    mRPNConverter.BeginParts();
+
+    // A unary minus may end one batch and apply to the first operand of the next.
+    double sign{ 1.0 };
+
+    const auto consume_tokens = [this, &sign](std::span<const Tokenizer::TokenPair> tokens)
+    {
+        mRPNExpression.clear();
+
+        if (HasUnboundVariable(tokens) || !mRPNConverter.ConvertPart(tokens, mRPNExpression))
+        {
+            return false;
+        }
+
+        RPNEvaluator::EvaluatePart(mRPNExpression, mOperands, sign);
+
+        // Checked once per batch, the operands waiting for an operator are all that is kept.
+        if (std::size(mOperands) > mLimits.mMaxOperandStackDepth)
+        {
+            mErrorMessage = Utils::DescribeLimitViolation(Utils::LimitViolation::OperandStackDepth, mLimits);
+            return false;
+        }
+
+        return true;
+    };
+
+    mTokenizer.Run(std::move(input_generator), consume_tokens, batch_size);
+
+    // What was read before the failure is only a prefix of the expression.
+    if (has_read_error)
+    {
+        mErrorMessage = QStringLiteral("Failed to read the input");
+        mRPNExpression.clear();
+        return false;
+    }
+
+    // The consumer stops the tokenizer, so its error is the cause.
+    if (!mErrorMessage.isEmpty() || mRPNConverter.HasError() || mTokenizer.HasError())
+    {
+        if (mErrorMessage.isEmpty())
+        {
+            mErrorMessage = mRPNConverter.HasError() ? mRPNConverter.GetErrorMessage() : mTokenizer.GetErrorMessage();
+        }
+
+        mRPNExpression.clear();
+        return false;
+    }
+
+    mRPNExpression.clear();
+    if (!mRPNConverter.FinishParts(mRPNExpression))
+    {
+        mErrorMessage = mRPNConverter.GetErrorMessage();
+        mRPNExpression.clear();
+        return false;
+    }
+
+    RPNEvaluator::EvaluatePart(mRPNExpression, mOperands, sign);
+    mRPNExpression.clear();
+
+    if (std::empty(mOperands))
+    {
+        mErrorMessage = QStringLiteral("Input is empty");
+        return false;
+    }
+
+    mResult = mOperands.back();
+    mIntegerResult = { RPNIntegerEvaluator::Outcome::NotInteger, 0 };
+
+    return true;
+}
+
+bool EvaluationPipeline::HasUnboundVariable(std::span<const Tokenizer::TokenPair> tokens)
+{
+    // Only a compiled RPNProgram binds variables, the evaluators would take them for NaN.
+    const auto identifier{ std::ranges::find(tokens, Tokenizer::Token::Identifier, &Tokenizer::TokenPair::mToken) };
+    if (identifier == std::end(tokens))
+    {
+        return false;
+    }
+
+    mErrorMessage = QStringLiteral("unknown variable: %1").arg(identifier->mLexeme);
+    return true;
+}
+
+const std::vector<Tokenizer::TokenPair>& EvaluationPipeline::GetRPNExpression() const noexcept
+{
+    return mRPNExpression;
+}
+
+double EvaluationPipeline::GetResult() const noexcept
+{
+    return mResult;
+}
+
+const RPNIntegerEvaluator::Result& EvaluationPipeline::GetIntegerResult() const noexcept
+{
+    return mIntegerResult;
+}
+
+const QString& EvaluationPipeline::GetErrorMessage() const noexcept
+{
+    return mErrorMessage;
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Tokenizer, converter and every intermediate buffer of one evaluation, meant to be reused. 
+    The buffers grow to the largest expression seen and keep that capacity, so evaluating 
+    again does not reallocate them. Stages are separate so a caller can stop between them.
+
+    Once warmed up by an expression at least as large, Run makes no call to the global 
+    allocator with logging off: token, RPN and operand buffers keep their capacity, symbol 
+    lexemes are static, number and identifier lexemes reuse the storage of the previous ones 
+    and the tokenizer's coroutine frames come from its Utils::FrameCache. What still allocates:
+    - reassociation, which builds the regrouped expression anew;
+    - error messages;
+    - a lexeme longer than the one whose storage it reuses;
+    - RunStream, whose input source is a coroutine of its own.
+*/
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <QString>
+
+#include <tokenizer.hpp>
+#include <parenthesis-matcher.hpp>
+#include <rpn-converter.hpp>
+#include <rpn-reassociator.hpp>
+#include <rpn-evaluator.hpp>
+#include <rpn-integer-evaluator.hpp>
+
+class EvaluationPipeline
+{
+public:
+    // From this length on, Tokenize checks the parentheses before tokenizing, see ParenthesisMatcher.
+    static constexpr qsizetype kParenthesisCheckThreshold{ 1 << 16 };
+
+public:
+    EvaluationPipeline();
+    ~EvaluationPipeline() noexcept = default;
+
+    // A variable is an error here, "unknown variable: x", only RPNCompiler binds variables.
+    [[nodiscard]] bool Tokenize(const QString& expression);
+    [[nodiscard]] bool Convert();
+
+    // Integer only expressions are evaluated exactly in std::int64_t first, 
+    // doubles are used when the result leaves it, see GetIntegerResult.
+    // Returns NaN and sets the error message if a limit is exceeded.
+    [[nodiscard]] double Evaluate();
+
+    // Off by default. Convert regroups chains of + and * into balanced trees, see RPNReassociator.
+    void SetReassociation(bool is_enabled) noexcept;
+    [[nodiscard]] bool IsReassociating() const noexcept;
+
+    // Unlimited by default, every stage checks its part of the limits, see Utils::ResourceLimits, 
+    // the exact integer path included. The deadline is absolute, so set the limits again before every 
+    // evaluation that has one.
+    void SetLimits(const Utils::ResourceLimits& limits) noexcept;
+    [[nodiscard]] const Utils::ResourceLimits& GetLimits() const noexcept;
+
+    // Runs all three stages.
+    [[nodiscard]] bool Run(const QString& expression);
+
+    // Runs all three stages over an input read as it is consumed, see Tokenizer::Run with a sink. Every batch 
+    // of tokens is converted and evaluated right away, so only the operator and operand stacks grow, with the 
+    // nesting depth. Streamed input is evaluated in doubles, with no parenthesis pre-check and no reassociation, 
+    // which need the whole expression; GetRPNExpression is left empty. has_read_error is the flag of the input 
+    // source, see Utils::InputSources: a failed read only ends the input, so it is checked once the input has ended.
+    [[nodiscard]] bool RunStream(Utils::InputGenerator<Tokenizer::Symbol> input_generator, const bool& has_read_error, 
+        std::size_t batch_size = Tokenizer::kDefaultStreamBatchSize);
+
+    [[nodiscard]] const std::vector<Tokenizer::TokenPair>& GetRPNExpression() const noexcept;
+    [[nodiscard]] double GetResult() const noexcept;
+    [[nodiscard]] const RPNIntegerEvaluator::Result& GetIntegerResult() const noexcept;
+    [[nodiscard]] const QString& GetErrorMessage() const noexcept;
+
+private:
+    // Sets the error message for the first identifier of tokens, if there is one.
+    [[nodiscard]] bool HasUnboundVariable(std::span<const Tokenizer::TokenPair> tokens);
+
+private:
+    Tokenizer mTokenizer;
+    ParenthesisMatcher mParenthesisMatcher;
+    RPNConverter mRPNConverter;
+
+    std::vector<Tokenizer::TokenPair> mRPNExpression;
+    std::vector<double> mOperands;
+    std::vector<std::int64_t> mIntegerOperands;
+
+    bool mIsReassociating;
+
+    Utils::ResourceLimits mLimits;
+    bool mIsLimited;
+
+    double mResult;
+    RPNIntegerEvaluator::Result mIntegerResult;
+    QString mErrorMessage;
+};
\ No newline at end of file
@@ -0,0 +1,330 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "result-memo.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+    // Bytes per slot: the slot and its CLOCK state.
+    constexpr std::size_t kSlotMemory{ 25 };
+    constexpr std::size_t kMinShardSlots{ 8 };
+
+    // MurmurHash3 x64 128 over a stream of 64 bit words.
+    class Hasher
+    {
+    public:
+        void Add(std::uint64_t word) noexcept
+        {
+            if (!mHasPending)
+            {
+                mPending = word;
+                mHasPending = true;
+                return;
+            }
+
+            Mix(mPending, word);
+            mHasPending = false;
+        }
+
+        [[nodiscard]] ResultMemo::Key Finish() noexcept
+        {
+            if (mHasPending)
+            {
+                mLow ^= std::rotl(mPending * kFirst, 31) * kSecond;
+                mLength += 8;
+            }
+
+            mLow ^= mLength;
+            mHigh ^= mLength;
+
+            mLow += mHigh;
+            mHigh += mLow;
+
+            mLow = Avalanche(mLow);
+            mHigh = Avalanche(mHigh);
+
+            mLow += mHigh;
+            mHigh += mLow;
+
+            return { mLow, mHigh };
+        }
+
+    private:
+        void Mix(std::uint64_t first, std::uint64_t second) noexcept
+        {
+            mLow ^= std::rotl(first * kFirst, 31) * kSecond;
+            mLow = (std::rotl(mLow, 27) + mHigh) * 5 + 0x52dce729;
+
+            mHigh ^= std::rotl(second * kSecond, 33) * kFirst;
+            mHigh = (std::rotl(mHigh, 31) + mLow) * 5 + 0x38495ab5;
+
+            mLength += 16;
+        }
+
+        [[nodiscard]] static std::uint64_t Avalanche(std::uint64_t value) noexcept
+        {
+            value ^= value >> 33;
+            value *= 0xff51afd7ed558ccd;
+            value ^= value >> 33;
+            value *= 0xc4ceb9fe1a85ec53;
+            value ^= value >> 33;
+
+            return value;
+        }
+
+    private:
+        static constexpr std::uint64_t kFirst{ 0x87c37b91114253d5 };
+        static constexpr std::uint64_t kSecond{ 0x4cf5ad432745937f };
+
+        std::uint64_t mLow{};
+        std::uint64_t mHigh{};
+        std::uint64_t mPending{};
+        std::uint64_t mLength{};
+        bool mHasPending{};
+    };
+
+    enum SlotState : std::uint8_t
+    {
+        Empty,
+        Occupied,
+        Referenced,
+    };
+}
+
+ResultMemo::ResultMemo(std::size_t memory_cap, std::size_t shard_count) :
+    mShards{ std::make_unique<Shard[]>(std::bit_ceil(std::max<std::size_t>(shard_count, 1))) }, 
+    mShardMask{ std::bit_ceil(std::max<std::size_t>(shard_count, 1)) - 1 }
+{
+    const auto slots{ std::max(kMinShardSlots, std::bit_floor(memory_cap / (mShardMask + 1) / kSlotMemory)) };
+
+    for (std::size_t i{}; i <= mShardMask; ++i)
+    {
+        auto& shard{ mShards[i] };
+
+        shard.mSlots.resize(slots);
+        shard.mStates.assign(slots, SlotState::Empty);
+        shard.mHand = 0;
+
+        shard.mStatistics = {};
+        shard.mStatistics.mCapacity = slots / 4 * 3;
+    }
+}
+
+ResultMemo::Key ResultMemo::MakeKey(QStringView expression, std::span<const double> bindings) noexcept
+{
+    Hasher hasher{};
+
+    // Four UTF-16 code units per word.
+    std::uint64_t word{};
+    for (qsizetype i{}; i < expression.size(); ++i)
+    {
+        word = (word << 16) | expression[i].unicode();
+
+        if (i % 4 == 3)
+        {
+            hasher.Add(word);
+            word = 0;
+        }
+    }
+
+    hasher.Add(word);
+    hasher.Add(static_cast<std::uint64_t>(expression.size()));
+
+    for (const auto binding : bindings)
+    {
+        hasher.Add(std::bit_cast<std::uint64_t>(binding));
+    }
+
+    return hasher.Finish();
+}
+
+std::optional<double> ResultMemo::Find(const Key& key)
+{
+    auto& shard{ GetShard(key) };
+    const std::lock_guard lock{ shard.mMutex };
+
+    const auto index{ Probe(shard, key) };
+    if (index == std::size(shard.mSlots) || shard.mStates[index] == SlotState::Empty)
+    {
+        ++shard.mStatistics.mMisses;
+        return std::nullopt;
+    }
+
+    ++shard.mStatistics.mHits;
+    shard.mStates[index] = SlotState::Referenced;
+
+    return shard.mSlots[index].mValue;
+}
+
+void ResultMemo::Insert(const Key& key, double value)
+{
+    auto& shard{ GetShard(key) };
+    const std::lock_guard lock{ shard.mMutex };
+
+    auto index{ Probe(shard, key) };
+    if (index != std::size(shard.mSlots) && shard.mStates[index] != SlotState::Empty)
+    {
+        shard.mSlots[index].mValue = value;
+        shard.mStates[index] = SlotState::Referenced;
+        return;
+    }
+
+    if (shard.mStatistics.mSize == shard.mStatistics.mCapacity)
+    {
+        // CLOCK: a referenced slot gets another round, the first one which was not referenced goes.
+        const auto mask{ std::size(shard.mSlots) - 1 };
+
+        for (;; shard.mHand = (shard.mHand + 1) & mask)
+        {
+            auto& state{ shard.mStates[shard.mHand] };
+
+            if (state == SlotState::Referenced)
+            {
+                state = SlotState::Occupied;
+            }
+            else if (state == SlotState::Occupied)
+            {
+                Erase(shard, shard.mHand);
+
+                --shard.mStatistics.mSize;
+                ++shard.mStatistics.mEvictions;
+                break;
+            }
+        }
+
+        // Erase moves entries, the free slot of this key may have moved as well.
+        index = Probe(shard, key);
+    }
+
+    shard.mSlots[index] = { key, value };
+    shard.mStates[index] = SlotState::Occupied;
+
+    ++shard.mStatistics.mSize;
+    ++shard.mStatistics.mInsertions;
+}
+
+std::optional<double> ResultMemo::Evaluate(EvaluationPipeline& pipeline, const QString& expression)
+{
+    const auto key{ MakeKey(expression) };
+
+    if (const auto value{ Find(key) }; value.has_value())
+    {
+        return value;
+    }
+
+    if (!pipeline.Run(expression))
+    {
+        return std::nullopt;
+    }
+
+    Insert(key, pipeline.GetResult());
+    return pipeline.GetResult();
+}
+
+std::size_t ResultMemo::GetShardCount() const noexcept
+{
+    return mShardMask + 1;
+}
+
+ResultMemo::Statistics ResultMemo::GetStatistics(std::size_t shard) const
+{
+    const std::lock_guard lock{ mShards[shard].mMutex };
+    return mShards[shard].mStatistics;
+}
+
+ResultMemo::Statistics ResultMemo::GetStatistics() const
+{
+    Statistics total{};
+
+    for (std::size_t i{}; i <= mShardMask; ++i)
+    {
+        const auto statistics{ GetStatistics(i) };
+
+        total.mHits += statistics.mHits;
+        total.mMisses += statistics.mMisses;
+        total.mInsertions += statistics.mInsertions;
+        total.mEvictions += statistics.mEvictions;
+        total.mSize += statistics.mSize;
+        total.mCapacity += statistics.mCapacity;
+    }
+
+    return total;
+}
+
+void ResultMemo::Clear()
+{
+    for (std::size_t i{}; i <= mShardMask; ++i)
+    {
+        auto& shard{ mShards[i] };
+        const std::lock_guard lock{ shard.mMutex };
+
+        std::fill(std::begin(shard.mStates), std::end(shard.mStates), SlotState::Empty);
+        shard.mHand = 0;
+        shard.mStatistics.mSize = 0;
+    }
+}
+
+ResultMemo::Shard& ResultMemo::GetShard(const Key& key) noexcept
+{
+    // The low half picks the slot inside the shard, the high half the shard.
+    return mShards[key.mHigh & mShardMask];
+}
+
+std::size_t ResultMemo::Probe(const Shard& shard, const Key& key) noexcept
+{
+    const auto mask{ std::size(shard.mSlots) - 1 };
+
+    for (std::size_t step{}, index{ key.mLow & mask }; step <= mask; ++step, index = (index + 1) & mask)
+    {
+        if (shard.mStates[index] == SlotState::Empty || shard.mSlots[index].mKey == key)
+        {
+            return index;
+        }
+    }
+
+    return std::size(shard.mSlots);
+}
+
+void ResultMemo::Erase(Shard& shard, std::size_t index) noexcept
+{
+    const auto mask{ std::size(shard.mSlots) - 1 };
+    shard.mStates[index] = SlotState::Empty;
+
+    for (auto next{ (index + 1) & mask }; shard.mStates[next] != SlotState::Empty; next = (next + 1) & mask)
+    {
+        // An entry may fill the hole unless its home lies cyclically in (hole, next].
+        const auto home{ shard.mSlots[next].mKey.mLow & mask };
+        const bool stays{ index <= next ? (index < home && home <= next) : (index < home || home <= next) };
+
+        if (!stays)
+        {
+            shard.mSlots[index] = shard.mSlots[next];
+            shard.mStates[index] = shard.mStates[next];
+            shard.mStates[next] = SlotState::Empty;
+
+            index = next;
+        }
+    }
+}
\ No newline at end of file
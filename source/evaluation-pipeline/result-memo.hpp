@@ -0,0 +1,132 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Results of evaluations shared by many threads, keyed by a 128 bit hash of the expression 
+    text and the variable bindings. A hit returns the stored value without tokenizing, 
+    converting or evaluating anything.
+
+    The table is split into shards by the key, each guarded by its own mutex on its own cache 
+    line, so threads looking up different expressions rarely wait for each other and there is 
+    no global lock. A shard is an open addressing table of fixed size, derived from the memory 
+    cap, and is never resized. A full shard evicts by CLOCK: a hit marks the slot as referenced, 
+    the hand clears the mark of referenced slots and evicts the first unmarked one, which 
+    approximates LRU without reordering anything on a hit.
+
+    Only the key is stored, two expressions with the same 128 bit hash share a result.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <QString>
+#include <QStringView>
+
+#include "evaluation-pipeline.hpp"
+
+class ResultMemo
+{
+public:
+    struct Key
+    {
+        std::uint64_t mLow;
+        std::uint64_t mHigh;
+
+        [[nodiscard]] bool operator==(const Key&) const noexcept = default;
+    };
+
+    struct Statistics
+    {
+        std::uint64_t mHits;
+        std::uint64_t mMisses;
+        std::uint64_t mInsertions;
+        std::uint64_t mEvictions;
+        std::size_t mSize;
+        std::size_t mCapacity;
+    };
+
+    static constexpr std::size_t kDefaultMemoryCap{ 16 << 20 };
+    static constexpr std::size_t kDefaultShardCount{ 64 };
+
+public:
+    // The shard count is rounded up to a power of two, every shard gets an equal part of memory_cap.
+    explicit ResultMemo(std::size_t memory_cap = kDefaultMemoryCap, std::size_t shard_count = kDefaultShardCount);
+    ~ResultMemo() noexcept = default;
+
+    [[nodiscard]] static Key MakeKey(QStringView expression, std::span<const double> bindings = {}) noexcept;
+
+    [[nodiscard]] std::optional<double> Find(const Key& key);
+    void Insert(const Key& key, double value);
+
+    // Runs the pipeline on a miss and remembers the result, expressions which fail are not remembered.
+    // The pipeline belongs to the calling thread.
+    [[nodiscard]] std::optional<double> Evaluate(EvaluationPipeline& pipeline, const QString& expression);
+
+    [[nodiscard]] std::size_t GetShardCount() const noexcept;
+    [[nodiscard]] Statistics GetStatistics(std::size_t shard) const;
+
+    // Sum over all shards.
+    [[nodiscard]] Statistics GetStatistics() const;
+
+    void Clear();
+
+private:
+    struct Slot
+    {
+        Key mKey;
+        double mValue;
+    };
+
+    // Aligned so two shards never share a cache line.
+    struct alignas(64) Shard
+    {
+        mutable std::mutex mMutex;
+
+        std::vector<Slot> mSlots;
+
+        // Per slot: 0 empty, 1 occupied, 2 occupied and referenced since the hand passed.
+        std::vector<std::uint8_t> mStates;
+        std::size_t mHand;
+
+        Statistics mStatistics;
+    };
+
+private:
+    [[nodiscard]] Shard& GetShard(const Key& key) noexcept;
+
+    // Index of the slot holding key, or of the first empty slot of its probe sequence, or size() if neither exists.
+    [[nodiscard]] static std::size_t Probe(const Shard& shard, const Key& key) noexcept;
+
+    // Removes the slot and moves the following entries of its cluster back, so probing stays correct.
+    static void Erase(Shard& shard, std::size_t index) noexcept;
+
+private:
+    std::unique_ptr<Shard[]> mShards;
+    std::size_t mShardMask;
+};
\ No newline at end of file
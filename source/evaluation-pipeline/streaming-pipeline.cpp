@@ -0,0 +1,241 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "streaming-pipeline.hpp"
+
+#include <bit>
+#include <limits>
+#include <thread>
+#include <algorithm>
+#include <system_error>
+
+#include <logger.hpp>
+#include <rpn-evaluator.hpp>
+#include <rpn-integer-evaluator.hpp>
+
+namespace
+{
+    // Both queues full and one batch in each stage.
+    [[nodiscard]] std::size_t GetBatchCount(std::size_t queue_capacity) noexcept
+    {
+        return 2 * std::bit_ceil(std::max<std::size_t>(queue_capacity, 1)) + 3;
+    }
+}
+
+StreamingPipeline::StreamingPipeline(std::size_t batch_size, std::size_t queue_capacity) :
+    mBatchSize{ std::max<std::size_t>(batch_size, 1) }, mBatches(GetBatchCount(queue_capacity)), 
+    mFreeBatches{ GetBatchCount(queue_capacity) }, mTokenized{ queue_capacity }, mConverted{ queue_capacity }, 
+    mTokenizer{}, mRPNConverter{}, mOperands{}, mIntegerOperands{}
+{
+    for (auto& batch : mBatches)
+    {
+        batch.mTokens.resize(mBatchSize);
+        batch.mRPNExpressions.resize(mBatchSize);
+
+        mFreeBatches.Push(&batch);
+    }
+}
+
+std::size_t StreamingPipeline::Run(std::span<const QString> expressions, std::span<double> results)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+
+    if (std::size(results) < std::size(expressions))
+    {
+        std::fill(std::begin(results), std::end(results), std::numeric_limits<double>::quiet_NaN());
+        return std::size(results);
+    }
+
+    std::thread tokenizer_thread{};
+    std::thread converter_thread{};
+
+    try
+    {
+        tokenizer_thread = std::thread{ &StreamingPipeline::Tokenize, this, expressions };
+        converter_thread = std::thread{ &StreamingPipeline::Convert, this };
+    }
+    catch (const std::system_error&)
+    { }
+
+    // Without threads the remaining stages take turns on this one, a batch at a time.
+    const auto failed{ converter_thread.joinable() ? Evaluate(results) : RunInline(expressions, results, tokenizer_thread.joinable()) };
+
+    if (tokenizer_thread.joinable())
+    {
+        tokenizer_thread.join();
+    }
+
+    if (converter_thread.joinable())
+    {
+        converter_thread.join();
+    }
+
+    return failed;
+}
+
+std::size_t StreamingPipeline::GetBatchSize() const noexcept
+{
+    return mBatchSize;
+}
+
+void StreamingPipeline::Tokenize(std::span<const QString> expressions)
+{
+    for (std::size_t first{}; ;)
+    {
+        auto* batch{ mFreeBatches.Pop() };
+        TokenizeBatch(*batch, expressions, first);
+
+        const auto count{ batch->mCount };
+        mTokenized.Push(batch);
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        first += count;
+    }
+}
+
+void StreamingPipeline::Convert()
+{
+    for (;;)
+    {
+        auto* batch{ mTokenized.Pop() };
+        ConvertBatch(*batch);
+
+        const auto count{ batch->mCount };
+        mConverted.Push(batch);
+
+        if (count == 0)
+        {
+            return;
+        }
+    }
+}
+
+std::size_t StreamingPipeline::Evaluate(std::span<double> results)
+{
+    for (std::size_t failed{}; ;)
+    {
+        auto* batch{ mConverted.Pop() };
+        failed += EvaluateBatch(*batch, results);
+
+        const auto count{ batch->mCount };
+        mFreeBatches.Push(batch);
+
+        if (count == 0)
+        {
+            return failed;
+        }
+    }
+}
+
+std::size_t StreamingPipeline::RunInline(std::span<const QString> expressions, std::span<double> results, bool is_tokenizer_running)
+{
+    for (std::size_t first{}, failed{}; ;)
+    {
+        auto* batch{ is_tokenizer_running ? mTokenized.Pop() : mFreeBatches.Pop() };
+
+        if (!is_tokenizer_running)
+        {
+            TokenizeBatch(*batch, expressions, first);
+        }
+
+        ConvertBatch(*batch);
+        failed += EvaluateBatch(*batch, results);
+
+        const auto count{ batch->mCount };
+        mFreeBatches.Push(batch);
+
+        if (count == 0)
+        {
+            return failed;
+        }
+
+        first += count;
+    }
+}
+
+void StreamingPipeline::TokenizeBatch(Batch& batch, std::span<const QString> expressions, std::size_t first)
+{
+    batch.mFirst = first;
+    batch.mCount = std::min(mBatchSize, std::size(expressions) - first);
+
+    for (std::size_t i{}; i < batch.mCount; ++i)
+    {
+        // The tokenizer reuses its buffers and coroutine frames between expressions, assign keeps the capacity of the batch.
+        mTokenizer.Init(expressions[first + i]);
+        mTokenizer.Run();
+
+        // As in EvaluationPipeline::Tokenize, a variable fails the expression.
+        auto& tokens{ batch.mTokens[i] };
+        const auto has_variable{ std::ranges::find(mTokenizer.GetTokens(), Tokenizer::Token::Identifier, &Tokenizer::TokenPair::mToken) != std::cend(mTokenizer.GetTokens()) };
+        if (mTokenizer.HasError() || has_variable)
+        {
+            tokens.clear();
+        }
+        else
+        {
+            tokens.assign(std::cbegin(mTokenizer.GetTokens()), std::cend(mTokenizer.GetTokens()));
+        }
+    }
+}
+
+void StreamingPipeline::ConvertBatch(Batch& batch)
+{
+    for (std::size_t i{}; i < batch.mCount; ++i)
+    {
+        auto& rpn_expression{ batch.mRPNExpressions[i] };
+
+        if (std::empty(batch.mTokens[i]) || !mRPNConverter.Convert(batch.mTokens[i], rpn_expression))
+        {
+            rpn_expression.clear();
+        }
+    }
+}
+
+std::size_t StreamingPipeline::EvaluateBatch(const Batch& batch, std::span<double> results)
+{
+    std::size_t failed{};
+
+    for (std::size_t i{}; i < batch.mCount; ++i)
+    {
+        const auto& rpn_expression{ batch.mRPNExpressions[i] };
+        auto& result{ results[batch.mFirst + i] };
+
+        if (std::empty(rpn_expression))
+        {
+            result = std::numeric_limits<double>::quiet_NaN();
+            ++failed;
+            continue;
+        }
+
+        // As EvaluationPipeline::Evaluate: exact in std::int64_t when possible.
+        const auto integer_result{ RPNIntegerEvaluator::Evaluate(rpn_expression, mIntegerOperands) };
+
+        result = integer_result.mOutcome == RPNIntegerEvaluator::Outcome::Exact ? 
+            static_cast<double>(integer_result.mValue) : RPNEvaluator::Evaluate(rpn_expression, mOperands);
+    }
+
+    return failed;
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Evaluates a stream of expressions with the tokenizer, the converter and the evaluator each on 
+    its own thread. Expressions travel in batches through bounded single producer / single consumer 
+    queues: tokenizer -> converter -> evaluator, and the evaluator hands every batch back to the 
+    tokenizer once done, so the batches and their token buffers are reused and the number of batches 
+    in flight is bounded. A stage that runs ahead waits for a free batch, which is the backpressure.
+
+    Each thread only touches its own stage, so the tokenizer's coroutines, the converter's stack and 
+    the evaluator's operands stay in the cache of the core running it. Results are the ones of 
+    EvaluationPipeline::Run.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <QString>
+
+#include <tokenizer.hpp>
+#include <rpn-converter.hpp>
+#include <spsc-queue.hpp>
+
+class StreamingPipeline
+{
+public:
+    static constexpr std::size_t kDefaultBatchSize{ 64 };
+    static constexpr std::size_t kDefaultQueueCapacity{ 4 };
+
+public:
+    // queue_capacity batches may wait between two stages, the tokenizer stops when both queues are full.
+    explicit StreamingPipeline(std::size_t batch_size = kDefaultBatchSize, std::size_t queue_capacity = kDefaultQueueCapacity);
+    ~StreamingPipeline() noexcept = default;
+
+    // results[i] is the value of expressions[i], NaN for an expression which does not tokenize or convert.
+    // Returns the number of such expressions. results must be at least as large as expressions.
+    std::size_t Run(std::span<const QString> expressions, std::span<double> results);
+
+    [[nodiscard]] std::size_t GetBatchSize() const noexcept;
+
+private:
+    struct Batch
+    {
+        // Expressions [mFirst, mFirst + mCount) of the stream, a batch with mCount = 0 ends it.
+        std::size_t mFirst;
+        std::size_t mCount;
+
+        // Tokens, then RPN expressions, empty for expressions which failed.
+        std::vector<std::vector<Tokenizer::TokenPair>> mTokens;
+        std::vector<std::vector<Tokenizer::TokenPair>> mRPNExpressions;
+    };
+
+private:
+    // Loops of the three stages, each runs until the batch which ends the stream.
+    void Tokenize(std::span<const QString> expressions);
+    void Convert();
+    std::size_t Evaluate(std::span<double> results);
+
+    // Converts and evaluates on the calling thread, and tokenizes too unless the tokenizer thread runs.
+    std::size_t RunInline(std::span<const QString> expressions, std::span<double> results, bool is_tokenizer_running);
+
+    void TokenizeBatch(Batch& batch, std::span<const QString> expressions, std::size_t first);
+    void ConvertBatch(Batch& batch);
+    std::size_t EvaluateBatch(const Batch& batch, std::span<double> results);
+
+private:
+    std::size_t mBatchSize;
+
+    // Every batch is always in exactly one of the queues or owned by one stage.
+    std::vector<Batch> mBatches;
+
+    Utils::SPSCQueue<Batch*> mFreeBatches;
+    Utils::SPSCQueue<Batch*> mTokenized;
+    Utils::SPSCQueue<Batch*> mConverted;
+
+    Tokenizer mTokenizer;
+    RPNConverter mRPNConverter;
+    std::vector<double> mOperands;
+    std::vector<std::int64_t> mIntegerOperands;
+};
\ No newline at end of file
@@ -0,0 +1,172 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "incremental-evaluator.hpp"
+
+IncrementalEvaluator::IncrementalEvaluator() :
+    mTokenizer{}, mRPNConverter{}, mRPNPart{}, mOperands{}, mSign{ 1.0 }, mCheckpoints{}, mResumeToken{}, mLimits{}, mResult{}, mErrorMessage{}
+{ 
+    mTokenizer.SetIncremental(true);
+    mRPNConverter.SetUndoLogging(true);
+    mOperands.SetLogging(true);
+}
+
+bool IncrementalEvaluator::Update(const QString& input)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+    mErrorMessage.clear();
+
+    mTokenizer.Update(input);
+
+    // Failed updates are not processed, so the earliest change since the last processed one is tracked.
+    mResumeToken = std::min(mResumeToken, mTokenizer.GetFirstChangedToken());
+
+    if (mTokenizer.HasError())
+    {
+        mErrorMessage = mTokenizer.GetErrorMessage();
+        return false;
+    }
+
+    const auto& tokens{ mTokenizer.GetTokens() };
+    if (std::empty(tokens))
+    {
+        mErrorMessage = QStringLiteral("Input is empty");
+        return false;
+    }
+
+    if (std::empty(mCheckpoints))
+    {
+        mResumeToken = 0;
+    }
+    else
+    {
+        mResumeToken = std::min(mResumeToken, std::size(mCheckpoints) - 1);
+        Rewind(mCheckpoints[mResumeToken]);
+    }
+
+    if (mResumeToken == 0)
+    {
+        mRPNConverter.BeginParts();
+        mOperands.clear();
+        mSign = 1.0;
+    }
+
+    mCheckpoints.resize(mResumeToken);
+
+    Utils::LimitViolation violation{};
+    Utils::EvaluationGovernor governor{ mLimits, violation };
+
+    for (auto i{ mResumeToken }; i < std::size(tokens); ++i)
+    {
+        mCheckpoints.push_back(MakeCheckpoint());
+
+        if (!Process(std::span{ tokens }.subspan(i, 1), governor))
+        {
+            mResumeToken = i;
+            return false;
+        }
+    }
+
+    mCheckpoints.push_back(MakeCheckpoint());
+    mResumeToken = std::size(tokens);
+
+    return Finish(governor);
+}
+
+double IncrementalEvaluator::GetResult() const noexcept
+{
+    return mResult;
+}
+
+bool IncrementalEvaluator::HasError() const noexcept
+{
+    return !mErrorMessage.isEmpty();
+}
+
+const QString& IncrementalEvaluator::GetErrorMessage() const noexcept
+{
+    return mErrorMessage;
+}
+
+void IncrementalEvaluator::SetLimits(const Utils::ResourceLimits& limits) noexcept
+{
+    mLimits = limits;
+
+    mTokenizer.SetLimits(limits);
+    mRPNConverter.SetLimits(limits);
+}
+
+bool IncrementalEvaluator::Process(std::span<const Tokenizer::TokenPair> token, Utils::EvaluationGovernor& governor)
+{
+    mRPNPart.clear();
+
+    if (!mRPNConverter.ConvertPart(token, mRPNPart))
+    {
+        mErrorMessage = mRPNConverter.GetErrorMessage();
+        return false;
+    }
+
+    if (!RPNEvaluator::EvaluatePart(mRPNPart, mOperands, mSign, governor))
+    {
+        mErrorMessage = Utils::DescribeLimitViolation(governor.mViolation, mLimits);
+        return false;
+    }
+
+    return true;
+}
+
+bool IncrementalEvaluator::Finish(Utils::EvaluationGovernor& governor)
+{
+    // The pending operators are applied and undone again, the checkpointed state stays resumable.
+    mRPNPart.clear();
+
+    bool is_complete{ false };
+    if (!mRPNConverter.FinishParts(mRPNPart))
+    {
+        mErrorMessage = mRPNConverter.GetErrorMessage();
+    }
+    else if (!RPNEvaluator::EvaluatePart(mRPNPart, mOperands, mSign, governor))
+    {
+        mErrorMessage = Utils::DescribeLimitViolation(governor.mViolation, mLimits);
+    }
+    else
+    {
+        mResult = mOperands.back();
+        is_complete = true;
+    }
+
+    Rewind(mCheckpoints.back());
+
+    return is_complete;
+}
+
+IncrementalEvaluator::Checkpoint IncrementalEvaluator::MakeCheckpoint() const
+{
+    return { mRPNConverter.GetCheckpoint(), mOperands.GetChangeCount(), mSign };
+}
+
+void IncrementalEvaluator::Rewind(const Checkpoint& checkpoint)
+{
+    mRPNConverter.Rewind(checkpoint.mConverter);
+    mOperands.Rewind(checkpoint.mOperandChangeCount);
+    mSign = checkpoint.mSign;
+}
\ No newline at end of file
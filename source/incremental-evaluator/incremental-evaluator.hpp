@@ -0,0 +1,96 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Live evaluation of an expression which is edited at its tail, e.g. while typing on the keypad.
+    Every token goes through RPNConverter::ConvertPart and the RPN it completes through 
+    RPNEvaluator::EvaluatePart right away, and their state is checkpointed before every token, 
+    so an edit resumes from the first changed token.
+
+    A checkpoint is a position in the undo logs of the converter's stacks and the operand stack, 
+    not a copy of them: going back undoes the changes after it, so memory and the cost of an edit 
+    follow the tokens processed rather than tokens times nesting depth.
+*/
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <QString>
+
+#include <tokenizer.hpp>
+#include <rpn-converter.hpp>
+#include <rpn-evaluator.hpp>
+#include <resource-limits.hpp>
+#include <undo-stack.hpp>
+
+class IncrementalEvaluator
+{
+public:
+    IncrementalEvaluator();
+    ~IncrementalEvaluator() noexcept = default;
+
+    [[nodiscard]] bool Update(const QString& input);
+
+    [[nodiscard]] double GetResult() const noexcept;
+
+    [[nodiscard]] bool HasError() const noexcept;
+    [[nodiscard]] const QString& GetErrorMessage() const noexcept;
+
+    // Unlimited by default, every stage checks its part of the limits on the tokens it processes, see Utils::ResourceLimits. 
+    // The deadline covers one Update.
+    void SetLimits(const Utils::ResourceLimits& limits) noexcept;
+
+private:
+    // Converter and evaluator state right before a token is processed, see Rewind.
+    struct Checkpoint
+    {
+        RPNConverter::Checkpoint mConverter;
+        std::size_t mOperandChangeCount;
+        double mSign;
+    };
+
+private:
+    [[nodiscard]] bool Process(std::span<const Tokenizer::TokenPair> token, Utils::EvaluationGovernor& governor);
+    [[nodiscard]] bool Finish(Utils::EvaluationGovernor& governor);
+
+    [[nodiscard]] Checkpoint MakeCheckpoint() const;
+    void Rewind(const Checkpoint& checkpoint);
+
+private:
+    Tokenizer mTokenizer;
+    RPNConverter mRPNConverter;
+
+    // The RPN completed by the token being processed, handed from the converter to the evaluator.
+    std::vector<Tokenizer::TokenPair> mRPNPart;
+    Utils::UndoStack<double> mOperands;
+    double mSign;
+
+    std::vector<Checkpoint> mCheckpoints;
+    std::size_t mResumeToken;
+
+    Utils::ResourceLimits mLimits;
+
+    double mResult;
+    QString mErrorMessage;
+};
\ No newline at end of file
@@ -0,0 +1,199 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "math-functions.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include <vector-math.hpp>
+
+namespace
+{
+    using Id = MathFunctions::Id;
+
+    // Indexed by Id.
+    constexpr std::array<MathFunctions::Descriptor, 7> kFunctions{{
+        { u"sin", Id::Sin, 1 },
+        { u"cos", Id::Cos, 1 },
+        { u"exp", Id::Exp, 1 },
+        { u"log", Id::Log, 1 },
+        { u"sqrt", Id::Sqrt, 1 },
+        { u"min", Id::Min, 2 },
+        { u"max", Id::Max, 2 },
+    }};
+
+    // Unevaluated sum mHigh + mLow, carries about twice the precision of a double.
+    struct DoubleDouble
+    {
+        double mHigh;
+        double mLow;
+    };
+
+    // Exact product a * b = mHigh + mLow (Dekker), no fma needed on the baseline x86-64 target.
+    [[nodiscard]] DoubleDouble TwoProduct(double a, double b) noexcept
+    {
+        constexpr double kSplitter{ 134217729.0 }; // 2^27 + 1
+
+        const auto product{ a * b };
+
+        const auto scaled_a{ kSplitter * a };
+        const auto a_high{ scaled_a - (scaled_a - a) };
+        const auto a_low{ a - a_high };
+
+        const auto scaled_b{ kSplitter * b };
+        const auto b_high{ scaled_b - (scaled_b - b) };
+        const auto b_low{ b - b_high };
+
+        return { product, ((a_high * b_high - product) + a_high * b_low + a_low * b_high) + a_low * b_low };
+    }
+
+    [[nodiscard]] DoubleDouble Multiply(DoubleDouble lhs, DoubleDouble rhs) noexcept
+    {
+        const auto [high, low]{ TwoProduct(lhs.mHigh, rhs.mHigh) };
+        const auto error{ low + (lhs.mHigh * rhs.mLow + lhs.mLow * rhs.mHigh) };
+        const auto sum{ high + error };
+
+        return { sum, error - (sum - high) };
+    }
+
+    // Below this the low parts become subnormal and lose the extra precision.
+    constexpr double kMinDoubleDoubleResult{ 0x1p-969 };
+}
+
+const MathFunctions::Descriptor* MathFunctions::Find(QStringView name) noexcept
+{
+    const auto found{ std::find_if(std::begin(kFunctions), std::end(kFunctions), [name](const auto& descriptor) 
+    {
+        return std::equal(std::begin(descriptor.mName), std::end(descriptor.mName), name.begin(), name.end(), 
+            [](const char16_t ch, const QChar other) { return ch == other.unicode(); });
+    }) };
+
+    return found != std::end(kFunctions) ? &*found : nullptr;
+}
+
+const MathFunctions::Descriptor& MathFunctions::Get(Id id) noexcept
+{
+    return kFunctions[static_cast<std::size_t>(id)];
+}
+
+double MathFunctions::Apply(Id id, std::span<const double> arguments) noexcept
+{
+    switch (id)
+    {
+    case Id::Sin: return Utils::VectorMath::Sin(arguments[0]);
+    case Id::Cos: return Utils::VectorMath::Cos(arguments[0]);
+    case Id::Exp: return Utils::VectorMath::Exp(arguments[0]);
+    case Id::Log: return Utils::VectorMath::Log(arguments[0]);
+    case Id::Sqrt: return Utils::VectorMath::Sqrt(arguments[0]);
+    case Id::Min: return Utils::VectorMath::Min(arguments[0], arguments[1]);
+    case Id::Max: return Utils::VectorMath::Max(arguments[0], arguments[1]);
+    }
+
+    return 0.0;
+}
+
+void MathFunctions::ApplyBatch(Id id, std::span<const double> first, std::span<const double> second, std::span<double> output) noexcept
+{
+    switch (id)
+    {
+    case Id::Sin: Utils::VectorMath::Sin(first, output); break;
+    case Id::Cos: Utils::VectorMath::Cos(first, output); break;
+    case Id::Exp: Utils::VectorMath::Exp(first, output); break;
+    case Id::Log: Utils::VectorMath::Log(first, output); break;
+    case Id::Sqrt: Utils::VectorMath::Sqrt(first, output); break;
+    case Id::Min: Utils::VectorMath::Min(first, second, output); break;
+    case Id::Max: Utils::VectorMath::Max(first, second, output); break;
+    }
+}
+
+double MathFunctions::Power(double base, double exponent) noexcept
+{
+    if (std::fabs(exponent) <= kMaxSquaringExponent && exponent == std::trunc(exponent))
+    {
+        return IntegerPower(base, static_cast<std::int32_t>(exponent));
+    }
+
+    return std::pow(base, exponent);
+}
+
+double MathFunctions::IntegerPower(double base, std::int32_t exponent) noexcept
+{
+    // Short multiply chains stay within 1 ulp on their own, only x^2 is correctly rounded.
+    double result{ 1.0 };
+
+    switch (exponent)
+    {
+    case 0:  return 1.0;
+    case 1:  return base;
+    case 2:  return base * base;
+    case 3:  result = base * base * base; break;
+    case -1: result = 1.0 / base; break;
+    case -2: result = 1.0 / (base * base); break;
+
+    default:
+    {
+        // Squaring in double-double, so the rounding errors of the steps do not add up.
+        auto remaining{ static_cast<std::uint32_t>(std::abs(exponent)) };
+
+        DoubleDouble power{ 1.0, 0.0 };
+        DoubleDouble square{ base, 0.0 };
+
+        while (remaining != 0)
+        {
+            if ((remaining & 1) != 0) { power = Multiply(power, square); }
+
+            remaining >>= 1;
+            if (remaining != 0) { square = Multiply(square, square); }
+        }
+
+        if (exponent > 0)
+        {
+            result = power.mHigh + power.mLow;
+            break;
+        }
+
+        if (std::fabs(power.mHigh) < kMinDoubleDoubleResult)
+        {
+            return std::pow(base, exponent);
+        }
+
+        // 1 / (high + low) with one Newton step, 1 - quotient * high is exact.
+        const auto quotient{ 1.0 / power.mHigh };
+        const auto [product, product_error]{ TwoProduct(quotient, power.mHigh) };
+        const auto residual{ ((1.0 - product) - product_error) - quotient * power.mLow };
+
+        result = quotient + quotient * residual;
+        break;
+    }
+    }
+
+    // Zero, subnormal, infinite and NaN results (and the inputs leading to them) follow std::pow exactly.
+    if (!std::isnormal(result) || std::fabs(result) < kMinDoubleDoubleResult)
+    {
+        return std::pow(base, exponent);
+    }
+
+    return result;
+}
\ No newline at end of file
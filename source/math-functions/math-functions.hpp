@@ -0,0 +1,79 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <span>
+#include <cstdint>
+#include <string_view>
+
+#include <QStringView>
+
+// Built-in functions callable from expressions, e.g. "sin(x)" or "max(a, b)".
+// The converter uses the arity for validation, the evaluators and the compiler dispatch on the id.
+class MathFunctions
+{
+public:
+    enum class Id : std::uint8_t
+    {
+        Sin,
+        Cos,
+        Exp,
+        Log,
+        Sqrt,
+        Min,
+        Max,
+    };
+
+    struct Descriptor
+    {
+        std::u16string_view mName;
+        Id mId;
+        std::size_t mArity;
+    };
+
+    static constexpr std::size_t kMaxArity{ 2 };
+
+    // Every Id is below it, Max is the last one.
+    static constexpr std::size_t kFunctionCount{ static_cast<std::size_t>(Id::Max) + 1 };
+
+    // Integer exponents up to this magnitude are computed by squaring, larger ones by std::pow, 
+    // which is faster once the squaring needs more than three double-double steps.
+    static constexpr std::int32_t kMaxSquaringExponent{ 8 };
+
+public:
+    // nullptr for an unknown name.
+    [[nodiscard]] static const Descriptor* Find(QStringView name) noexcept;
+    [[nodiscard]] static const Descriptor& Get(Id id) noexcept;
+
+    // arguments.size() must be the arity of the function.
+    [[nodiscard]] static double Apply(Id id, std::span<const double> arguments) noexcept;
+
+    // output[i] = F(first[i]) or F(first[i], second[i]), second is ignored by unary functions.
+    static void ApplyBatch(Id id, std::span<const double> first, std::span<const double> second, std::span<double> output) noexcept;
+
+    // The ^ operator of every evaluator: integer exponents take IntegerPower, std::pow is kept for the rest.
+    [[nodiscard]] static double Power(double base, double exponent) noexcept;
+
+    // base^exponent within 1 ulp of std::pow, for |exponent| <= kMaxSquaringExponent.
+    [[nodiscard]] static double IntegerPower(double base, std::int32_t exponent) noexcept;
+};
\ No newline at end of file
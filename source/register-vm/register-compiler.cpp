@@ -0,0 +1,354 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "register-compiler.hpp"
+
+#include <algorithm>
+#include <limits>
+
+RegisterCompiler::RegisterCompiler() :
+    mTokenizer{}, mRPNConverter{}, mErrorMessage{}
+{ }
+
+RegisterProgram RegisterCompiler::Compile(const QString& expression)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+    mErrorMessage.clear();
+
+    mTokenizer.Init(expression);
+    mTokenizer.Run();
+
+    if (mTokenizer.HasError())
+    {
+        mErrorMessage = mTokenizer.GetErrorMessage();
+        return {};
+    }
+
+    const auto rpn_expression{ mRPNConverter.Convert(mTokenizer.GetTokens()) };
+    if (mRPNConverter.HasError())
+    {
+        mErrorMessage = mRPNConverter.GetErrorMessage();
+        return {};
+    }
+
+    return Compile(rpn_expression);
+}
+
+RegisterProgram RegisterCompiler::Compile(const std::vector<Tokenizer::TokenPair>& rpn_expression)
+{
+    mErrorMessage.clear();
+
+    RegisterProgram program{};
+    std::vector<VirtualInstruction> code{};
+    std::vector<Value> stack{};
+
+    std::uint32_t temporary_count{};
+    bool is_negative{ false };
+
+    auto Emit = [&code, &stack, &temporary_count](RegisterProgram::OpCode op_code, std::uint8_t function, Value first, Value second)
+    {
+        code.push_back({ op_code, function, temporary_count, first, second });
+        stack.push_back({ Value::Kind::Temporary, temporary_count++ });
+    };
+
+    for (const auto& [lexeme, token, value] : rpn_expression)
+    {
+        switch (token)
+        {
+        case Tokenizer::Token::Integer:
+        case Tokenizer::Token::FloatingPoint:
+        {
+            // The unary minus of a literal is folded into the constant.
+            program.mConstants.push_back(is_negative ? -value : value);
+            stack.push_back({ Value::Kind::Constant, static_cast<std::uint32_t>(std::size(program.mConstants) - 1) });
+
+            is_negative = false;
+            break;
+        }
+
+        case Tokenizer::Token::Identifier:
+        {
+            stack.push_back({ Value::Kind::Variable, ResolveSlot(program, lexeme) });
+            if (is_negative)
+            {
+                const auto variable{ stack.back() };
+                stack.pop_back();
+
+                Emit(RegisterProgram::OpCode::Negate, 0, variable, variable);
+            }
+
+            is_negative = false;
+            break;
+        }
+
+        case Tokenizer::Token::UnaryOperator:
+        {
+            is_negative = true;
+            break;
+        }
+
+        case Tokenizer::Token::Operator:
+        {
+            if (std::size(stack) < 2)
+            {
+                mErrorMessage = QStringLiteral("operator without operands");
+                return {};
+            }
+
+            auto op_code{ RegisterProgram::OpCode::Add };
+            if (lexeme == QStringLiteral("-"))      { op_code = RegisterProgram::OpCode::Subtract; }
+            else if (lexeme == QStringLiteral("*")) { op_code = RegisterProgram::OpCode::Multiply; }
+            else if (lexeme == QStringLiteral("/")) { op_code = RegisterProgram::OpCode::Divide; }
+            else if (lexeme == QStringLiteral("^")) { op_code = RegisterProgram::OpCode::Power; }
+
+            const auto second{ stack.back() };
+            stack.pop_back();
+
+            const auto first{ stack.back() };
+            stack.pop_back();
+
+            Emit(op_code, 0, first, second);
+            break;
+        }
+
+        case Tokenizer::Token::Function:
+        {
+            const auto* descriptor{ MathFunctions::Find(lexeme) };
+            if (descriptor == nullptr)
+            {
+                mErrorMessage = QStringLiteral("unknown function: %1").arg(lexeme);
+                return {};
+            }
+
+            if (std::size(stack) < descriptor->mArity)
+            {
+                mErrorMessage = QStringLiteral("function without enough arguments");
+                return {};
+            }
+
+            const auto second{ stack.back() };
+            const auto first{ *(std::end(stack) - static_cast<std::ptrdiff_t>(descriptor->mArity)) };
+            stack.resize(std::size(stack) - descriptor->mArity);
+
+            Emit(RegisterProgram::OpCode::Call, static_cast<std::uint8_t>(descriptor->mId), first, second);
+
+            // A unary minus right before the call belongs to its result.
+            if (is_negative)
+            {
+                const auto result{ stack.back() };
+                stack.pop_back();
+
+                Emit(RegisterProgram::OpCode::Negate, 0, result, result);
+            }
+
+            is_negative = false;
+            break;
+        }
+
+        default:
+        {
+            mErrorMessage = QStringLiteral("parenthesis in RPN expression");
+            return {};
+        }
+        }
+    }
+
+    if (std::size(stack) != 1)
+    {
+        mErrorMessage = QStringLiteral("expression does not reduce to a single value");
+        return {};
+    }
+
+    // A lone constant or variable still needs a register to return.
+    if (stack.back().mKind != Value::Kind::Temporary)
+    {
+        const auto result{ stack.back() };
+        stack.pop_back();
+
+        Emit(RegisterProgram::OpCode::Move, 0, result, result);
+    }
+
+    const auto locations{ AllocateRegisters(code, temporary_count, std::size(code)) };
+
+    std::uint32_t spill_slot_end{};
+    for (const auto location : locations)
+    {
+        program.mUsedRegisterCount = std::max<std::size_t>(program.mUsedRegisterCount, std::min<std::size_t>(location + 1, RegisterProgram::kRegisterCount));
+        spill_slot_end = std::max(spill_slot_end, location + 1);
+    }
+
+    program.mSpillSlotCount = spill_slot_end > RegisterProgram::kRegisterCount ? spill_slot_end - RegisterProgram::kRegisterCount : 0;
+    program.mConstantsBegin = program.mUsedRegisterCount + program.mSpillSlotCount;
+    program.mVariablesBegin = program.mConstantsBegin + std::size(program.mConstants);
+    program.mFrameSize = program.mVariablesBegin + std::size(program.mVariables);
+
+    if (program.mFrameSize > std::numeric_limits<std::uint16_t>::max())
+    {
+        mErrorMessage = QStringLiteral("expression is too large");
+        return {};
+    }
+
+    auto FrameIndex = [&program, &locations](Value value) -> std::uint16_t
+    {
+        switch (value.mKind)
+        {
+        case Value::Kind::Constant: return static_cast<std::uint16_t>(program.mConstantsBegin + value.mIndex);
+        case Value::Kind::Variable: return static_cast<std::uint16_t>(program.mVariablesBegin + value.mIndex);
+        case Value::Kind::Temporary: return static_cast<std::uint16_t>(locations[value.mIndex]);
+        }
+
+        return 0;
+    };
+
+    program.mInstructions.reserve(std::size(code));
+    for (const auto& [op_code, function, destination, first, second] : code)
+    {
+        program.mInstructions.push_back({ op_code, function, static_cast<std::uint16_t>(locations[destination]), FrameIndex(first), FrameIndex(second) });
+    }
+
+    program.mResult = program.mInstructions.back().mDestination;
+    return program;
+}
+
+bool RegisterCompiler::HasError() const noexcept
+{
+    return !mErrorMessage.isEmpty();
+}
+
+const QString& RegisterCompiler::GetErrorMessage() const noexcept
+{
+    return mErrorMessage;
+}
+
+std::vector<std::uint32_t> RegisterCompiler::AllocateRegisters(const std::vector<VirtualInstruction>& code, std::size_t temporary_count, std::size_t result_end)
+{
+    // Temporaries are numbered in definition order, so temporary t starts at the instruction defining it.
+    std::vector<std::size_t> starts(temporary_count);
+    std::vector<std::size_t> ends(temporary_count, result_end);
+
+    for (std::size_t i{}; i < std::size(code); ++i)
+    {
+        const auto& instruction{ code[i] };
+        starts[instruction.mDestination] = i;
+
+        for (const auto& operand : { instruction.mFirst, instruction.mSecond })
+        {
+            if (operand.mKind == Value::Kind::Temporary)
+            {
+                ends[operand.mIndex] = i;
+            }
+        }
+    }
+
+    std::vector<std::uint32_t> locations(temporary_count);
+
+    // Live intervals sorted by end, one list for registers and one for spill slots.
+    std::vector<std::uint32_t> active{};
+    std::vector<std::uint32_t> spilled{};
+
+    std::vector<std::uint32_t> free_registers{};
+    std::vector<std::uint32_t> free_spill_slots{};
+    std::uint32_t spill_slot_count{};
+
+    for (auto reg{ static_cast<std::uint32_t>(RegisterProgram::kRegisterCount) }; reg > 0; --reg)
+    {
+        free_registers.push_back(reg - 1);
+    }
+
+    auto InsertByEnd = [&ends](std::vector<std::uint32_t>& intervals, std::uint32_t temporary)
+    {
+        const auto position{ std::upper_bound(std::begin(intervals), std::end(intervals), temporary, 
+            [&ends](std::uint32_t lhs, std::uint32_t rhs) { return ends[lhs] < ends[rhs]; }) };
+        intervals.insert(position, temporary);
+    };
+
+    auto NewSpillSlot = [&free_spill_slots, &spill_slot_count]() -> std::uint32_t
+    {
+        if (!std::empty(free_spill_slots))
+        {
+            const auto slot{ free_spill_slots.back() };
+            free_spill_slots.pop_back();
+            return slot;
+        }
+
+        return static_cast<std::uint32_t>(RegisterProgram::kRegisterCount) + spill_slot_count++;
+    };
+
+    for (std::uint32_t temporary{}; temporary < temporary_count; ++temporary)
+    {
+        // An operand whose last use is this instruction can share its location with the result,
+        // the interpreter reads both operands before writing the destination.
+        auto Expire = [&](std::vector<std::uint32_t>& intervals, std::vector<std::uint32_t>& free_locations)
+        {
+            auto expired{ std::begin(intervals) };
+            while (expired != std::end(intervals) && ends[*expired] <= starts[temporary])
+            {
+                free_locations.push_back(locations[*expired]);
+                ++expired;
+            }
+
+            intervals.erase(std::begin(intervals), expired);
+        };
+
+        Expire(active, free_registers);
+        Expire(spilled, free_spill_slots);
+
+        if (!std::empty(free_registers))
+        {
+            locations[temporary] = free_registers.back();
+            free_registers.pop_back();
+
+            InsertByEnd(active, temporary);
+            continue;
+        }
+
+        // No register left: the interval ending last goes to memory, as in Poletto and Sarkar.
+        const auto furthest{ active.back() };
+        if (ends[furthest] > ends[temporary])
+        {
+            locations[temporary] = locations[furthest];
+            locations[furthest] = NewSpillSlot();
+
+            active.pop_back();
+            InsertByEnd(active, temporary);
+            InsertByEnd(spilled, furthest);
+        }
+        else
+        {
+            locations[temporary] = NewSpillSlot();
+            InsertByEnd(spilled, temporary);
+        }
+    }
+
+    return locations;
+}
+
+std::uint32_t RegisterCompiler::ResolveSlot(RegisterProgram& program, const QString& name)
+{
+    if (const auto slot{ program.GetSlot(name) })
+    {
+        return *slot;
+    }
+
+    program.mVariables.push_back(name);
+    return static_cast<std::uint32_t>(std::size(program.mVariables) - 1);
+}
\ No newline at end of file
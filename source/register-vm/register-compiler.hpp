@@ -0,0 +1,89 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Compiles the RPN produced by RPNConverter into a RegisterProgram:
+    the operand stack is simulated at compile time, every intermediate result becomes 
+    a temporary, and temporaries are assigned to registers by linear scan over their live ranges.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <QString>
+
+#include <tokenizer.hpp>
+#include <rpn-converter.hpp>
+
+#include "register-program.hpp"
+
+class RegisterCompiler
+{
+public:
+    RegisterCompiler();
+    ~RegisterCompiler() noexcept = default;
+
+    [[nodiscard]] RegisterProgram Compile(const QString& expression);
+    [[nodiscard]] RegisterProgram Compile(const std::vector<Tokenizer::TokenPair>& rpn_expression);
+
+    [[nodiscard]] bool HasError() const noexcept;
+    [[nodiscard]] const QString& GetErrorMessage() const noexcept;
+
+private:
+    // An operand before allocation.
+    struct Value
+    {
+        enum class Kind : std::uint8_t
+        {
+            Constant,
+            Variable,
+            Temporary
+        };
+
+        Kind mKind;
+        std::uint32_t mIndex;
+    };
+
+    struct VirtualInstruction
+    {
+        RegisterProgram::OpCode mOpCode;
+        std::uint8_t mFunction;
+
+        std::uint32_t mDestination;
+        Value mFirst;
+        Value mSecond;
+    };
+
+private:
+    // Location of every temporary: a register below kRegisterCount, a spill slot above.
+    [[nodiscard]] static std::vector<std::uint32_t> AllocateRegisters(const std::vector<VirtualInstruction>& code, std::size_t temporary_count, std::size_t result_end);
+
+    [[nodiscard]] static std::uint32_t ResolveSlot(RegisterProgram& program, const QString& name);
+
+private:
+    Tokenizer mTokenizer;
+    RPNConverter mRPNConverter;
+
+    QString mErrorMessage;
+};
\ No newline at end of file
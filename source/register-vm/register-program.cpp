@@ -0,0 +1,101 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "register-program.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+RegisterProgram::RegisterProgram() :
+    mInstructions{}, mConstants{}, mVariables{}, mUsedRegisterCount{}, mSpillSlotCount{}, 
+    mConstantsBegin{}, mVariablesBegin{}, mFrameSize{}, mResult{}
+{ }
+
+double RegisterProgram::Evaluate(std::span<const double> bindings) const
+{
+    if (std::empty(mInstructions) || std::size(bindings) < std::size(mVariables))
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    std::array<double, kInlineFrameSize> inline_frame;
+    std::vector<double> heap_frame{};
+
+    if (mFrameSize > kInlineFrameSize)
+    {
+        heap_frame.resize(mFrameSize);
+    }
+
+    auto* frame{ mFrameSize > kInlineFrameSize ? std::data(heap_frame) : std::data(inline_frame) };
+
+    std::copy(std::begin(mConstants), std::end(mConstants), frame + mConstantsBegin);
+    std::copy_n(std::begin(bindings), std::size(mVariables), frame + mVariablesBegin);
+
+    for (const auto& [op_code, function, destination, first, second] : mInstructions)
+    {
+        switch (op_code)
+        {
+        case OpCode::Move:     frame[destination] = frame[first]; break;
+        case OpCode::Negate:   frame[destination] = -frame[first]; break;
+        case OpCode::Add:      frame[destination] = frame[first] + frame[second]; break;
+        case OpCode::Subtract: frame[destination] = frame[first] - frame[second]; break;
+        case OpCode::Multiply: frame[destination] = frame[first] * frame[second]; break;
+        case OpCode::Divide:   frame[destination] = frame[first] / frame[second]; break;
+        case OpCode::Power:    frame[destination] = MathFunctions::Power(frame[first], frame[second]); break;
+
+        case OpCode::Call:
+        {
+            const auto id{ static_cast<MathFunctions::Id>(function) };
+            const std::array<double, MathFunctions::kMaxArity> arguments{ frame[first], frame[second] };
+
+            frame[destination] = MathFunctions::Apply(id, std::span{ arguments }.first(MathFunctions::Get(id).mArity));
+            break;
+        }
+        }
+    }
+
+    return frame[mResult];
+}
+
+std::optional<std::uint32_t> RegisterProgram::GetSlot(QStringView name) const noexcept
+{
+    for (std::size_t slot{}; slot < std::size(mVariables); ++slot)
+    {
+        if (mVariables[slot] == name)
+        {
+            return static_cast<std::uint32_t>(slot);
+        }
+    }
+
+    return std::nullopt;
+}
+
+const std::vector<QString>& RegisterProgram::GetVariables() const noexcept { return mVariables; }
+const std::vector<RegisterProgram::Instruction>& RegisterProgram::GetInstructions() const noexcept { return mInstructions; }
+const std::vector<double>& RegisterProgram::GetConstants() const noexcept { return mConstants; }
+
+std::size_t RegisterProgram::GetUsedRegisterCount() const noexcept { return mUsedRegisterCount; }
+std::size_t RegisterProgram::GetSpillSlotCount() const noexcept { return mSpillSlotCount; }
+
+bool RegisterProgram::IsEmpty() const noexcept { return std::empty(mInstructions); }
\ No newline at end of file
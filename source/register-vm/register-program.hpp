@@ -0,0 +1,115 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Three-address form of an expression. Every operand is an index into one frame:
+
+        [ registers | spill slots | constants | variables ]
+
+    Temporaries are mapped onto the fixed register file by linear scan, the ones which 
+    do not fit go to spill slots. An operator reads its operands and writes its result 
+    in place, so it costs one instruction instead of the two pushes and pop of a stack machine.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <QString>
+#include <QStringView>
+
+#include <math-functions.hpp>
+
+class RegisterProgram
+{
+public:
+    enum class OpCode : std::uint8_t
+    {
+        Move,
+        Negate,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Power,
+        Call
+    };
+
+    struct Instruction
+    {
+        OpCode mOpCode;
+
+        // MathFunctions::Id for Call, unused otherwise.
+        std::uint8_t mFunction;
+
+        std::uint16_t mDestination;
+        std::uint16_t mFirst;
+
+        // Unused by Move, Negate and unary calls.
+        std::uint16_t mSecond;
+    };
+
+    static constexpr std::size_t kRegisterCount{ 16 };
+
+public:
+    RegisterProgram();
+    ~RegisterProgram() noexcept = default;
+
+    // bindings[slot] is the value of GetVariables()[slot], NaN if there are fewer bindings than variables.
+    [[nodiscard]] double Evaluate(std::span<const double> bindings) const;
+
+    [[nodiscard]] std::optional<std::uint32_t> GetSlot(QStringView name) const noexcept;
+
+    [[nodiscard]] const std::vector<QString>& GetVariables() const noexcept;
+    [[nodiscard]] const std::vector<Instruction>& GetInstructions() const noexcept;
+    [[nodiscard]] const std::vector<double>& GetConstants() const noexcept;
+
+    // Registers actually used, at most kRegisterCount.
+    [[nodiscard]] std::size_t GetUsedRegisterCount() const noexcept;
+    [[nodiscard]] std::size_t GetSpillSlotCount() const noexcept;
+
+    [[nodiscard]] bool IsEmpty() const noexcept;
+
+private:
+    friend class RegisterCompiler;
+
+    // Frames up to this size live on the machine stack.
+    static constexpr std::size_t kInlineFrameSize{ 128 };
+
+private:
+    std::vector<Instruction> mInstructions;
+    std::vector<double> mConstants;
+    std::vector<QString> mVariables;
+
+    std::size_t mUsedRegisterCount;
+    std::size_t mSpillSlotCount;
+
+    // Frame layout, see above.
+    std::size_t mConstantsBegin;
+    std::size_t mVariablesBegin;
+    std::size_t mFrameSize;
+
+    std::uint16_t mResult;
+};
\ No newline at end of file
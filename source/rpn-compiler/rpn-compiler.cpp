@@ -0,0 +1,595 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rpn-compiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <rpn-reassociator.hpp>
+
+RPNCompiler::RPNCompiler() :
+    mTokenizer{}, mRPNConverter{}, mIsReassociating{ false }, mIsContracting{ false }, mErrorMessage{}
+{ }
+
+RPNProgram RPNCompiler::Compile(const QString& expression)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+    mErrorMessage.clear();
+
+    mTokenizer.Init(expression);
+    mTokenizer.Run();
+
+    if (mTokenizer.HasError())
+    {
+        mErrorMessage = mTokenizer.GetErrorMessage();
+        return {};
+    }
+
+    const auto rpn_expression{ mRPNConverter.Convert(mTokenizer.GetTokens()) };
+    if (mRPNConverter.HasError())
+    {
+        mErrorMessage = mRPNConverter.GetErrorMessage();
+        return {};
+    }
+
+    return Compile(rpn_expression);
+}
+
+RPNProgram RPNCompiler::Compile(const std::vector<Tokenizer::TokenPair>& rpn_expression)
+{
+    mErrorMessage.clear();
+
+    if (mIsReassociating)
+    {
+        // Flat chains compile to runs of Add / Multiply, each run then becomes one reduction. 
+        // A malformed expression comes back unchanged and fails the checks below.
+        return Compile(RPNReassociator::Reassociate(rpn_expression, RPNReassociator::Shape::Flat), true);
+    }
+
+    return Compile(rpn_expression, false);
+}
+
+RPNProgram RPNCompiler::Compile(const std::vector<Tokenizer::TokenPair>& rpn_expression, bool reduce_runs)
+{
+    RPNProgram program{};
+    program.mInstructions.reserve(std::size(rpn_expression));
+
+    std::size_t depth{};
+    bool is_negative{ false };
+
+    for (const auto& [lexeme, token, value] : rpn_expression)
+    {
+        switch (token)
+        {
+        case Tokenizer::Token::Integer:
+        case Tokenizer::Token::FloatingPoint:
+        {
+            // The unary minus of a literal is folded into the constant.
+            program.mConstants.push_back(is_negative ? -value : value);
+            program.mInstructions.push_back({ RPNProgram::OpCode::PushConstant, static_cast<std::uint32_t>(std::size(program.mConstants) - 1) });
+
+            is_negative = false;
+            ++depth;
+            break;
+        }
+
+        case Tokenizer::Token::Identifier:
+        {
+            program.mInstructions.push_back({ RPNProgram::OpCode::PushVariable, ResolveSlot(program, lexeme) });
+            if (is_negative)
+            {
+                program.mInstructions.push_back({ RPNProgram::OpCode::Negate, 0 });
+            }
+
+            is_negative = false;
+            ++depth;
+            break;
+        }
+
+        case Tokenizer::Token::UnaryOperator:
+        {
+            is_negative = true;
+            break;
+        }
+
+        case Tokenizer::Token::Operator:
+        {
+            if (depth < 2)
+            {
+                mErrorMessage = QStringLiteral("operator without operands");
+                return {};
+            }
+
+            auto op_code{ RPNProgram::OpCode::Add };
+            if (lexeme == QStringLiteral("-"))      { op_code = RPNProgram::OpCode::Subtract; }
+            else if (lexeme == QStringLiteral("*")) { op_code = RPNProgram::OpCode::Multiply; }
+            else if (lexeme == QStringLiteral("/")) { op_code = RPNProgram::OpCode::Divide; }
+            else if (lexeme == QStringLiteral("^")) { op_code = RPNProgram::OpCode::Power; }
+
+            program.mInstructions.push_back({ op_code, 0 });
+            --depth;
+            break;
+        }
+
+        case Tokenizer::Token::Function:
+        {
+            const auto* descriptor{ MathFunctions::Find(lexeme) };
+            if (descriptor == nullptr)
+            {
+                mErrorMessage = QStringLiteral("unknown function: %1").arg(lexeme);
+                return {};
+            }
+
+            if (depth < descriptor->mArity)
+            {
+                mErrorMessage = QStringLiteral("function without enough arguments");
+                return {};
+            }
+
+            // A unary minus right before the call belongs to its result.
+            program.mInstructions.push_back({ RPNProgram::OpCode::Call, static_cast<std::uint32_t>(descriptor->mId) });
+            if (is_negative)
+            {
+                program.mInstructions.push_back({ RPNProgram::OpCode::Negate, 0 });
+            }
+
+            is_negative = false;
+            depth -= descriptor->mArity - 1;
+            break;
+        }
+
+        default:
+        {
+            mErrorMessage = QStringLiteral("parenthesis in RPN expression");
+            return {};
+        }
+        }
+
+        program.mMaxStackDepth = std::max(program.mMaxStackDepth, depth);
+    }
+
+    if (depth != 1)
+    {
+        mErrorMessage = QStringLiteral("expression does not reduce to a single value");
+        return {};
+    }
+
+    if (mIsContracting)
+    {
+        ContractPolynomials(program);
+    }
+
+    if (reduce_runs)
+    {
+        ReduceRuns(program.mInstructions);
+    }
+
+    Fuse(program);
+    program.mInstructions.push_back({ RPNProgram::OpCode::Return, 0 });
+
+    return program;
+}
+
+void RPNCompiler::SetReassociation(bool is_enabled) noexcept
+{
+    mIsReassociating = is_enabled;
+}
+
+bool RPNCompiler::IsReassociating() const noexcept
+{
+    return mIsReassociating;
+}
+
+void RPNCompiler::SetContraction(bool is_enabled) noexcept
+{
+    mIsContracting = is_enabled;
+}
+
+bool RPNCompiler::IsContracting() const noexcept
+{
+    return mIsContracting;
+}
+
+bool RPNCompiler::HasError() const noexcept
+{
+    return !mErrorMessage.isEmpty();
+}
+
+const QString& RPNCompiler::GetErrorMessage() const noexcept
+{
+    return mErrorMessage;
+}
+
+std::uint32_t RPNCompiler::ResolveSlot(RPNProgram& program, const QString& name)
+{
+    if (const auto slot{ program.GetSlot(name) })
+    {
+        return *slot;
+    }
+
+    program.mVariables.push_back(name);
+    return static_cast<std::uint32_t>(std::size(program.mVariables) - 1);
+}
+
+void RPNCompiler::ContractPolynomials(RPNProgram& program)
+{
+    using OpCode = RPNProgram::OpCode;
+
+    static constexpr std::uint32_t kNoVariable{ UINT32_MAX };
+
+    // A value of the symbolic stack, its code runs from mBegin up to the mBegin of the value above it.
+    // While it is a polynomial, mCoefficients are from the lowest degree, in the variable mSlot 
+    // (kNoVariable for a constant), and mOperatorCount operators were written to compute it.
+    struct Value
+    {
+        std::size_t mBegin;
+        bool mIsPolynomial;
+        std::uint32_t mSlot;
+        std::vector<double> mCoefficients;
+        std::size_t mOperatorCount;
+    };
+
+    auto IsMonomial = [](const Value& value)
+    {
+        return std::count_if(std::begin(value.mCoefficients), std::end(value.mCoefficients), [](double c) { return c != 0.0; }) <= 1;
+    };
+
+    auto IsConstant = [](const Value& value)
+    {
+        return std::size(value.mCoefficients) == 1;
+    };
+
+    // Two instructions replace the code, below three operators the fused code is as short.
+    auto IsWorthContracting = [](const Value& value)
+    {
+        return value.mIsPolynomial && value.mSlot != kNoVariable && value.mOperatorCount >= 3;
+    };
+
+    // Only sums of monomials are built: multiplying two sums out would trade the rounding of the 
+    // written form for cancellation between the expanded coefficients.
+    auto Combine = [&](OpCode op_code, Value& first, const Value& second) -> bool
+    {
+        if (!first.mIsPolynomial || !second.mIsPolynomial || 
+            (first.mSlot != second.mSlot && first.mSlot != kNoVariable && second.mSlot != kNoVariable))
+        {
+            return false;
+        }
+
+        auto& coefficients{ first.mCoefficients };
+        const auto& other{ second.mCoefficients };
+
+        switch (op_code)
+        {
+        case OpCode::Add:
+        case OpCode::Subtract:
+        {
+            const auto sign{ op_code == OpCode::Add ? 1.0 : -1.0 };
+
+            coefficients.resize(std::max(std::size(coefficients), std::size(other)));
+            for (std::size_t i{}; i < std::size(other); ++i) { coefficients[i] += sign * other[i]; }
+            break;
+        }
+
+        case OpCode::Multiply:
+        {
+            const auto degree{ std::size(coefficients) + std::size(other) - 2 };
+            if ((!IsMonomial(first) && !IsMonomial(second)) || degree > kMaxPolynomialDegree)
+            {
+                return false;
+            }
+
+            std::vector<double> product(degree + 1);
+            for (std::size_t i{}; i < std::size(coefficients); ++i)
+            {
+                for (std::size_t j{}; j < std::size(other); ++j) { product[i + j] += coefficients[i] * other[j]; }
+            }
+
+            coefficients = std::move(product);
+            break;
+        }
+
+        case OpCode::Divide:
+        {
+            if (!IsConstant(second) || other.front() == 0.0)
+            {
+                return false;
+            }
+
+            for (auto& c : coefficients) { c /= other.front(); }
+            break;
+        }
+
+        case OpCode::Power:
+        {
+            const auto exponent{ other.front() };
+            if (!IsConstant(second) || !IsMonomial(first) || !(exponent >= 0.0 && exponent <= kMaxPolynomialDegree) || exponent != std::trunc(exponent))
+            {
+                return false;
+            }
+
+            const auto degree{ (std::size(coefficients) - 1) * static_cast<std::size_t>(exponent) };
+            if (degree > kMaxPolynomialDegree)
+            {
+                return false;
+            }
+
+            std::vector<double> power(degree + 1);
+            power.back() = std::pow(coefficients.back(), exponent);
+
+            coefficients = std::move(power);
+            break;
+        }
+
+        default:
+            return false;
+        }
+
+        // x^3-x^3 has no x^3 term left.
+        while (std::size(coefficients) > 1 && coefficients.back() == 0.0) { coefficients.pop_back(); }
+
+        first.mSlot = first.mSlot != kNoVariable ? first.mSlot : second.mSlot;
+        first.mOperatorCount += second.mOperatorCount + 1;
+        return true;
+    };
+
+    const auto& instructions{ program.mInstructions };
+    auto& constants{ program.mConstants };
+
+    std::vector<RPNProgram::Instruction> contracted{};
+    contracted.reserve(std::size(instructions));
+
+    std::vector<Value> values{};
+
+    // The top count values are used by an operation which is not part of a polynomial, 
+    // so the code of those worth it is replaced by PushVariable, Horner.
+    auto Settle = [&](std::size_t count)
+    {
+        const auto first{ std::size(values) - count };
+        if (std::none_of(std::begin(values) + static_cast<std::ptrdiff_t>(first), std::end(values), IsWorthContracting))
+        {
+            return;
+        }
+
+        const auto begin{ values[first].mBegin };
+        const std::vector tail(std::begin(contracted) + static_cast<std::ptrdiff_t>(begin), std::end(contracted));
+        contracted.resize(begin);
+
+        for (auto i{ first }; i < std::size(values); ++i)
+        {
+            const auto code_begin{ values[i].mBegin - begin };
+            const auto code_end{ i + 1 < std::size(values) ? values[i + 1].mBegin - begin : std::size(tail) };
+
+            values[i].mBegin = std::size(contracted);
+
+            if (!IsWorthContracting(values[i]))
+            {
+                contracted.insert(std::end(contracted), std::begin(tail) + static_cast<std::ptrdiff_t>(code_begin), std::begin(tail) + static_cast<std::ptrdiff_t>(code_end));
+                continue;
+            }
+
+            const auto& coefficients{ values[i].mCoefficients };
+            const auto index{ static_cast<std::uint32_t>(std::size(constants)) };
+
+            constants.push_back(static_cast<double>(std::size(coefficients) - 1));
+            constants.insert(std::end(constants), std::rbegin(coefficients), std::rend(coefficients));
+
+            contracted.push_back({ OpCode::PushVariable, values[i].mSlot });
+            contracted.push_back({ OpCode::Horner, index });
+        }
+    };
+
+    for (const auto& instruction : instructions)
+    {
+        switch (instruction.mOpCode)
+        {
+        case OpCode::PushConstant:
+        {
+            values.push_back({ std::size(contracted), true, kNoVariable, { constants[instruction.mOperand] }, 0 });
+            break;
+        }
+
+        case OpCode::PushVariable:
+        {
+            values.push_back({ std::size(contracted), true, instruction.mOperand, { 0.0, 1.0 }, 0 });
+            break;
+        }
+
+        case OpCode::Negate:
+        {
+            auto& value{ values.back() };
+            for (auto& c : value.mCoefficients) { c = -c; }
+
+            ++value.mOperatorCount;
+            break;
+        }
+
+        case OpCode::Add:
+        case OpCode::Subtract:
+        case OpCode::Multiply:
+        case OpCode::Divide:
+        case OpCode::Power:
+        {
+            auto& first{ values[std::size(values) - 2] };
+            if (!Combine(instruction.mOpCode, first, values.back()))
+            {
+                Settle(2);
+                first.mIsPolynomial = false;
+            }
+
+            values.pop_back();
+            break;
+        }
+
+        default:
+        {
+            const auto arity{ MathFunctions::Get(static_cast<MathFunctions::Id>(instruction.mOperand)).mArity };
+
+            Settle(arity);
+            values.resize(std::size(values) - arity + 1);
+            values.back().mIsPolynomial = false;
+            break;
+        }
+        }
+
+        contracted.push_back(instruction);
+    }
+
+    Settle(1);
+    program.mInstructions = std::move(contracted);
+
+    // The terms of a contracted polynomial no longer wait on the stack.
+    std::size_t depth{};
+    program.mMaxStackDepth = 0;
+
+    for (const auto& [op_code, operand] : program.mInstructions)
+    {
+        switch (op_code)
+        {
+        case OpCode::PushConstant:
+        case OpCode::PushVariable:
+            ++depth;
+            break;
+
+        case OpCode::Negate:
+        case OpCode::Horner:
+            break;
+
+        case OpCode::Call:
+            depth -= MathFunctions::Get(static_cast<MathFunctions::Id>(operand)).mArity - 1;
+            break;
+
+        default:
+            --depth;
+            break;
+        }
+
+        program.mMaxStackDepth = std::max(program.mMaxStackDepth, depth);
+    }
+}
+
+void RPNCompiler::Fuse(RPNProgram& program)
+{
+    using OpCode = RPNProgram::OpCode;
+
+    // Constant integer exponents become multiply chains or squaring instead of std::pow.
+    auto FusePower = [&constants = program.mConstants](RPNProgram::Instruction& power_constant)
+    {
+        const auto exponent{ constants[power_constant.mOperand] };
+
+        if (exponent == 2.0)
+        {
+            power_constant = { OpCode::Square, 0 };
+        }
+        else if (std::fabs(exponent) <= MathFunctions::kMaxSquaringExponent && exponent == std::trunc(exponent))
+        {
+            power_constant = { OpCode::PowerInteger, static_cast<std::uint32_t>(static_cast<std::int32_t>(exponent)) };
+        }
+    };
+
+    // Rewrites a pair of adjacent instructions into one superinstruction, false if the pair does not fuse.
+    auto FusePair = [&FusePower](RPNProgram::Instruction& first, const RPNProgram::Instruction& second) -> bool
+    {
+        if (first.mOpCode == OpCode::PushConstant)
+        {
+            switch (second.mOpCode)
+            {
+            case OpCode::Add:      first.mOpCode = OpCode::AddConstant;      return true;
+            case OpCode::Subtract: first.mOpCode = OpCode::SubtractConstant; return true;
+            case OpCode::Multiply: first.mOpCode = OpCode::MultiplyConstant; return true;
+            case OpCode::Divide:   first.mOpCode = OpCode::DivideConstant;   return true;
+            case OpCode::Power:    first.mOpCode = OpCode::PowerConstant; FusePower(first); return true;
+            default:               return false;
+            }
+        }
+
+        if (first.mOpCode == OpCode::PushVariable && second.mOpCode == OpCode::Negate)
+        {
+            first.mOpCode = OpCode::PushNegatedVariable;
+            return true;
+        }
+
+        if (first.mOpCode == OpCode::Multiply && second.mOpCode == OpCode::Add)
+        {
+            first.mOpCode = OpCode::MultiplyAdd;
+            return true;
+        }
+
+        if (first.mOpCode == OpCode::Multiply && second.mOpCode == OpCode::AddConstant)
+        {
+            first = { OpCode::MultiplyAddConstant, second.mOperand };
+            return true;
+        }
+
+        return false;
+    };
+
+    auto& instructions{ program.mInstructions };
+
+    std::vector<RPNProgram::Instruction> fused{};
+    fused.reserve(std::size(instructions) + 1);
+
+    for (const auto& instruction : instructions)
+    {
+        fused.push_back(instruction);
+
+        // A fused pair can fuse again with the instruction before it (Multiply, PushConstant, Add).
+        while (std::size(fused) >= 2 && FusePair(fused[std::size(fused) - 2], fused.back()))
+        {
+            fused.pop_back();
+        }
+    }
+
+    instructions = std::move(fused);
+}
+
+void RPNCompiler::ReduceRuns(std::vector<RPNProgram::Instruction>& instructions)
+{
+    using OpCode = RPNProgram::OpCode;
+
+    std::vector<RPNProgram::Instruction> reduced{};
+    reduced.reserve(std::size(instructions));
+
+    for (std::size_t i{}; i < std::size(instructions);)
+    {
+        const auto op_code{ instructions[i].mOpCode };
+
+        auto run_end{ i + 1 };
+        while (run_end < std::size(instructions) && instructions[run_end].mOpCode == op_code) { ++run_end; }
+
+        // k operators in a row combine the top k + 1 values, a single one stays a plain operator.
+        const auto run_length{ run_end - i };
+
+        if (run_length >= 2 && (op_code == OpCode::Add || op_code == OpCode::Multiply))
+        {
+            reduced.push_back({ op_code == OpCode::Add ? OpCode::Sum : OpCode::Product, static_cast<std::uint32_t>(run_length + 1) });
+        }
+        else
+        {
+            reduced.insert(std::end(reduced), std::begin(instructions) + static_cast<std::ptrdiff_t>(i), std::begin(instructions) + static_cast<std::ptrdiff_t>(run_end));
+        }
+
+        i = run_end;
+    }
+
+    instructions = std::move(reduced);
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Turns an expression into an RPNProgram once, the program can then be evaluated 
+    with different variable bindings without tokenizing or converting again.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include <QString>
+
+#include <tokenizer.hpp>
+#include <rpn-converter.hpp>
+
+#include "rpn-program.hpp"
+
+class RPNCompiler
+{
+public:
+    RPNCompiler();
+    ~RPNCompiler() noexcept = default;
+
+    [[nodiscard]] RPNProgram Compile(const QString& expression);
+    [[nodiscard]] RPNProgram Compile(const std::vector<Tokenizer::TokenPair>& rpn_expression);
+
+    // Off by default. Chains of + and * are reduced pairwise (see RPNReassociator), which changes the rounding.
+    void SetReassociation(bool is_enabled) noexcept;
+    [[nodiscard]] bool IsReassociating() const noexcept;
+
+    // Off by default. Sums of monomials in one variable, e.g. 3*x^3+2*x^2+5*x+1, are evaluated as one 
+    // Horner instruction with fused multiply-adds, which rounds differently and folds like terms.
+    void SetContraction(bool is_enabled) noexcept;
+    [[nodiscard]] bool IsContracting() const noexcept;
+
+    [[nodiscard]] bool HasError() const noexcept;
+    [[nodiscard]] const QString& GetErrorMessage() const noexcept;
+
+private:
+    // Higher powers are left to PowerConstant, the coefficients of x^k + 1 would hold k mostly zero constants.
+    static constexpr std::size_t kMaxPolynomialDegree{ 32 };
+
+private:
+    [[nodiscard]] RPNProgram Compile(const std::vector<Tokenizer::TokenPair>& rpn_expression, bool reduce_runs);
+
+    [[nodiscard]] static std::uint32_t ResolveSlot(RPNProgram& program, const QString& name);
+
+    // Runs of Add / Multiply in a flat reassociated program become Sum / Product.
+    static void ReduceRuns(std::vector<RPNProgram::Instruction>& instructions);
+
+    // Rewrites polynomial subtrees of the unfused program into Horner instructions.
+    static void ContractPolynomials(RPNProgram& program);
+
+    // Peephole pass replacing the most frequent instruction pairs with the superinstructions of RPNProgram.
+    static void Fuse(RPNProgram& program);
+
+private:
+    Tokenizer mTokenizer;
+    RPNConverter mRPNConverter;
+
+    bool mIsReassociating;
+    bool mIsContracting;
+    QString mErrorMessage;
+};
\ No newline at end of file
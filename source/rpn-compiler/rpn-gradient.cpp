@@ -0,0 +1,351 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rpn-gradient.hpp"
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include <vector-math.hpp>
+
+RPNGradient::RPNGradient() :
+    mStack{}, mEdges{}, mEdgesBegins{}, mAdjoints{}, mValues{}, mPartials{}
+{ }
+
+double RPNGradient::Evaluate(const RPNProgram& program, std::span<const double> bindings, std::span<double> gradient)
+{
+    using OpCode = RPNProgram::OpCode;
+
+    const auto variables{ std::size(program.GetVariables()) };
+    if (program.IsEmpty() || std::size(bindings) < variables || std::size(gradient) < variables)
+    {
+        std::fill(std::begin(gradient), std::end(gradient), std::numeric_limits<double>::quiet_NaN());
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    const auto& constants{ program.GetConstants() };
+
+    mStack.clear();
+    mEdges.clear();
+    mEdgesBegins.assign(variables + 1, 0);
+
+    for (const auto& [op_code, operand] : program.GetInstructions())
+    {
+        switch (op_code)
+        {
+        case OpCode::PushConstant:
+        {
+            mStack.push_back({ constants[operand], kConstant });
+            break;
+        }
+
+        case OpCode::PushVariable:
+        {
+            mStack.push_back({ bindings[operand], operand });
+            break;
+        }
+
+        case OpCode::PushNegatedVariable:
+        {
+            const StackValue variable{ bindings[operand], operand };
+            mStack.push_back({ -variable.mValue, kConstant });
+            Record(mStack.back(), std::span{ &variable, 1 }, std::array{ -1.0 });
+            break;
+        }
+
+        case OpCode::Negate:
+        {
+            const auto first{ mStack.back() };
+            mStack.back().mValue = -first.mValue;
+            Record(mStack.back(), std::span{ &first, 1 }, std::array{ -1.0 });
+            break;
+        }
+
+        case OpCode::Add:
+        case OpCode::Subtract:
+        case OpCode::Multiply:
+        case OpCode::Divide:
+        case OpCode::Power:
+        {
+            const std::array operands{ mStack[std::size(mStack) - 2], mStack.back() };
+            const auto [first, second]{ std::array{ operands[0].mValue, operands[1].mValue } };
+
+            mStack.pop_back();
+            auto& result{ mStack.back() };
+
+            switch (op_code)
+            {
+            case OpCode::Add:
+                result.mValue = first + second;
+                Record(result, operands, std::array{ 1.0, 1.0 });
+                break;
+
+            case OpCode::Subtract:
+                result.mValue = first - second;
+                Record(result, operands, std::array{ 1.0, -1.0 });
+                break;
+
+            case OpCode::Multiply:
+                result.mValue = first * second;
+                Record(result, operands, std::array{ second, first });
+                break;
+
+            case OpCode::Divide:
+                result.mValue = first / second;
+                Record(result, operands, std::array{ 1.0 / second, -result.mValue / second });
+                break;
+
+            default:
+                result.mValue = MathFunctions::Power(first, second);
+                Record(result, operands, std::array{ second == 0.0 ? 0.0 : second * MathFunctions::Power(first, second - 1.0), 
+                    result.mValue == 0.0 ? 0.0 : result.mValue * std::log(first) });
+                break;
+            }
+
+            break;
+        }
+
+        case OpCode::AddConstant:
+        case OpCode::SubtractConstant:
+        case OpCode::MultiplyConstant:
+        case OpCode::DivideConstant:
+        case OpCode::PowerConstant:
+        {
+            const auto first{ mStack.back() };
+            const auto constant{ constants[operand] };
+            auto& result{ mStack.back() };
+
+            double partial{ 1.0 };
+
+            switch (op_code)
+            {
+            case OpCode::AddConstant:      result.mValue = first.mValue + constant; break;
+            case OpCode::SubtractConstant: result.mValue = first.mValue - constant; break;
+            case OpCode::MultiplyConstant: result.mValue = first.mValue * constant; partial = constant; break;
+            case OpCode::DivideConstant:   result.mValue = first.mValue / constant; partial = 1.0 / constant; break;
+            default:                       result.mValue = std::pow(first.mValue, constant); partial = constant == 0.0 ? 0.0 : constant * std::pow(first.mValue, constant - 1.0); break;
+            }
+
+            Record(result, std::span{ &first, 1 }, std::array{ partial });
+            break;
+        }
+
+        case OpCode::Square:
+        {
+            const auto first{ mStack.back() };
+            mStack.back().mValue = first.mValue * first.mValue;
+            Record(mStack.back(), std::span{ &first, 1 }, std::array{ 2.0 * first.mValue });
+            break;
+        }
+
+        case OpCode::PowerInteger:
+        {
+            const auto first{ mStack.back() };
+            const auto exponent{ static_cast<std::int32_t>(operand) };
+
+            mStack.back().mValue = MathFunctions::IntegerPower(first.mValue, exponent);
+            Record(mStack.back(), std::span{ &first, 1 }, std::array{ exponent == 0 ? 0.0 : exponent * MathFunctions::IntegerPower(first.mValue, exponent - 1) });
+            break;
+        }
+
+        case OpCode::MultiplyAdd:
+        {
+            const std::array operands{ mStack[std::size(mStack) - 3], mStack[std::size(mStack) - 2], mStack.back() };
+
+            mStack.resize(std::size(mStack) - 2);
+            auto& result{ mStack.back() };
+
+            result.mValue = operands[0].mValue + operands[1].mValue * operands[2].mValue;
+            Record(result, operands, std::array{ 1.0, operands[2].mValue, operands[1].mValue });
+            break;
+        }
+
+        case OpCode::MultiplyAddConstant:
+        {
+            const std::array operands{ mStack[std::size(mStack) - 2], mStack.back() };
+
+            mStack.pop_back();
+            auto& result{ mStack.back() };
+
+            result.mValue = operands[0].mValue * operands[1].mValue + constants[operand];
+            Record(result, operands, std::array{ operands[1].mValue, operands[0].mValue });
+            break;
+        }
+
+        case OpCode::Sum:
+        case OpCode::Product:
+        {
+            const auto operands{ std::span{ mStack }.last(operand) };
+
+            mValues.resize(operand);
+            std::transform(std::begin(operands), std::end(operands), std::begin(mValues), [](const auto& value) { return value.mValue; });
+
+            mPartials.assign(operand, 1.0);
+
+            if (op_code == OpCode::Product)
+            {
+                // Product of all the other values, without dividing, so zeros are fine.
+                double prefix{ 1.0 };
+                for (std::size_t i{}; i < operand; ++i)
+                {
+                    mPartials[i] = prefix;
+                    prefix *= mValues[i];
+                }
+
+                double suffix{ 1.0 };
+                for (auto i{ static_cast<std::size_t>(operand) }; i-- > 0;)
+                {
+                    mPartials[i] *= suffix;
+                    suffix *= mValues[i];
+                }
+            }
+
+            // Reduced exactly like RPNProgram does, the values are overwritten.
+            StackValue result{ op_code == OpCode::Sum ? Utils::VectorMath::PairwiseSum(mValues) : Utils::VectorMath::PairwiseProduct(mValues), kConstant };
+            Record(result, operands, mPartials);
+
+            mStack.resize(std::size(mStack) - operand + 1);
+            mStack.back() = result;
+            break;
+        }
+
+        case OpCode::Call:
+        {
+            const auto id{ static_cast<MathFunctions::Id>(operand) };
+            const auto arity{ MathFunctions::Get(id).mArity };
+
+            std::array<StackValue, MathFunctions::kMaxArity> operands{};
+            std::array<double, MathFunctions::kMaxArity> arguments{};
+
+            for (std::size_t i{}; i < arity; ++i)
+            {
+                operands[i] = mStack[std::size(mStack) - arity + i];
+                arguments[i] = operands[i].mValue;
+            }
+
+            mStack.resize(std::size(mStack) - arity + 1);
+            auto& result{ mStack.back() };
+
+            const auto [first, second]{ arguments };
+            result.mValue = MathFunctions::Apply(id, std::span{ arguments }.first(arity));
+
+            std::array<double, MathFunctions::kMaxArity> partials{};
+
+            switch (id)
+            {
+            case MathFunctions::Id::Sin:  partials[0] = std::cos(first); break;
+            case MathFunctions::Id::Cos:  partials[0] = -std::sin(first); break;
+            case MathFunctions::Id::Exp:  partials[0] = result.mValue; break;
+            case MathFunctions::Id::Log:  partials[0] = 1.0 / first; break;
+            case MathFunctions::Id::Sqrt: partials[0] = 0.5 / result.mValue; break;
+            case MathFunctions::Id::Min:
+            case MathFunctions::Id::Max:
+                partials[0] = result.mValue == first ? 1.0 : 0.0;
+                partials[1] = 1.0 - partials[0];
+                break;
+            }
+
+            Record(result, std::span{ operands }.first(arity), std::span{ partials }.first(arity));
+            break;
+        }
+
+        case OpCode::Horner:
+        {
+            // Horner's rule for the value and its derivative at once.
+            const auto* coefficients{ std::data(constants) + operand };
+            const auto degree{ static_cast<std::size_t>(coefficients[0]) };
+
+            const auto first{ mStack.back() };
+            const auto x{ first.mValue };
+
+            auto value{ coefficients[1] };
+            double derivative{};
+
+            for (std::size_t i{ 2 }; i <= degree + 1; ++i)
+            {
+                derivative = std::fma(derivative, x, value);
+                value = std::fma(value, x, coefficients[i]);
+            }
+
+            mStack.back().mValue = value;
+            Record(mStack.back(), std::span{ &first, 1 }, std::array{ derivative });
+            break;
+        }
+
+        case OpCode::Return:
+        {
+            break;
+        }
+        }
+    }
+
+    const auto result{ mStack.back() };
+
+    // Backward sweep, every node comes after its operands.
+    mAdjoints.assign(std::size(mEdgesBegins) - 1, 0.0);
+
+    if (result.mNode != kConstant)
+    {
+        mAdjoints[result.mNode] = 1.0;
+    }
+
+    for (auto node{ std::size(mAdjoints) }; node-- > variables;)
+    {
+        const auto adjoint{ mAdjoints[node] };
+        if (adjoint == 0.0)
+        {
+            continue;
+        }
+
+        for (auto edge{ mEdgesBegins[node] }; edge < mEdgesBegins[node + 1]; ++edge)
+        {
+            mAdjoints[mEdges[edge].mOperand] += mEdges[edge].mPartial * adjoint;
+        }
+    }
+
+    std::copy(std::begin(mAdjoints), std::begin(mAdjoints) + static_cast<std::ptrdiff_t>(variables), std::begin(gradient));
+    return result.mValue;
+}
+
+void RPNGradient::Record(StackValue& result, std::span<const StackValue> operands, std::span<const double> partials)
+{
+    const auto edges_begin{ std::size(mEdges) };
+
+    for (std::size_t i{}; i < std::size(operands); ++i)
+    {
+        if (operands[i].mNode != kConstant)
+        {
+            mEdges.push_back({ operands[i].mNode, partials[i] });
+        }
+    }
+
+    if (std::size(mEdges) == edges_begin)
+    {
+        result.mNode = kConstant;
+        return;
+    }
+
+    result.mNode = static_cast<std::uint32_t>(std::size(mEdgesBegins) - 1);
+    mEdgesBegins.push_back(static_cast<std::uint32_t>(std::size(mEdges)));
+}
\ No newline at end of file
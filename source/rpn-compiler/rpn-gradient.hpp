@@ -0,0 +1,82 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Reverse-mode differentiation of a compiled program. Evaluate runs the program once and records 
+    every value depending on a variable on a tape, with the partial derivatives against its operands. 
+    One backward sweep over the tape then accumulates the derivative of the result against every 
+    variable, so the cost is a small multiple of one evaluation whatever the number of variables.
+
+    Values computed from constants only are not recorded. Derivatives follow the evaluators: 
+    ^ is differentiated against both operands (0 against the exponent when the result is 0), 
+    min and max pass the derivative to the operand they return, the first one on ties.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <rpn-program.hpp>
+
+class RPNGradient
+{
+public:
+    RPNGradient();
+    ~RPNGradient() noexcept = default;
+
+    // Value of the program, gradient[slot] is its derivative against bindings[slot].
+    // NaN and a NaN gradient if there are fewer bindings or gradient values than variables.
+    [[nodiscard]] double Evaluate(const RPNProgram& program, std::span<const double> bindings, std::span<double> gradient);
+
+private:
+    // Node index of values computed from constants only.
+    static constexpr std::uint32_t kConstant{ UINT32_MAX };
+
+    struct StackValue
+    {
+        double mValue;
+        std::uint32_t mNode;
+    };
+
+    struct Edge
+    {
+        std::uint32_t mOperand;
+        double mPartial;
+    };
+
+private:
+    void Record(StackValue& result, std::span<const StackValue> operands, std::span<const double> partials);
+
+private:
+    std::vector<StackValue> mStack;
+
+    // The first nodes are the variables, node i has the edges mEdges[mEdgesBegins[i]] up to mEdges[mEdgesBegins[i + 1]].
+    std::vector<Edge> mEdges;
+    std::vector<std::uint32_t> mEdgesBegins;
+    std::vector<double> mAdjoints;
+
+    // Scratch for Sum and Product.
+    std::vector<double> mValues;
+    std::vector<double> mPartials;
+};
\ No newline at end of file
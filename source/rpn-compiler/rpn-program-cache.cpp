@@ -0,0 +1,562 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rpn-program-cache.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <type_traits>
+
+#include <logger.hpp>
+
+#if __has_include(<sys/mman.h>) && __has_include(<fcntl.h>) && __has_include(<unistd.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define RPN_PROGRAM_CACHE_HAS_MMAP
+#endif
+
+struct RPNProgramCache::Header
+{
+    std::uint32_t mMagic;
+    std::uint16_t mVersion;
+    std::uint16_t mByteOrder;
+    std::uint64_t mEntryCount;
+    std::uint64_t mFileSize;
+    std::uint64_t mChecksum;
+};
+
+struct RPNProgramCache::Entry
+{
+    std::uint64_t mKeyHash;
+    std::uint64_t mInstructionsOffset;
+    std::uint64_t mConstantsOffset;
+    std::uint64_t mVariablesOffset;
+    std::uint64_t mExpressionOffset;
+    std::uint32_t mInstructionCount;
+    std::uint32_t mConstantCount;
+    std::uint32_t mVariableCount;
+    std::uint32_t mExpressionSize;
+    std::uint64_t mMaxStackDepth;
+};
+
+namespace
+{
+    constexpr std::uint32_t kMagic{ 0x43'4E'50'52 }; // "RPNC" read in little endian
+    constexpr std::uint16_t kByteOrderMark{ 0x0102 };
+    constexpr std::size_t kAlignment{ 8 };
+
+    // The instructions are used as they are in memory.
+    static_assert(std::is_trivially_copyable_v<RPNProgram::Instruction> && sizeof(RPNProgram::Instruction) == 8);
+    static_assert(static_cast<int>(RPNProgram::OpCode::Return) == 22, "RPNProgram::OpCode changed, bump RPNProgramCache::kVersion");
+
+    [[nodiscard]] constexpr std::uint64_t AlignUp(std::uint64_t offset) noexcept
+    {
+        return (offset + kAlignment - 1) & ~std::uint64_t{ kAlignment - 1 };
+    }
+
+    // Appends to the file image, every array starts 8 byte aligned.
+    class Writer
+    {
+    public:
+        // Zeros when data is nullptr, filled in later with Store.
+        [[nodiscard]] std::uint64_t Append(const void* data, std::size_t size)
+        {
+            const auto offset{ AlignUp(std::size(mBytes)) };
+
+            mBytes.resize(offset + size);
+            if (data != nullptr && size != 0)
+            {
+                std::memcpy(std::data(mBytes) + offset, data, size);
+            }
+
+            return offset;
+        }
+
+        template <typename T>
+        void Store(std::uint64_t offset, const T& value)
+        {
+            std::memcpy(std::data(mBytes) + offset, &value, sizeof(T));
+        }
+
+        [[nodiscard]] std::vector<std::byte>& GetBytes() noexcept { return mBytes; }
+
+    private:
+        std::vector<std::byte> mBytes;
+    };
+}
+
+RPNProgramCache::CachedProgram::CachedProgram(const RPNProgram::View& view, const QString* variables, const std::byte* file, const std::uint64_t* variable_records) noexcept :
+    mView{ view }, mVariables{ variables }, mFile{ file }, mVariableRecords{ variable_records }
+{ }
+
+double RPNProgramCache::CachedProgram::Evaluate(std::span<const double> bindings) const
+{
+    return RPNProgram::Evaluate(mView, bindings);
+}
+
+std::size_t RPNProgramCache::CachedProgram::GetVariableCount() const noexcept
+{
+    return mView.mVariableCount;
+}
+
+QStringView RPNProgramCache::CachedProgram::GetVariable(std::size_t slot) const noexcept
+{
+    if (mVariables != nullptr)
+    {
+        return mVariables[slot];
+    }
+
+    const auto record{ mVariableRecords[slot] };
+    return QStringView{ reinterpret_cast<const QChar*>(mFile + (record >> 32)), static_cast<qsizetype>(record & 0xFFFF'FFFF) };
+}
+
+std::optional<std::uint32_t> RPNProgramCache::CachedProgram::GetSlot(QStringView name) const noexcept
+{
+    for (std::size_t slot{}; slot < mView.mVariableCount; ++slot)
+    {
+        if (const auto variable{ GetVariable(slot) }; variable.size() == name.size() && std::equal(std::begin(variable), std::end(variable), std::begin(name)))
+        {
+            return static_cast<std::uint32_t>(slot);
+        }
+    }
+
+    return std::nullopt;
+}
+
+const RPNProgram::View& RPNProgramCache::CachedProgram::GetView() const noexcept
+{
+    return mView;
+}
+
+RPNProgramCache::RPNProgramCache() :
+    mFile{}, mFileSize{}, mIsMapped{}, mBuffer{}, mAddedPrograms{}, mAddedIndex{}, mErrorMessage{}
+{ }
+
+RPNProgramCache::~RPNProgramCache() noexcept
+{
+    Close();
+}
+
+bool RPNProgramCache::Open(const std::string& path)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+
+    Close();
+    mErrorMessage.clear();
+
+#ifdef RPN_PROGRAM_CACHE_HAS_MMAP
+    if (const auto descriptor{ ::open(path.c_str(), O_RDONLY) }; descriptor >= 0)
+    {
+        struct stat status{};
+        if (::fstat(descriptor, &status) == 0 && status.st_size > 0)
+        {
+            if (auto* address{ ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0) }; address != MAP_FAILED)
+            {
+                mFile = static_cast<const std::byte*>(address);
+                mFileSize = static_cast<std::size_t>(status.st_size);
+                mIsMapped = true;
+            }
+        }
+
+        ::close(descriptor);
+    }
+#endif
+
+    if (!mIsMapped)
+    {
+        // Read whole, into 8 byte aligned storage.
+        std::ifstream file{ path, std::ios::binary | std::ios::ate };
+        if (!file)
+        {
+            mErrorMessage = QStringLiteral("cannot open %1").arg(QString::fromStdString(path));
+            return false;
+        }
+
+        mFileSize = static_cast<std::size_t>(file.tellg());
+        mBuffer.resize(AlignUp(mFileSize) / sizeof(std::uint64_t));
+
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(std::data(mBuffer)), static_cast<std::streamsize>(mFileSize));
+        mFile = reinterpret_cast<const std::byte*>(std::data(mBuffer));
+
+        if (!file)
+        {
+            mErrorMessage = QStringLiteral("cannot read %1").arg(QString::fromStdString(path));
+            Close();
+            return false;
+        }
+    }
+
+    if (!Validate())
+    {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void RPNProgramCache::Close() noexcept
+{
+#ifdef RPN_PROGRAM_CACHE_HAS_MMAP
+    if (mIsMapped)
+    {
+        ::munmap(const_cast<std::byte*>(mFile), mFileSize);
+    }
+#endif
+
+    mFile = nullptr;
+    mFileSize = 0;
+    mIsMapped = false;
+
+    mBuffer.clear();
+    mBuffer.shrink_to_fit();
+
+    mAddedPrograms.clear();
+    mAddedIndex.clear();
+}
+
+std::optional<RPNProgramCache::CachedProgram> RPNProgramCache::Find(QStringView expression) const
+{
+    const auto key_hash{ Hash(expression) };
+
+    const auto entries{ GetEntries() };
+    const auto [first, last]{ std::equal_range(std::begin(entries), std::end(entries), key_hash, [](const auto& lhs, const auto& rhs)
+    {
+        if constexpr (std::is_same_v<std::decay_t<decltype(lhs)>, Entry>) { return lhs.mKeyHash < rhs; }
+        else { return lhs < rhs.mKeyHash; }
+    }) };
+
+    for (auto entry{ first }; entry != last; ++entry)
+    {
+        const QStringView text{ reinterpret_cast<const QChar*>(mFile + entry->mExpressionOffset), static_cast<qsizetype>(entry->mExpressionSize) };
+        if (text.size() != expression.size() || !std::equal(std::begin(text), std::end(text), std::begin(expression)))
+        {
+            continue;
+        }
+
+        const RPNProgram::View view
+        {
+            { reinterpret_cast<const RPNProgram::Instruction*>(mFile + entry->mInstructionsOffset), entry->mInstructionCount },
+            { reinterpret_cast<const double*>(mFile + entry->mConstantsOffset), entry->mConstantCount },
+            entry->mVariableCount,
+            entry->mMaxStackDepth
+        };
+
+        return CachedProgram{ view, nullptr, mFile, reinterpret_cast<const std::uint64_t*>(mFile + entry->mVariablesOffset) };
+    }
+
+    const auto [added_first, added_last]{ mAddedIndex.equal_range(key_hash) };
+    for (auto added{ added_first }; added != added_last; ++added)
+    {
+        const auto& [added_expression, program]{ mAddedPrograms[added->second] };
+        if (added_expression == expression)
+        {
+            return CachedProgram{ program.GetView(), std::data(program.GetVariables()), nullptr, nullptr };
+        }
+    }
+
+    return std::nullopt;
+}
+
+void RPNProgramCache::Add(const QString& expression, RPNProgram program)
+{
+    if (program.IsEmpty() || Find(expression).has_value())
+    {
+        return;
+    }
+
+    mAddedIndex.emplace(Hash(expression), std::size(mAddedPrograms));
+    mAddedPrograms.push_back({ expression, std::move(program) });
+}
+
+bool RPNProgramCache::Save(const std::string& path)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+    mErrorMessage.clear();
+
+    struct Source
+    {
+        std::uint64_t mKeyHash;
+        QStringView mExpression;
+        CachedProgram mProgram;
+    };
+
+    std::vector<Source> sources{};
+
+    for (const auto& entry : GetEntries())
+    {
+        const QStringView expression{ reinterpret_cast<const QChar*>(mFile + entry.mExpressionOffset), static_cast<qsizetype>(entry.mExpressionSize) };
+        sources.push_back({ entry.mKeyHash, expression, *Find(expression) });
+    }
+
+    for (const auto& [expression, program] : mAddedPrograms)
+    {
+        sources.push_back({ Hash(expression), expression, *Find(expression) });
+    }
+
+    std::stable_sort(std::begin(sources), std::end(sources), [](const auto& lhs, const auto& rhs) { return lhs.mKeyHash < rhs.mKeyHash; });
+
+    Writer writer{};
+    const auto header_offset{ writer.Append(nullptr, sizeof(Header)) };
+    const auto entries_offset{ writer.Append(nullptr, std::size(sources) * sizeof(Entry)) };
+
+    for (std::size_t i{}; i < std::size(sources); ++i)
+    {
+        const auto& [key_hash, expression, program]{ sources[i] };
+        const auto& view{ program.GetView() };
+
+        Entry entry{};
+        entry.mKeyHash = key_hash;
+        entry.mInstructionCount = static_cast<std::uint32_t>(std::size(view.mInstructions));
+        entry.mConstantCount = static_cast<std::uint32_t>(std::size(view.mConstants));
+        entry.mVariableCount = static_cast<std::uint32_t>(view.mVariableCount);
+        entry.mExpressionSize = static_cast<std::uint32_t>(expression.size());
+        entry.mMaxStackDepth = view.mMaxStackDepth;
+
+        // Copied field by field, the padding of the instructions is written as zeros.
+        std::vector<RPNProgram::Instruction> instructions(std::size(view.mInstructions));
+        std::memset(std::data(instructions), 0, std::size(instructions) * sizeof(RPNProgram::Instruction));
+        for (std::size_t j{}; j < std::size(instructions); ++j)
+        {
+            instructions[j].mOpCode = view.mInstructions[j].mOpCode;
+            instructions[j].mOperand = view.mInstructions[j].mOperand;
+        }
+
+        entry.mInstructionsOffset = writer.Append(std::data(instructions), std::size(instructions) * sizeof(RPNProgram::Instruction));
+        entry.mConstantsOffset = writer.Append(std::data(view.mConstants), std::size(view.mConstants) * sizeof(double));
+
+        entry.mVariablesOffset = writer.Append(nullptr, view.mVariableCount * sizeof(std::uint64_t));
+        for (std::size_t slot{}; slot < view.mVariableCount; ++slot)
+        {
+            const auto name{ program.GetVariable(slot) };
+            const auto name_offset{ writer.Append(name.data(), static_cast<std::size_t>(name.size()) * sizeof(QChar)) };
+
+            writer.Store(entry.mVariablesOffset + slot * sizeof(std::uint64_t), (name_offset << 32) | static_cast<std::uint64_t>(name.size()));
+        }
+
+        entry.mExpressionOffset = writer.Append(expression.data(), static_cast<std::size_t>(expression.size()) * sizeof(QChar));
+        writer.Store(entries_offset + i * sizeof(Entry), entry);
+    }
+
+    auto& bytes{ writer.GetBytes() };
+    if (std::size(bytes) > UINT32_MAX)
+    {
+        mErrorMessage = QStringLiteral("cache file larger than 4 GiB");
+        return false;
+    }
+
+    const Header header
+    {
+        kMagic, kVersion, kByteOrderMark, std::size(sources), std::size(bytes), 
+        Checksum(std::span{ bytes }.subspan(sizeof(Header)))
+    };
+
+    writer.Store(header_offset, header);
+
+    const auto temporary_path{ path + ".tmp" };
+    {
+        std::ofstream file{ temporary_path, std::ios::binary | std::ios::trunc };
+        file.write(reinterpret_cast<const char*>(std::data(bytes)), static_cast<std::streamsize>(std::size(bytes)));
+
+        if (!file.flush())
+        {
+            mErrorMessage = QStringLiteral("cannot write %1").arg(QString::fromStdString(temporary_path));
+            return false;
+        }
+    }
+
+    std::error_code error{};
+    std::filesystem::rename(temporary_path, path, error);
+
+    if (error)
+    {
+        mErrorMessage = QStringLiteral("cannot replace %1").arg(QString::fromStdString(path));
+        std::filesystem::remove(temporary_path, error);
+        return false;
+    }
+
+    return true;
+}
+
+std::size_t RPNProgramCache::GetSize() const noexcept
+{
+    return std::size(GetEntries()) + std::size(mAddedPrograms);
+}
+
+bool RPNProgramCache::HasError() const noexcept
+{
+    return !mErrorMessage.isEmpty();
+}
+
+const QString& RPNProgramCache::GetErrorMessage() const noexcept
+{
+    return mErrorMessage;
+}
+
+std::span<const RPNProgramCache::Entry> RPNProgramCache::GetEntries() const noexcept
+{
+    if (mFile == nullptr)
+    {
+        return {};
+    }
+
+    const auto* header{ reinterpret_cast<const Header*>(mFile) };
+    return { reinterpret_cast<const Entry*>(mFile + AlignUp(sizeof(Header))), static_cast<std::size_t>(header->mEntryCount) };
+}
+
+bool RPNProgramCache::Validate()
+{
+    auto Fail = [this](const QString& reason)
+    {
+        mErrorMessage = QStringLiteral("invalid program cache: %1").arg(reason);
+        return false;
+    };
+
+    if (mFileSize < sizeof(Header))
+    {
+        return Fail(QStringLiteral("truncated header"));
+    }
+
+    const auto* header{ reinterpret_cast<const Header*>(mFile) };
+
+    if (header->mMagic != kMagic)
+    {
+        return Fail(QStringLiteral("not a program cache"));
+    }
+
+    if (header->mByteOrder != kByteOrderMark)
+    {
+        return Fail(QStringLiteral("written in another byte order"));
+    }
+
+    if (header->mVersion != kVersion)
+    {
+        return Fail(QStringLiteral("format version %1, expected %2").arg(static_cast<int>(header->mVersion)).arg(static_cast<int>(kVersion)));
+    }
+
+    if (header->mFileSize != mFileSize || header->mEntryCount > (mFileSize - AlignUp(sizeof(Header))) / sizeof(Entry))
+    {
+        return Fail(QStringLiteral("truncated file"));
+    }
+
+    if (header->mChecksum != Checksum(std::span{ mFile, mFileSize }.subspan(sizeof(Header))))
+    {
+        return Fail(QStringLiteral("checksum mismatch"));
+    }
+
+    // The checksum only catches accidents, a crafted file passes it. Everything Find and the interpreter 
+    // rely on is checked here once: the offsets, the variable names and every instruction.
+    auto IsInFile = [this](std::uint64_t offset, std::uint64_t count, std::uint64_t size, std::uint64_t alignment = kAlignment)
+    {
+        return offset % alignment == 0 && offset <= mFileSize && count <= (mFileSize - offset) / size;
+    };
+
+    auto HasValidVariables = [&](const Entry& entry)
+    {
+        const auto* records{ reinterpret_cast<const std::uint64_t*>(mFile + entry.mVariablesOffset) };
+
+        return std::all_of(records, records + entry.mVariableCount, [&](std::uint64_t record)
+        {
+            return IsInFile(record >> 32, record & 0xFFFF'FFFF, sizeof(QChar), alignof(QChar));
+        });
+    };
+
+    auto HasValidProgram = [this](const Entry& entry)
+    {
+        return RPNProgram::Verify(
+        {
+            { reinterpret_cast<const RPNProgram::Instruction*>(mFile + entry.mInstructionsOffset), entry.mInstructionCount },
+            { reinterpret_cast<const double*>(mFile + entry.mConstantsOffset), entry.mConstantCount },
+            entry.mVariableCount,
+            entry.mMaxStackDepth
+        });
+    };
+
+    const auto entries{ GetEntries() };
+    for (std::size_t i{}; i < std::size(entries); ++i)
+    {
+        const auto& entry{ entries[i] };
+
+        const bool is_valid
+        {
+            IsInFile(entry.mInstructionsOffset, entry.mInstructionCount, sizeof(RPNProgram::Instruction)) &&
+            IsInFile(entry.mConstantsOffset, entry.mConstantCount, sizeof(double)) &&
+            IsInFile(entry.mVariablesOffset, entry.mVariableCount, sizeof(std::uint64_t)) &&
+            IsInFile(entry.mExpressionOffset, entry.mExpressionSize, sizeof(QChar)) &&
+            entry.mInstructionCount != 0 && (i == 0 || entries[i - 1].mKeyHash <= entry.mKeyHash)
+        };
+
+        if (!is_valid || !HasValidVariables(entry))
+        {
+            return Fail(QStringLiteral("entry %1 out of bounds").arg(static_cast<long long>(i)));
+        }
+
+        if (!HasValidProgram(entry))
+        {
+            return Fail(QStringLiteral("entry %1 is not a valid program").arg(static_cast<long long>(i)));
+        }
+    }
+
+    return true;
+}
+
+std::uint64_t RPNProgramCache::Hash(QStringView expression) noexcept
+{
+    // FNV-1a over the UTF-16 code units.
+    std::uint64_t hash{ 0xcbf29ce484222325 };
+
+    for (const auto character : expression)
+    {
+        hash = (hash ^ character.unicode()) * 0x100000001b3;
+    }
+
+    return hash;
+}
+
+std::uint64_t RPNProgramCache::Checksum(std::span<const std::byte> bytes) noexcept
+{
+    // FNV-1a over 8 byte words, a word per multiply keeps it well below the cost of reading the file.
+    std::uint64_t checksum{ 0xcbf29ce484222325 };
+
+    std::size_t offset{};
+    for (; offset + sizeof(std::uint64_t) <= std::size(bytes); offset += sizeof(std::uint64_t))
+    {
+        std::uint64_t word{};
+        std::memcpy(&word, std::data(bytes) + offset, sizeof(word));
+
+        checksum = (checksum ^ word) * 0x100000001b3;
+        checksum ^= checksum >> 29;
+    }
+
+    for (; offset < std::size(bytes); ++offset)
+    {
+        checksum = (checksum ^ static_cast<std::uint64_t>(bytes[offset])) * 0x100000001b3;
+    }
+
+    return checksum;
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Compiled programs kept on disk across restarts, keyed by a hash of the expression text.
+
+    The file is used in place once mapped: every program is found by a binary search over the 
+    entry table and evaluated straight from the mapped instructions and constants, nothing is 
+    parsed or copied. Offsets are relative to the start of the file, so it does not matter where 
+    it is mapped, and every array is 8 byte aligned. Layout, in native byte order:
+
+        Header       magic, format version, byte order mark, entry count, file size, 
+                     checksum of everything after the header
+        Entry[]      sorted by key hash: offsets and sizes of the arrays of one program
+        data         per program: instructions (RPNProgram::Instruction as in memory), 
+                     constants (double), variable names (offset and size records, UTF-16 text), 
+                     expression text (UTF-16, compared on lookup so a hash collision is a miss)
+
+    A file written by another version of the format, in another byte order, truncated or 
+    corrupted is rejected by Open. Programs compiled after Open are added in memory and 
+    written together with the mapped ones by Save.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <QString>
+#include <QStringView>
+
+#include "rpn-program.hpp"
+
+class RPNProgramCache
+{
+public:
+    // Bumped whenever the layout or RPNProgram::OpCode changes.
+    static constexpr std::uint16_t kVersion{ 2 };
+
+    // A program of the cache, valid until the cache is closed, opened again or destroyed.
+    class CachedProgram
+    {
+    public:
+        [[nodiscard]] double Evaluate(std::span<const double> bindings) const;
+
+        [[nodiscard]] std::size_t GetVariableCount() const noexcept;
+        [[nodiscard]] QStringView GetVariable(std::size_t slot) const noexcept;
+        [[nodiscard]] std::optional<std::uint32_t> GetSlot(QStringView name) const noexcept;
+
+        [[nodiscard]] const RPNProgram::View& GetView() const noexcept;
+
+    private:
+        friend class RPNProgramCache;
+
+        CachedProgram(const RPNProgram::View& view, const QString* variables, const std::byte* file, const std::uint64_t* variable_records) noexcept;
+
+    private:
+        RPNProgram::View mView;
+
+        // Names of a program added in memory, or records (offset << 32 | size) into the mapped file.
+        const QString* mVariables;
+        const std::byte* mFile;
+        const std::uint64_t* mVariableRecords;
+    };
+
+public:
+    RPNProgramCache();
+    ~RPNProgramCache() noexcept;
+
+    // Found programs point into the mapping.
+    RPNProgramCache(const RPNProgramCache&) = delete;
+    RPNProgramCache& operator=(const RPNProgramCache&) = delete;
+
+    // Maps the file and checks it, the cache is empty if this fails.
+    [[nodiscard]] bool Open(const std::string& path);
+    void Close() noexcept;
+
+    [[nodiscard]] std::optional<CachedProgram> Find(QStringView expression) const;
+
+    // Keeps a compiled program in memory until Save, an expression already in the cache is ignored.
+    void Add(const QString& expression, RPNProgram program);
+
+    // Writes the mapped and the added programs to path, through a temporary file renamed over it, 
+    // so a reader never sees a partial file. path may be the file currently open.
+    [[nodiscard]] bool Save(const std::string& path);
+
+    // Mapped and added programs.
+    [[nodiscard]] std::size_t GetSize() const noexcept;
+
+    [[nodiscard]] bool HasError() const noexcept;
+    [[nodiscard]] const QString& GetErrorMessage() const noexcept;
+
+private:
+    struct Header;
+    struct Entry;
+
+    struct AddedProgram
+    {
+        QString mExpression;
+        RPNProgram mProgram;
+    };
+
+private:
+    [[nodiscard]] std::span<const Entry> GetEntries() const noexcept;
+    [[nodiscard]] bool Validate();
+
+    [[nodiscard]] static std::uint64_t Hash(QStringView expression) noexcept;
+    [[nodiscard]] static std::uint64_t Checksum(std::span<const std::byte> bytes) noexcept;
+
+private:
+    // Mapped file, or its content read into mBuffer where mapping is not available.
+    const std::byte* mFile;
+    std::size_t mFileSize;
+    bool mIsMapped;
+    std::vector<std::uint64_t> mBuffer;
+
+    std::vector<AddedProgram> mAddedPrograms;
+    std::unordered_multimap<std::uint64_t, std::size_t> mAddedIndex;
+
+    QString mErrorMessage;
+};
\ No newline at end of file
@@ -0,0 +1,543 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rpn-program.hpp"
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include <vector-math.hpp>
+
+namespace
+{
+    // coefficients[0] is the degree n, then come the n + 1 coefficients from the highest one.
+    [[nodiscard]] double EvaluateHorner(const double* coefficients, double x) noexcept
+    {
+        const auto degree{ static_cast<std::size_t>(coefficients[0]) };
+
+        auto result{ coefficients[1] };
+        for (std::size_t i{ 2 }; i <= degree + 1; ++i) { result = std::fma(result, x, coefficients[i]); }
+
+        return result;
+    }
+}
+
+RPNProgram::RPNProgram() :
+    mInstructions{}, mConstants{}, mVariables{}, mMaxStackDepth{}
+{ }
+
+double RPNProgram::Evaluate(std::span<const double> bindings) const
+{
+    return Evaluate(GetView(), bindings);
+}
+
+double RPNProgram::Evaluate(const View& program, std::span<const double> bindings)
+{
+    if (std::empty(program.mInstructions) || std::size(bindings) < program.mVariableCount)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    std::array<double, kInlineStackSize> inline_stack;
+    std::vector<double> heap_stack{};
+
+    if (program.mMaxStackDepth > kInlineStackSize)
+    {
+        heap_stack.resize(program.mMaxStackDepth);
+    }
+
+    auto* stack{ program.mMaxStackDepth > kInlineStackSize ? std::data(heap_stack) : std::data(inline_stack) };
+    std::size_t top{};
+
+    const auto* constants{ std::data(program.mConstants) };
+    const auto* instruction{ std::data(program.mInstructions) };
+
+    // Threaded dispatch (GCC/Clang labels as values): every handler ends with its own indirect jump,
+    // so the predictor learns which handler follows which instead of sharing the one jump of a switch.
+    // The table follows the order of OpCode.
+    static const void* const kHandlers[]
+    {
+        &&PushConstant, &&PushVariable, &&Negate, &&Add, &&Subtract, &&Multiply, &&Divide, &&Power, &&Call,
+        &&PushNegatedVariable, &&AddConstant, &&SubtractConstant, &&MultiplyConstant, &&DivideConstant, &&PowerConstant,
+        &&MultiplyAdd, &&MultiplyAddConstant, &&Square, &&PowerInteger, &&Sum, &&Product, &&Horner, &&Return
+    };
+
+    static_assert(std::size(kHandlers) == static_cast<std::size_t>(OpCode::Return) + 1);
+
+#define RPN_PROGRAM_DISPATCH() goto *kHandlers[static_cast<std::size_t>((++instruction)->mOpCode)]
+
+    goto *kHandlers[static_cast<std::size_t>(instruction->mOpCode)];
+
+PushConstant:
+    stack[top++] = constants[instruction->mOperand];
+    RPN_PROGRAM_DISPATCH();
+
+PushVariable:
+    stack[top++] = bindings[instruction->mOperand];
+    RPN_PROGRAM_DISPATCH();
+
+Negate:
+    stack[top - 1] = -stack[top - 1];
+    RPN_PROGRAM_DISPATCH();
+
+Add:
+    --top; stack[top - 1] += stack[top];
+    RPN_PROGRAM_DISPATCH();
+
+Subtract:
+    --top; stack[top - 1] -= stack[top];
+    RPN_PROGRAM_DISPATCH();
+
+Multiply:
+    --top; stack[top - 1] *= stack[top];
+    RPN_PROGRAM_DISPATCH();
+
+Divide:
+    --top; stack[top - 1] /= stack[top];
+    RPN_PROGRAM_DISPATCH();
+
+Power:
+    --top; stack[top - 1] = MathFunctions::Power(stack[top - 1], stack[top]);
+    RPN_PROGRAM_DISPATCH();
+
+Call:
+    {
+        const auto id{ static_cast<MathFunctions::Id>(instruction->mOperand) };
+        const auto arity{ MathFunctions::Get(id).mArity };
+
+        top -= arity;
+        stack[top] = MathFunctions::Apply(id, std::span{ stack + top, arity });
+        ++top;
+    }
+    RPN_PROGRAM_DISPATCH();
+
+PushNegatedVariable:
+    stack[top++] = -bindings[instruction->mOperand];
+    RPN_PROGRAM_DISPATCH();
+
+AddConstant:
+    stack[top - 1] += constants[instruction->mOperand];
+    RPN_PROGRAM_DISPATCH();
+
+SubtractConstant:
+    stack[top - 1] -= constants[instruction->mOperand];
+    RPN_PROGRAM_DISPATCH();
+
+MultiplyConstant:
+    stack[top - 1] *= constants[instruction->mOperand];
+    RPN_PROGRAM_DISPATCH();
+
+DivideConstant:
+    stack[top - 1] /= constants[instruction->mOperand];
+    RPN_PROGRAM_DISPATCH();
+
+PowerConstant:
+    stack[top - 1] = std::pow(stack[top - 1], constants[instruction->mOperand]);
+    RPN_PROGRAM_DISPATCH();
+
+MultiplyAdd:
+    top -= 2; stack[top - 1] += stack[top] * stack[top + 1];
+    RPN_PROGRAM_DISPATCH();
+
+MultiplyAddConstant:
+    --top; stack[top - 1] = stack[top - 1] * stack[top] + constants[instruction->mOperand];
+    RPN_PROGRAM_DISPATCH();
+
+Square:
+    stack[top - 1] *= stack[top - 1];
+    RPN_PROGRAM_DISPATCH();
+
+PowerInteger:
+    stack[top - 1] = MathFunctions::IntegerPower(stack[top - 1], static_cast<std::int32_t>(instruction->mOperand));
+    RPN_PROGRAM_DISPATCH();
+
+Sum:
+    top -= instruction->mOperand;
+    stack[top] = Utils::VectorMath::PairwiseSum(std::span{ stack + top, instruction->mOperand });
+    ++top;
+    RPN_PROGRAM_DISPATCH();
+
+Product:
+    top -= instruction->mOperand;
+    stack[top] = Utils::VectorMath::PairwiseProduct(std::span{ stack + top, instruction->mOperand });
+    ++top;
+    RPN_PROGRAM_DISPATCH();
+
+Horner:
+    stack[top - 1] = EvaluateHorner(constants + instruction->mOperand, stack[top - 1]);
+    RPN_PROGRAM_DISPATCH();
+
+#undef RPN_PROGRAM_DISPATCH
+
+Return:
+    return stack[0];
+}
+
+bool RPNProgram::Verify(const View& program) noexcept
+{
+    const auto& instructions{ program.mInstructions };
+    const auto constant_count{ std::size(program.mConstants) };
+
+    if (std::empty(instructions) || program.mMaxStackDepth > std::size(instructions))
+    {
+        return false;
+    }
+
+    auto IsConstant = [constant_count](std::uint32_t operand) { return operand < constant_count; };
+
+    std::size_t depth{};
+
+    for (std::size_t i{}; i < std::size(instructions); ++i)
+    {
+        const auto [op_code, operand]{ instructions[i] };
+
+        // Operands taken and values pushed.
+        std::size_t taken{};
+        std::size_t pushed{ 1 };
+
+        switch (op_code)
+        {
+        case OpCode::PushConstant:
+            if (!IsConstant(operand)) { return false; }
+            break;
+
+        case OpCode::PushVariable:
+        case OpCode::PushNegatedVariable:
+            if (operand >= program.mVariableCount) { return false; }
+            break;
+
+        case OpCode::Negate:
+        case OpCode::Square:
+            taken = 1;
+            break;
+
+        case OpCode::PowerInteger:
+        {
+            const auto exponent{ static_cast<std::int32_t>(operand) };
+            if (exponent < -MathFunctions::kMaxSquaringExponent || exponent > MathFunctions::kMaxSquaringExponent) { return false; }
+
+            taken = 1;
+            break;
+        }
+
+        case OpCode::Add:
+        case OpCode::Subtract:
+        case OpCode::Multiply:
+        case OpCode::Divide:
+        case OpCode::Power:
+            taken = 2;
+            break;
+
+        case OpCode::AddConstant:
+        case OpCode::SubtractConstant:
+        case OpCode::MultiplyConstant:
+        case OpCode::DivideConstant:
+        case OpCode::PowerConstant:
+            if (!IsConstant(operand)) { return false; }
+            taken = 1;
+            break;
+
+        case OpCode::MultiplyAdd:
+            taken = 3;
+            break;
+
+        case OpCode::MultiplyAddConstant:
+            if (!IsConstant(operand)) { return false; }
+            taken = 2;
+            break;
+
+        case OpCode::Call:
+            if (operand >= MathFunctions::kFunctionCount) { return false; }
+            taken = MathFunctions::Get(static_cast<MathFunctions::Id>(operand)).mArity;
+            break;
+
+        case OpCode::Sum:
+        case OpCode::Product:
+            if (operand == 0) { return false; }
+            taken = operand;
+            break;
+
+        case OpCode::Horner:
+        {
+            if (!IsConstant(operand)) { return false; }
+
+            // The degree, then degree + 1 coefficients.
+            const auto degree{ program.mConstants[operand] };
+            if (!(degree >= 0.0 && degree == std::trunc(degree) && degree < static_cast<double>(constant_count - operand - 1))) { return false; }
+
+            taken = 1;
+            break;
+        }
+
+        case OpCode::Return:
+            // Only the last instruction, with the result alone on the stack.
+            return i + 1 == std::size(instructions) && depth == 1;
+
+        default:
+            return false;
+        }
+
+        if (depth < taken)
+        {
+            return false;
+        }
+
+        depth = depth - taken + pushed;
+        if (depth > program.mMaxStackDepth)
+        {
+            return false;
+        }
+    }
+
+    // No Return at the end.
+    return false;
+}
+
+void RPNProgram::Evaluate(std::span<const std::span<const double>> columns, std::span<double> output) const
+{
+    const auto rows{ std::size(output) };
+    const bool has_columns{ std::size(columns) >= std::size(mVariables) && std::all_of(std::begin(columns), std::begin(columns) + std::ssize(mVariables), 
+        [rows](const auto column) { return std::size(column) >= rows; }) };
+
+    if (std::empty(mInstructions) || !has_columns)
+    {
+        std::fill(std::begin(output), std::end(output), std::numeric_limits<double>::quiet_NaN());
+        return;
+    }
+
+    // One block of rows per stack slot.
+    std::vector<double> registers(mMaxStackDepth * kBatchSize);
+
+    for (std::size_t begin{}; begin < rows; begin += kBatchSize)
+    {
+        const auto count{ std::min(kBatchSize, rows - begin) };
+        auto Register = [&registers, count](std::size_t index) { return std::span{ std::data(registers) + index * kBatchSize, count }; };
+
+        std::size_t top{};
+
+        for (const auto& [op_code, operand] : mInstructions)
+        {
+            switch (op_code)
+            {
+            case OpCode::PushConstant:
+            {
+                const auto destination{ Register(top++) };
+                std::fill(std::begin(destination), std::end(destination), mConstants[operand]);
+                break;
+            }
+
+            case OpCode::PushVariable:
+            {
+                const auto source{ columns[operand].subspan(begin, count) };
+                std::copy(std::begin(source), std::end(source), std::begin(Register(top++)));
+                break;
+            }
+
+            case OpCode::PushNegatedVariable:
+            {
+                const auto source{ columns[operand].subspan(begin, count) };
+                std::transform(std::begin(source), std::end(source), std::begin(Register(top++)), [](double x) { return -x; });
+                break;
+            }
+
+            case OpCode::Negate:
+            {
+                for (auto& x : Register(top - 1)) { x = -x; }
+                break;
+            }
+
+            case OpCode::AddConstant:
+            case OpCode::SubtractConstant:
+            case OpCode::MultiplyConstant:
+            case OpCode::DivideConstant:
+            case OpCode::PowerConstant:
+            {
+                const auto first{ Register(top - 1) };
+                const auto constant{ mConstants[operand] };
+
+                switch (op_code)
+                {
+                case OpCode::AddConstant:      for (auto& x : first) { x += constant; } break;
+                case OpCode::SubtractConstant: for (auto& x : first) { x -= constant; } break;
+                case OpCode::MultiplyConstant: for (auto& x : first) { x *= constant; } break;
+                case OpCode::DivideConstant:   for (auto& x : first) { x /= constant; } break;
+                default:                       for (auto& x : first) { x = std::pow(x, constant); } break;
+                }
+
+                break;
+            }
+
+            case OpCode::MultiplyAdd:
+            {
+                top -= 2;
+                const auto addend{ Register(top - 1) };
+                const auto first{ Register(top) };
+                const auto second{ Register(top + 1) };
+
+                for (std::size_t i{}; i < count; ++i) { addend[i] += first[i] * second[i]; }
+                break;
+            }
+
+            case OpCode::MultiplyAddConstant:
+            {
+                --top;
+                const auto first{ Register(top - 1) };
+                const auto second{ Register(top) };
+                const auto constant{ mConstants[operand] };
+
+                for (std::size_t i{}; i < count; ++i) { first[i] = first[i] * second[i] + constant; }
+                break;
+            }
+
+            case OpCode::Square:
+            {
+                for (auto& x : Register(top - 1)) { x *= x; }
+                break;
+            }
+
+            case OpCode::PowerInteger:
+            {
+                const auto exponent{ static_cast<std::int32_t>(operand) };
+                for (auto& x : Register(top - 1)) { x = MathFunctions::IntegerPower(x, exponent); }
+                break;
+            }
+
+            case OpCode::Sum:
+            case OpCode::Product:
+            {
+                // Level by level over whole blocks, every row is reduced like PairwiseSum / PairwiseProduct would.
+                top -= operand;
+
+                for (auto values{ static_cast<std::size_t>(operand) }; values > 1; values = values / 2 + values % 2)
+                {
+                    for (std::size_t i{}; i < values / 2; ++i)
+                    {
+                        const auto destination{ Register(top + i) };
+                        const auto first{ Register(top + 2 * i) };
+                        const auto second{ Register(top + 2 * i + 1) };
+
+                        if (op_code == OpCode::Sum) { for (std::size_t row{}; row < count; ++row) { destination[row] = first[row] + second[row]; } }
+                        else                        { for (std::size_t row{}; row < count; ++row) { destination[row] = first[row] * second[row]; } }
+                    }
+
+                    if (values % 2 != 0)
+                    {
+                        const auto last{ Register(top + values - 1) };
+                        std::copy(std::begin(last), std::end(last), std::begin(Register(top + values / 2)));
+                    }
+                }
+
+                ++top;
+                break;
+            }
+
+            case OpCode::Horner:
+            {
+                // Coefficient by coefficient over the whole block, every row rounds like EvaluateHorner.
+                const auto* coefficients{ std::data(mConstants) + operand };
+                const auto degree{ static_cast<std::size_t>(coefficients[0]) };
+
+                const auto values{ Register(top - 1) };
+
+                std::array<double, kBatchSize> xs;
+                std::copy(std::begin(values), std::end(values), std::begin(xs));
+                std::fill(std::begin(values), std::end(values), coefficients[1]);
+
+                for (std::size_t i{ 2 }; i <= degree + 1; ++i)
+                {
+                    const auto coefficient{ coefficients[i] };
+                    for (std::size_t row{}; row < count; ++row) { values[row] = std::fma(values[row], xs[row], coefficient); }
+                }
+
+                break;
+            }
+
+            case OpCode::Return:
+            {
+                break;
+            }
+
+            case OpCode::Add:
+            case OpCode::Subtract:
+            case OpCode::Multiply:
+            case OpCode::Divide:
+            case OpCode::Power:
+            {
+                --top;
+                const auto first{ Register(top - 1) };
+                const auto second{ Register(top) };
+
+                switch (op_code)
+                {
+                case OpCode::Add:      for (std::size_t i{}; i < count; ++i) { first[i] += second[i]; } break;
+                case OpCode::Subtract: for (std::size_t i{}; i < count; ++i) { first[i] -= second[i]; } break;
+                case OpCode::Multiply: for (std::size_t i{}; i < count; ++i) { first[i] *= second[i]; } break;
+                case OpCode::Divide:   for (std::size_t i{}; i < count; ++i) { first[i] /= second[i]; } break;
+                default:               for (std::size_t i{}; i < count; ++i) { first[i] = MathFunctions::Power(first[i], second[i]); } break;
+                }
+
+                break;
+            }
+
+            case OpCode::Call:
+            {
+                const auto id{ static_cast<MathFunctions::Id>(operand) };
+                const auto arity{ MathFunctions::Get(id).mArity };
+
+                top -= arity;
+                const auto first{ Register(top) };
+                const auto second{ arity > 1 ? Register(top + 1) : std::span<double>{} };
+
+                MathFunctions::ApplyBatch(id, first, second, first);
+                ++top;
+                break;
+            }
+            }
+        }
+
+        const auto result{ Register(0) };
+        std::copy(std::begin(result), std::end(result), std::begin(output) + static_cast<std::ptrdiff_t>(begin));
+    }
+}
+
+std::optional<std::uint32_t> RPNProgram::GetSlot(QStringView name) const noexcept
+{
+    for (std::size_t slot{}; slot < std::size(mVariables); ++slot)
+    {
+        if (mVariables[slot] == name)
+        {
+            return static_cast<std::uint32_t>(slot);
+        }
+    }
+
+    return std::nullopt;
+}
+
+const std::vector<QString>& RPNProgram::GetVariables() const noexcept { return mVariables; }
+const std::vector<RPNProgram::Instruction>& RPNProgram::GetInstructions() const noexcept { return mInstructions; }
+const std::vector<double>& RPNProgram::GetConstants() const noexcept { return mConstants; }
+std::size_t RPNProgram::GetMaxStackDepth() const noexcept { return mMaxStackDepth; }
+RPNProgram::View RPNProgram::GetView() const noexcept { return { mInstructions, mConstants, std::size(mVariables), mMaxStackDepth }; }
+
+bool RPNProgram::IsEmpty() const noexcept { return std::empty(mInstructions); }
\ No newline at end of file
@@ -0,0 +1,146 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Compiled form of an RPN expression. Literals are stored as doubles and every variable 
+    is resolved to a dense slot, so evaluation reads bindings[slot] and does no name lookup.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <QString>
+#include <QStringView>
+
+#include <math-functions.hpp>
+
+class RPNProgram
+{
+public:
+    enum class OpCode : std::uint8_t
+    {
+        PushConstant,
+        PushVariable,
+        Negate,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Power,
+        Call,
+
+        // Superinstructions produced by the compiler's peephole pass, each replaces a pair.
+        PushNegatedVariable,    // PushVariable, Negate
+        AddConstant,            // PushConstant, Add
+        SubtractConstant,       // PushConstant, Subtract
+        MultiplyConstant,       // PushConstant, Multiply
+        DivideConstant,         // PushConstant, Divide
+        PowerConstant,          // PushConstant, Power
+        MultiplyAdd,            // Multiply, Add: c a b -> c + a * b
+        MultiplyAddConstant,    // Multiply, AddConstant: a b -> a * b + constant
+
+        // Constant integer exponents, see MathFunctions::IntegerPower.
+        Square,                 // PushConstant 2, Power
+        PowerInteger,           // PushConstant n, Power for other integers up to MathFunctions::kMaxSquaringExponent
+
+        // Pairwise reduction of the top operand values, only emitted with reassociation enabled.
+        Sum,
+        Product,
+
+        // Polynomial in the top value evaluated in Horner form with std::fma, only emitted with contraction enabled.
+        Horner,
+
+        // Terminates every compiled program, so dispatch needs no bounds check.
+        Return
+    };
+
+    struct Instruction
+    {
+        OpCode mOpCode;
+
+        // Index into the constants for PushConstant and the *Constant superinstructions, 
+        // variable slot for PushVariable and PushNegatedVariable, MathFunctions::Id for Call, 
+        // the exponent as std::int32_t for PowerInteger, the value count for Sum and Product, unused otherwise.
+        // Horner reads the degree n from constants[mOperand], then the n + 1 coefficients from the highest one.
+        std::uint32_t mOperand;
+    };
+
+    // Non-owning form of a program, e.g. over a file mapped by RPNProgramCache.
+    struct View
+    {
+        std::span<const Instruction> mInstructions;
+        std::span<const double> mConstants;
+        std::size_t mVariableCount;
+        std::size_t mMaxStackDepth;
+    };
+
+public:
+    RPNProgram();
+    ~RPNProgram() noexcept = default;
+
+    // bindings[slot] is the value of GetVariables()[slot], NaN if there are fewer bindings than variables.
+    [[nodiscard]] double Evaluate(std::span<const double> bindings) const;
+
+    // The same interpreter over a view, the program must end with Return.
+    // It trusts the program, a view from outside the compiler must pass Verify first.
+    [[nodiscard]] static double Evaluate(const View& program, std::span<const double> bindings);
+
+    // Checks everything the interpreter relies on: known opcodes, operands within the constants, 
+    // the variables and the functions, enough operands for every instruction, a stack never deeper 
+    // than mMaxStackDepth (itself at most one value per instruction), and a single final Return.
+    [[nodiscard]] static bool Verify(const View& program) noexcept;
+
+    // Column evaluation: row i binds columns[slot][i] to every variable and writes output[i].
+    // Runs instruction by instruction over blocks of rows, so function calls use the batch kernels.
+    // Every column must have at least size(output) values, otherwise the output is filled with NaN.
+    void Evaluate(std::span<const std::span<const double>> columns, std::span<double> output) const;
+
+    [[nodiscard]] std::optional<std::uint32_t> GetSlot(QStringView name) const noexcept;
+
+    [[nodiscard]] const std::vector<QString>& GetVariables() const noexcept;
+    [[nodiscard]] const std::vector<Instruction>& GetInstructions() const noexcept;
+    [[nodiscard]] const std::vector<double>& GetConstants() const noexcept;
+    [[nodiscard]] std::size_t GetMaxStackDepth() const noexcept;
+    [[nodiscard]] View GetView() const noexcept;
+
+    [[nodiscard]] bool IsEmpty() const noexcept;
+
+private:
+    friend class RPNCompiler;
+
+    // Operand stacks up to this depth live on the machine stack.
+    static constexpr std::size_t kInlineStackSize{ 64 };
+
+    // Rows per block of the column evaluation.
+    static constexpr std::size_t kBatchSize{ 256 };
+
+private:
+    std::vector<Instruction> mInstructions;
+    std::vector<double> mConstants;
+    std::vector<QString> mVariables;
+
+    std::size_t mMaxStackDepth;
+};
\ No newline at end of file
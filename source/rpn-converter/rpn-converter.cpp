@@ -23,32 +23,111 @@
 #include "rpn-converter.hpp"
 
 std::vector<Tokenizer::TokenPair> RPNConverter::Convert(const std::vector<Tokenizer::TokenPair>& input)
+{
+    std::vector<Tokenizer::TokenPair> output{};
+    output.reserve(std::size(input));
+
+    std::ignore = Convert(input, output);
+    return output;
+}
+
+bool RPNConverter::Convert(const std::vector<Tokenizer::TokenPair>& input, std::vector<Tokenizer::TokenPair>& output)
 {
     UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
-    mErrorMessage.clear();
+
+    // Both buffers keep their capacity, so a warmed up converter does not allocate.
+    output.clear();
+    BeginParts();
 
     if (std::empty(input))
     {
         mErrorMessage = QStringLiteral("Input is empty");
-        return {};
+        return false;
     }
 
-    std::stack<std::pair<QString, Tokenizer::Token>> stack{};
-    
-    std::vector<Tokenizer::TokenPair> output{};
-    output.reserve(static_cast<qsizetype>(std::size(input)));
+    return ConvertPart(input, output) && FinishParts(output);
+}
+
+void RPNConverter::BeginParts()
+{
+    mErrorMessage.clear();
 
-    for (const auto& [lexeme, token] : input)
+    mStack.clear();
+    mArgumentCounts.clear();
+    mPendingUnary.reset();
+
+    ResetLimitViolation(0);
+}
+
+bool RPNConverter::ConvertPart(std::span<const Tokenizer::TokenPair> input, std::vector<Tokenizer::TokenPair>& output)
+{
+    auto ExceedLimit = [&](Utils::LimitViolation violation)
+    {
+        mLimitViolation = violation;
+        mErrorMessage = Utils::DescribeLimitViolation(violation, mLimits);
+        output.clear();
+        return false;
+    };
+
+    mTokenCount += std::size(input);
+    if (mTokenCount > mLimits.mMaxTokenCount)
+    {
+        return ExceedLimit(Utils::LimitViolation::TokenCount);
+    }
+
+    // A unary minus which ended the previous part is placed now that the token after it is known.
+    if (mPendingUnary.has_value() && !std::empty(input))
     {
+        if (input.front().mToken == Tokenizer::Token::Function)
+        {
+            mStack.push_back(std::move(*mPendingUnary));
+        }
+        else
+        {
+            output.push_back(std::move(*mPendingUnary));
+        }
+
+        mPendingUnary.reset();
+    }
+
+    for (std::size_t i{}; i < std::size(input); ++i)
+    {
+        if (mLimits.IsPastDeadline(mDeadlineCountdown))
+        {
+            return ExceedLimit(Utils::LimitViolation::Deadline);
+        }
+
+        const auto& token_pair{ input[i] };
+        const auto& [lexeme, token, value]{ token_pair };
+
         switch (token) 
         {
+        case Tokenizer::Token::UnaryOperator:
+        {
+            if (i + 1 == std::size(input))
+            {
+                mPendingUnary = token_pair;
+                break;
+            }
+
+            // "-f(x)" negates the call result: the sign waits below the function and is emitted right before it.
+            if (input[i + 1].mToken == Tokenizer::Token::Function)
+            {
+                UT_CC_DEFAULT_LOGGER_INFO("---- case: unary before function| lexeme: {} |", lexeme.toStdString());
+
+                mStack.push_back(token_pair);
+                break;
+            }
+
+            [[fallthrough]];
+        }
         case Tokenizer::Token::Integer: 
         case Tokenizer::Token::FloatingPoint: 
-        case Tokenizer::Token::UnaryOperator:
+        case Tokenizer::Token::Identifier:
         {
-            UT_CC_DEFAULT_LOGGER_INFO("---- case: int, float, unary| lexeme: {} |", lexeme.toStdString());
+            UT_CC_DEFAULT_LOGGER_INFO("---- case: int, float, unary, identifier| lexeme: {} |", lexeme.toStdString());
 
-            output.push_back({lexeme, token});
+            output.push_back(token_pair);
             break;
         }
         
@@ -57,13 +136,28 @@ std::vector<Tokenizer::TokenPair> RPNConverter::Convert(const std::vector<Tokeni
             UT_CC_DEFAULT_LOGGER_INFO("---- case: operator| lexeme: {} |", lexeme.toStdString());
             
             const auto curr_priority{ GetOperatorPriority(lexeme) };   
-            while (!std::empty(stack) && GetOperatorPriority(stack.top().first) >= curr_priority)
+            while (!std::empty(mStack) && GetOperatorPriority(mStack.back().mLexeme) >= curr_priority)
             {
-                output.push_back(stack.top());
-                stack.pop();         
+                output.push_back(mStack.back());
+                mStack.pop_back();         
             }
             
-            stack.push({lexeme, token});
+            mStack.push_back(token_pair);
+            break;
+        }
+
+        case Tokenizer::Token::Function:
+        {
+            UT_CC_DEFAULT_LOGGER_INFO("---- case: function| lexeme: {} |", lexeme.toStdString());
+
+            if (MathFunctions::Find(lexeme) == nullptr)
+            {
+                mErrorMessage = QStringLiteral("unknown function: %1").arg(lexeme);
+                output.clear();
+                return false;
+            }
+
+            mStack.push_back(token_pair);
             break;
         }
 
@@ -71,7 +165,35 @@ std::vector<Tokenizer::TokenPair> RPNConverter::Convert(const std::vector<Tokeni
         {
             UT_CC_DEFAULT_LOGGER_INFO("---- case: left parenthesis| lexeme: {} |", lexeme.toStdString());
 
-            stack.push({lexeme, token});
+            if (std::size(mArgumentCounts) >= mLimits.mMaxNestingDepth)
+            {
+                return ExceedLimit(Utils::LimitViolation::NestingDepth);
+            }
+
+            mStack.push_back(token_pair);
+            mArgumentCounts.push_back(1);
+            break;
+        }
+
+        case Tokenizer::Token::Separator:
+        {
+            UT_CC_DEFAULT_LOGGER_INFO("---- case: separator| lexeme: {} |", lexeme.toStdString());
+
+            while (!std::empty(mStack) && mStack.back().mToken != Tokenizer::Token::LeftParenthesis)
+            {
+                output.push_back(mStack.back());
+                mStack.pop_back();
+            }
+
+            const auto size{ std::size(mStack) };
+            if (size < 2 || mStack[size - 2].mToken != Tokenizer::Token::Function)
+            {
+                mErrorMessage = QStringLiteral("separator outside of function call");
+                output.clear();
+                return false;
+            }
+
+            mArgumentCounts.ReplaceBack(mArgumentCounts.back() + 1);
             break;
         }
 
@@ -79,45 +201,336 @@ std::vector<Tokenizer::TokenPair> RPNConverter::Convert(const std::vector<Tokeni
         {
             UT_CC_DEFAULT_LOGGER_INFO("---- case: right parenthesis| lexeme: {} |", lexeme.toStdString());
 
-            if (std::empty(stack))
+            if (std::empty(mStack))
             {
                 mErrorMessage = QStringLiteral("extra right parenthesis");
-                return {};
+                output.clear();
+                return false;
             }
 
-            while (stack.top().second != Tokenizer::Token::LeftParenthesis)
+            while (mStack.back().mToken != Tokenizer::Token::LeftParenthesis)
             {
-                output.push_back(stack.top());
-                stack.pop();
+                output.push_back(mStack.back());
+                mStack.pop_back();
 
-                if (std::empty(stack))
+                if (std::empty(mStack))
                 {
                     mErrorMessage = QStringLiteral("left parenthesis missing");
-                    return {};
+                    output.clear();
+                    return false;
                 }
             }
 
-            stack.pop();
+            mStack.pop_back();
+
+            const auto argument_count{ mArgumentCounts.back() };
+            mArgumentCounts.pop_back();
+
+            if (!std::empty(mStack) && mStack.back().mToken == Tokenizer::Token::Function && !CloseFunctionCall(argument_count, output))
+            {
+                output.clear();
+                return false;
+            }
+
             break;
         }
         }
     }
 
+    return true;
+}
+
+bool RPNConverter::FinishParts(std::vector<Tokenizer::TokenPair>& output)
+{
     UT_CC_DEFAULT_LOGGER_INFO("end of input tokens");
-    while (!std::empty(stack))
+
+    if (mPendingUnary.has_value())
+    {
+        output.push_back(std::move(*mPendingUnary));
+        mPendingUnary.reset();
+    }
+
+    while (!std::empty(mStack))
     {
-        const auto& [lexeme, token]{ stack.top() };
-        if (token == Tokenizer::Token::LeftParenthesis)
+        if (mStack.back().mToken == Tokenizer::Token::LeftParenthesis)
         {
             mErrorMessage = QStringLiteral("left parenthesis missing");
-            return {};
+            output.clear();
+            return false;
         }
 
-        output.push_back({lexeme, token});
-        stack.pop();
+        output.push_back(mStack.back());
+        mStack.pop_back();
     }
 
-    return output;
+    return true;
+}
+
+bool RPNConverter::Convert(const TokenStream& input, TokenStream& output)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+    mErrorMessage.clear();
+
+    using Kind = TokenStream::Kind;
+
+    output.Clear();
+    output.Reserve(input.GetSize());
+    output.ShareNames(input);
+
+    mIndexStack.clear();
+    mArgumentCounts.clear();
+    ResetLimitViolation(input.GetSize());
+
+    if (input.IsEmpty())
+    {
+        mErrorMessage = QStringLiteral("Input is empty");
+        return false;
+    }
+
+    const auto kinds{ input.GetKinds() };
+    const auto values{ input.GetValues() };
+    const auto offsets{ input.GetOffsets() };
+
+    auto Emit = [&](std::uint32_t index) { output.Push(kinds[index], values[index], offsets[index]); };
+
+    auto Fail = [&](const QString& message)
+    {
+        mErrorMessage = message;
+        output.Clear();
+        return false;
+    };
+
+    auto ExceedLimit = [&](Utils::LimitViolation violation)
+    {
+        mLimitViolation = violation;
+        return Fail(Utils::DescribeLimitViolation(violation, mLimits));
+    };
+
+    if (mTokenCount > mLimits.mMaxTokenCount)
+    {
+        return ExceedLimit(Utils::LimitViolation::TokenCount);
+    }
+
+    for (std::uint32_t i{}; i < std::size(kinds); ++i)
+    {
+        if (mLimits.IsPastDeadline(mDeadlineCountdown))
+        {
+            return ExceedLimit(Utils::LimitViolation::Deadline);
+        }
+
+        switch (kinds[i])
+        {
+        case Kind::Negate:
+        {
+            // "-f(x)" negates the call result: the sign waits below the function and is emitted right before it.
+            if (i + 1 < std::size(kinds) && kinds[i + 1] == Kind::Function)
+            {
+                mIndexStack.push_back(i);
+                break;
+            }
+
+            [[fallthrough]];
+        }
+        case Kind::Number:
+        case Kind::Identifier:
+        {
+            Emit(i);
+            break;
+        }
+
+        case Kind::Add:
+        case Kind::Subtract:
+        case Kind::Multiply:
+        case Kind::Divide:
+        case Kind::Power:
+        {
+            const auto curr_priority{ TokenStream::GetPriority(kinds[i]) };
+            while (!std::empty(mIndexStack) && TokenStream::GetPriority(kinds[mIndexStack.back()]) >= curr_priority)
+            {
+                Emit(mIndexStack.back());
+                mIndexStack.pop_back();
+            }
+
+            mIndexStack.push_back(i);
+            break;
+        }
+
+        // Unknown functions are already rejected by TokenStream::Assign.
+        case Kind::Function:
+        {
+            mIndexStack.push_back(i);
+            break;
+        }
+
+        case Kind::LeftParenthesis:
+        {
+            if (std::size(mArgumentCounts) >= mLimits.mMaxNestingDepth)
+            {
+                return ExceedLimit(Utils::LimitViolation::NestingDepth);
+            }
+
+            mIndexStack.push_back(i);
+            mArgumentCounts.push_back(1);
+            break;
+        }
+
+        case Kind::Separator:
+        {
+            while (!std::empty(mIndexStack) && kinds[mIndexStack.back()] != Kind::LeftParenthesis)
+            {
+                Emit(mIndexStack.back());
+                mIndexStack.pop_back();
+            }
+
+            const auto size{ std::size(mIndexStack) };
+            if (size < 2 || kinds[mIndexStack[size - 2]] != Kind::Function)
+            {
+                return Fail(QStringLiteral("separator outside of function call"));
+            }
+
+            mArgumentCounts.ReplaceBack(mArgumentCounts.back() + 1);
+            break;
+        }
+
+        case Kind::RightParenthesis:
+        {
+            if (std::empty(mIndexStack))
+            {
+                return Fail(QStringLiteral("extra right parenthesis"));
+            }
+
+            while (kinds[mIndexStack.back()] != Kind::LeftParenthesis)
+            {
+                Emit(mIndexStack.back());
+                mIndexStack.pop_back();
+
+                if (std::empty(mIndexStack))
+                {
+                    return Fail(QStringLiteral("left parenthesis missing"));
+                }
+            }
+
+            mIndexStack.pop_back();
+
+            const auto argument_count{ mArgumentCounts.back() };
+            mArgumentCounts.pop_back();
+
+            if (!std::empty(mIndexStack) && kinds[mIndexStack.back()] == Kind::Function && !CloseFunctionCall(argument_count, input, output))
+            {
+                output.Clear();
+                return false;
+            }
+
+            break;
+        }
+        }
+    }
+
+    while (!std::empty(mIndexStack))
+    {
+        if (kinds[mIndexStack.back()] == Kind::LeftParenthesis)
+        {
+            return Fail(QStringLiteral("left parenthesis missing"));
+        }
+
+        Emit(mIndexStack.back());
+        mIndexStack.pop_back();
+    }
+
+    return true;
+}
+
+bool RPNConverter::CloseFunctionCall(std::size_t argument_count, std::vector<Tokenizer::TokenPair>& output)
+{
+    const auto& function{ mStack.back() };
+    const auto* descriptor{ MathFunctions::Find(function.mLexeme) };
+
+    if (descriptor->mArity != argument_count)
+    {
+        mErrorMessage = QStringLiteral("%1 expects %2 argument(s), got %3").arg(function.mLexeme).arg(descriptor->mArity).arg(argument_count);
+        return false;
+    }
+
+    // A deferred unary minus goes first, so the evaluator applies it to the call result.
+    const auto size{ std::size(mStack) };
+    if (size >= 2 && mStack[size - 2].mToken == Tokenizer::Token::UnaryOperator)
+    {
+        output.push_back(mStack[size - 2]);
+    }
+
+    output.push_back(function);
+    mStack.pop_back();
+
+    if (!std::empty(mStack) && mStack.back().mToken == Tokenizer::Token::UnaryOperator)
+    {
+        mStack.pop_back();
+    }
+
+    return true;
+}
+
+bool RPNConverter::CloseFunctionCall(std::size_t argument_count, const TokenStream& input, TokenStream& output)
+{
+    const auto kinds{ input.GetKinds() };
+    const auto values{ input.GetValues() };
+    const auto offsets{ input.GetOffsets() };
+
+    const auto function{ mIndexStack.back() };
+    const auto& descriptor{ MathFunctions::Get(static_cast<MathFunctions::Id>(values[function])) };
+
+    if (descriptor.mArity != argument_count)
+    {
+        const QString name{ reinterpret_cast<const QChar*>(std::data(descriptor.mName)), static_cast<qsizetype>(std::size(descriptor.mName)) };
+        mErrorMessage = QStringLiteral("%1 expects %2 argument(s), got %3").arg(name).arg(descriptor.mArity).arg(argument_count);
+        return false;
+    }
+
+    // A deferred unary minus goes first, so the evaluator applies it to the call result.
+    const auto size{ std::size(mIndexStack) };
+    if (size >= 2 && kinds[mIndexStack[size - 2]] == TokenStream::Kind::Negate)
+    {
+        const auto sign{ mIndexStack[size - 2] };
+        output.Push(kinds[sign], values[sign], offsets[sign]);
+    }
+
+    output.Push(kinds[function], values[function], offsets[function]);
+    mIndexStack.pop_back();
+
+    if (!std::empty(mIndexStack) && kinds[mIndexStack.back()] == TokenStream::Kind::Negate)
+    {
+        mIndexStack.pop_back();
+    }
+
+    return true;
+}
+
+void RPNConverter::SetUndoLogging(bool is_enabled) noexcept
+{
+    mStack.SetLogging(is_enabled);
+    mArgumentCounts.SetLogging(is_enabled);
+}
+
+RPNConverter::Checkpoint RPNConverter::GetCheckpoint() const
+{
+    return { mStack.GetChangeCount(), mArgumentCounts.GetChangeCount(), mPendingUnary, mTokenCount };
+}
+
+void RPNConverter::Rewind(const Checkpoint& checkpoint)
+{
+    mStack.Rewind(checkpoint.mStackChangeCount);
+    mArgumentCounts.Rewind(checkpoint.mArgumentCountChangeCount);
+    mPendingUnary = checkpoint.mPendingUnary;
+    mTokenCount = checkpoint.mTokenCount;
+
+    mErrorMessage.clear();
+    mLimitViolation = Utils::LimitViolation::None;
+}
+
+void RPNConverter::ResetLimitViolation(std::size_t token_count) noexcept
+{
+    mLimitViolation = Utils::LimitViolation::None;
+    mTokenCount = token_count;
+    mDeadlineCountdown = mLimits.GetDeadlineCheckInterval();
 }
 
 bool RPNConverter::HasError() const noexcept
@@ -130,7 +543,17 @@ const QString& RPNConverter::GetErrorMessage() const noexcept
     return mErrorMessage;
 }
 
-inline std::int32_t RPNConverter::GetOperatorPriority(const QString& op) noexcept
+void RPNConverter::SetLimits(const Utils::ResourceLimits& limits) noexcept
+{
+    mLimits = limits;
+}
+
+Utils::LimitViolation RPNConverter::GetLimitViolation() const noexcept
+{
+    return mLimitViolation;
+}
+
+std::int32_t RPNConverter::GetOperatorPriority(const QString& op) noexcept
 {
     if (Utils::EqualsAnyOf(op, QStringLiteral("+"), QStringLiteral("-")))
     {
@@ -22,12 +22,19 @@
 
 #pragma once
 
-#include <stack>
+#include <tuple>
+#include <span>
+#include <vector>
+#include <optional>
 
 #include <QString>
 
 #include <tokenizer.hpp>
+#include <token-stream.hpp>
+#include <math-functions.hpp>
 #include <custom-predicates.hpp>
+#include <resource-limits.hpp>
+#include <undo-stack.hpp>
 
 class RPNConverter
 {
@@ -36,12 +43,66 @@ public:
     ~RPNConverter() noexcept = default;
 
     [[nodiscard]] std::vector<Tokenizer::TokenPair> Convert(const std::vector<Tokenizer::TokenPair>& input);
+
+    // Writes into the caller's buffer, which is cleared first and left empty on error.
+    [[nodiscard]] bool Convert(const std::vector<Tokenizer::TokenPair>& input, std::vector<Tokenizer::TokenPair>& output);
+
+    // Conversion of one expression handed over in consecutive parts, e.g. by the streaming Tokenizer::Run: 
+    // BeginParts, ConvertPart for every part in order, then FinishParts. The operator stack carries over, 
+    // every call appends the RPN completed so far to output, which the caller may consume and clear in between.
+    void BeginParts();
+    [[nodiscard]] bool ConvertPart(std::span<const Tokenizer::TokenPair> input, std::vector<Tokenizer::TokenPair>& output);
+    [[nodiscard]] bool FinishParts(std::vector<Tokenizer::TokenPair>& output);
+
+    // Where a conversion in parts stands, see Rewind.
+    struct Checkpoint
+    {
+        std::size_t mStackChangeCount;
+        std::size_t mArgumentCountChangeCount;
+        std::optional<Tokenizer::TokenPair> mPendingUnary;
+        std::size_t mTokenCount;
+    };
+
+    // A conversion in parts which can be taken back, e.g. one token per ConvertPart while the input is edited 
+    // at its tail, see IncrementalEvaluator. With undo logging on, the stacks log their changes from the next 
+    // BeginParts on. Rewind undoes those after a checkpoint of the same conversion and clears the error.
+    void SetUndoLogging(bool is_enabled) noexcept;
+    [[nodiscard]] Checkpoint GetCheckpoint() const;
+    void Rewind(const Checkpoint& checkpoint);
+
+    // Same conversion over the arrays of a TokenStream, the operator stack holds token indices.
+    // Reads only the kinds to decide, values and offsets are copied to the output as they are.
+    [[nodiscard]] bool Convert(const TokenStream& input, TokenStream& output);
+
     [[nodiscard]] bool HasError() const noexcept;
     [[nodiscard]] const QString& GetErrorMessage() const noexcept;
 
+    // Token count, nesting depth and deadline, unlimited by default. Parts of one expression count together.
+    void SetLimits(const Utils::ResourceLimits& limits) noexcept;
+    [[nodiscard]] Utils::LimitViolation GetLimitViolation() const noexcept;
+
+    [[nodiscard]] static std::int32_t GetOperatorPriority(const QString& op) noexcept;
+
 private:
-    [[nodiscard]] static inline std::int32_t GetOperatorPriority(const QString& op) noexcept;
+    [[nodiscard]] bool CloseFunctionCall(std::size_t argument_count, std::vector<Tokenizer::TokenPair>& output);
+    [[nodiscard]] bool CloseFunctionCall(std::size_t argument_count, const TokenStream& input, TokenStream& output);
+
+    void ResetLimitViolation(std::size_t token_count) noexcept;
 
 private:
+    Utils::UndoStack<Tokenizer::TokenPair> mStack;
+    std::vector<std::uint32_t> mIndexStack;
+    
+    // Arguments seen so far in every open parenthesis, only meaningful for function calls.
+    Utils::UndoStack<std::size_t> mArgumentCounts;
+
+    // A unary minus ending a part, it goes to the stack or the output depending on the next token.
+    std::optional<Tokenizer::TokenPair> mPendingUnary;
+
+    Utils::ResourceLimits mLimits;
+    Utils::LimitViolation mLimitViolation{};
+    std::size_t mTokenCount{};
+    std::uint32_t mDeadlineCountdown{};
+
     QString mErrorMessage;
 };
@@ -0,0 +1,242 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rpn-reassociator.hpp"
+
+#include <bit>
+#include <deque>
+#include <iterator>
+
+#include <math-functions.hpp>
+
+namespace
+{
+    using Tokens = std::vector<Tokenizer::TokenPair>;
+
+    // RPN of a subexpression, or the operands of a chain which may still grow.
+    struct Fragment
+    {
+        Tokens mTokens;
+        std::deque<Tokens> mOperands;
+        const Tokenizer::TokenPair* mOperator;
+    };
+
+    [[nodiscard]] bool IsAssociative(const QString& op) noexcept
+    {
+        return op == QStringLiteral("+") || op == QStringLiteral("*");
+    }
+
+    void Append(Tokens& destination, Tokens&& source)
+    {
+        if (std::empty(destination))
+        {
+            destination = std::move(source);
+            return;
+        }
+
+        destination.insert(std::end(destination), std::make_move_iterator(std::begin(source)), std::make_move_iterator(std::end(source)));
+    }
+
+    // Node (level, index) of the level by level reduction covers the operands [index * 2^level, (index + 1) * 2^level).
+    void EmitBalanced(std::deque<Tokens>& operands, const Tokenizer::TokenPair& op, std::size_t level, std::size_t index, Tokens& output)
+    {
+        if (level == 0)
+        {
+            Append(output, std::move(operands[index]));
+            return;
+        }
+
+        EmitBalanced(operands, op, level - 1, 2 * index, output);
+
+        // Without a right half the operand moves up a level unchanged.
+        if (((2 * index + 1) << (level - 1)) < std::size(operands))
+        {
+            EmitBalanced(operands, op, level - 1, 2 * index + 1, output);
+            output.push_back(op);
+        }
+    }
+
+    // Turns an open chain into its tokens.
+    void Close(Fragment& fragment, RPNReassociator::Shape shape)
+    {
+        if (fragment.mOperator == nullptr)
+        {
+            return;
+        }
+
+        auto& operands{ fragment.mOperands };
+
+        if (shape == RPNReassociator::Shape::Balanced)
+        {
+            EmitBalanced(operands, *fragment.mOperator, std::bit_width(std::size(operands) - 1), 0, fragment.mTokens);
+        }
+        else
+        {
+            for (auto& operand : operands)
+            {
+                Append(fragment.mTokens, std::move(operand));
+            }
+
+            fragment.mTokens.insert(std::end(fragment.mTokens), std::size(operands) - 1, *fragment.mOperator);
+        }
+
+        operands.clear();
+        fragment.mOperator = nullptr;
+    }
+
+    // Joins first op second, both chains are merged into the larger one so long chains are not copied again and again.
+    [[nodiscard]] Fragment Chain(Fragment&& first, Fragment&& second, const Tokenizer::TokenPair& op, RPNReassociator::Shape shape)
+    {
+        auto IsChainOf = [&op](const Fragment& fragment) { return fragment.mOperator != nullptr && fragment.mOperator->mLexeme == op.mLexeme; };
+
+        if (!IsChainOf(first))
+        {
+            Close(first, shape);
+            first.mOperands.push_back(std::move(first.mTokens));
+            first.mTokens.clear();
+            first.mOperator = &op;
+        }
+
+        if (!IsChainOf(second))
+        {
+            Close(second, shape);
+            second.mOperands.push_back(std::move(second.mTokens));
+            second.mTokens.clear();
+            second.mOperator = &op;
+        }
+
+        if (std::size(first.mOperands) >= std::size(second.mOperands))
+        {
+            std::move(std::begin(second.mOperands), std::end(second.mOperands), std::back_inserter(first.mOperands));
+            return std::move(first);
+        }
+
+        std::move(std::rbegin(first.mOperands), std::rend(first.mOperands), std::front_inserter(second.mOperands));
+        return std::move(second);
+    }
+}
+
+std::vector<Tokenizer::TokenPair> RPNReassociator::Reassociate(const std::vector<Tokenizer::TokenPair>& rpn_expression, Shape shape)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+
+    std::vector<Fragment> stack{};
+    const Tokenizer::TokenPair* sign{ nullptr };
+
+    // A malformed expression is given back as it is, for the caller's own validation to report, 
+    // as soon as an operator or a call lacks operands or the function is unknown.
+
+    for (const auto& token_pair : rpn_expression)
+    {
+        switch (token_pair.mToken)
+        {
+        // Belongs to the next operand or call, it is emitted together with it.
+        case Tokenizer::Token::UnaryOperator:
+        {
+            sign = &token_pair;
+            break;
+        }
+
+        case Tokenizer::Token::Integer:
+        case Tokenizer::Token::FloatingPoint:
+        case Tokenizer::Token::Identifier:
+        {
+            Fragment operand{};
+            if (sign != nullptr) { operand.mTokens.push_back(*sign); }
+            operand.mTokens.push_back(token_pair);
+
+            sign = nullptr;
+            stack.push_back(std::move(operand));
+            break;
+        }
+
+        case Tokenizer::Token::Operator:
+        {
+            if (std::size(stack) < 2)
+            {
+                return rpn_expression;
+            }
+
+            auto second{ std::move(stack.back()) };
+            stack.pop_back();
+
+            auto first{ std::move(stack.back()) };
+            stack.pop_back();
+
+            if (IsAssociative(token_pair.mLexeme))
+            {
+                stack.push_back(Chain(std::move(first), std::move(second), token_pair, shape));
+                break;
+            }
+
+            Close(first, shape);
+            Close(second, shape);
+
+            Append(first.mTokens, std::move(second.mTokens));
+            first.mTokens.push_back(token_pair);
+
+            stack.push_back(std::move(first));
+            break;
+        }
+
+        case Tokenizer::Token::Function:
+        {
+            const auto* descriptor{ MathFunctions::Find(token_pair.mLexeme) };
+            if (descriptor == nullptr || std::size(stack) < descriptor->mArity)
+            {
+                return rpn_expression;
+            }
+
+            const auto arguments_begin{ std::size(stack) - descriptor->mArity };
+
+            Fragment call{};
+            for (auto i{ arguments_begin }; i < std::size(stack); ++i)
+            {
+                Close(stack[i], shape);
+                Append(call.mTokens, std::move(stack[i].mTokens));
+            }
+
+            if (sign != nullptr) { call.mTokens.push_back(*sign); }
+            call.mTokens.push_back(token_pair);
+
+            sign = nullptr;
+            stack.resize(arguments_begin);
+            stack.push_back(std::move(call));
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+        }
+    }
+
+    // Anything but one value with no sign left over is malformed as well.
+    if (std::size(stack) != 1 || sign != nullptr)
+    {
+        return rpn_expression;
+    }
+
+    Close(stack.back(), shape);
+    return std::move(stack.back().mTokens);
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Opt-in pass over the converter's output which regroups chains of one associative operator, 
+    e.g. the left-deep "a b + c + d +" of a+b+c+d, where every addition waits for the previous one. 
+    It changes the floating point rounding, so nothing applies it implicitly.
+
+    Balanced    the chain becomes the tree of the level by level pairwise reduction, "a b + c d + +": 
+                independent operations the CPU can overlap and a rounding error growing with log2 of the length.
+    Flat        the operands are followed by the n - 1 operators, "a b c d + + +". A run of k equal operators 
+                then combines the top k + 1 values, which RPNCompiler turns into one reduction instruction 
+                with the same rounding as Balanced.
+
+    Only + and * chains are regrouped, a unary minus stays with the operand or the call it belongs to.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <tokenizer.hpp>
+
+class RPNReassociator
+{
+public:
+    enum class Shape : std::uint8_t
+    {
+        Balanced,
+        Flat
+    };
+
+public:
+    RPNReassociator() = default;
+    ~RPNReassociator() noexcept = default;
+
+    // Expects a valid RPN expression, as produced by RPNConverter. A malformed one, e.g. with an operator 
+    // lacking operands or an unknown function, is returned unchanged.
+    [[nodiscard]] static std::vector<Tokenizer::TokenPair> Reassociate(const std::vector<Tokenizer::TokenPair>& rpn_expression, Shape shape = Shape::Balanced);
+};
\ No newline at end of file
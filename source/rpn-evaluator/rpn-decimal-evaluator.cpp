@@ -0,0 +1,203 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rpn-decimal-evaluator.hpp"
+
+#include <string_view>
+#include <utility>
+
+#include <QStringView>
+
+RPNDecimalEvaluator::RPNDecimalEvaluator() :
+    mOperands{}, mErrorMessage{}
+{ }
+
+Utils::Decimal RPNDecimalEvaluator::Evaluate(const std::vector<Tokenizer::TokenPair>& rpn_expression)
+{
+    Utils::Unlimited governor{};
+    return EvaluateTokens(rpn_expression, governor).value_or(Utils::Decimal{});
+}
+
+Utils::Decimal RPNDecimalEvaluator::Evaluate(const std::vector<Tokenizer::TokenPair>& rpn_expression, 
+    const Utils::ResourceLimits& limits, Utils::LimitViolation& violation)
+{
+    Utils::EvaluationGovernor governor{ limits, violation };
+    auto result{ EvaluateTokens(rpn_expression, governor) };
+
+    if (violation != Utils::LimitViolation::None)
+    {
+        mErrorMessage = Utils::DescribeLimitViolation(violation, limits);
+    }
+
+    return std::move(result).value_or(Utils::Decimal{});
+}
+
+// The governor is asked before every token and after the last one, see Utils::EvaluationGovernor.
+template <typename TGovernor>
+std::optional<Utils::Decimal> RPNDecimalEvaluator::EvaluateTokens(const std::vector<Tokenizer::TokenPair>& rpn_expression, TGovernor& governor)
+{
+    mErrorMessage.clear();
+
+    mOperands.clear();
+    bool is_negative{ false };
+
+    for (std::size_t i{}; i < std::size(rpn_expression); ++i)
+    {
+        if (governor.IsExceeded(std::size(mOperands)))
+        {
+            return std::nullopt;
+        }
+
+        const auto& [lexeme, token, value]{ rpn_expression[i] };
+
+        switch (token)
+        {
+        case Tokenizer::Token::Integer:
+        case Tokenizer::Token::FloatingPoint:
+        {
+            const QStringView text{ lexeme };
+
+            auto num{ Utils::Decimal::FromString(std::u16string_view{ text.utf16(), static_cast<std::size_t>(std::size(text)) }) };
+            if (is_negative)
+            {
+                num = -num;
+                is_negative = false;
+            }
+
+            mOperands.push_back(std::move(num));
+            break;
+        }
+
+        case Tokenizer::Token::UnaryOperator:
+        {
+            is_negative = true;
+            break;
+        }
+
+        case Tokenizer::Token::Identifier:
+        {
+            mErrorMessage = QStringLiteral("variables are not supported in decimal mode");
+            return std::nullopt;
+        }
+
+        // Transcendental results are not exact, so there is nothing to gain from a decimal evaluation.
+        case Tokenizer::Token::Function:
+        {
+            mErrorMessage = QStringLiteral("functions are not supported in decimal mode");
+            return std::nullopt;
+        }
+
+        case Tokenizer::Token::Operator:
+        {
+            const auto second_operand{ std::move(mOperands.back()) };
+            mOperands.pop_back();
+
+            auto result{ ApplyOperator(lexeme, mOperands.back(), second_operand) };
+            if (!result)
+            {
+                return std::nullopt;
+            }
+
+            mOperands.back() = std::move(*result);
+            break;
+        }
+
+        // The converter leaves no parentheses or separators in the RPN.
+        case Tokenizer::Token::LeftParenthesis:
+        case Tokenizer::Token::RightParenthesis:
+        case Tokenizer::Token::Separator:
+            break;
+        }
+    }
+
+    if (governor.IsExceeded(std::size(mOperands)))
+    {
+        return std::nullopt;
+    }
+
+    return mOperands.back();
+}
+
+bool RPNDecimalEvaluator::HasError() const noexcept
+{
+    return !mErrorMessage.isEmpty();
+}
+
+const QString& RPNDecimalEvaluator::GetErrorMessage() const noexcept
+{
+    return mErrorMessage;
+}
+
+std::optional<Utils::Decimal> RPNDecimalEvaluator::ApplyOperator(const QString& op, const Utils::Decimal& first_operand, const Utils::Decimal& second_operand)
+{
+    if (op == QStringLiteral("+"))
+    {
+        return first_operand + second_operand;
+    }
+
+    if (op == QStringLiteral("-"))
+    {
+        return first_operand - second_operand;
+    }
+
+    if (op == QStringLiteral("*"))
+    {
+        return first_operand * second_operand;
+    }
+
+    if (op == QStringLiteral("/"))
+    {
+        auto quotient{ Utils::Decimal::Divide(first_operand, second_operand) };
+        if (!quotient)
+        {
+            mErrorMessage = QStringLiteral("division by zero");
+        }
+
+        return quotient;
+    }
+
+    if (op == QStringLiteral("^"))
+    {
+        if (!second_operand.IsInteger())
+        {
+            mErrorMessage = QStringLiteral("only integer exponents are exact");
+            return std::nullopt;
+        }
+
+        if (Utils::Decimal::IsPowerTooLong(first_operand, second_operand))
+        {
+            mErrorMessage = QStringLiteral("power longer than %1 digits").arg(Utils::Decimal::kMaxPowerDigits);
+            return std::nullopt;
+        }
+
+        auto power{ Utils::Decimal::Pow(first_operand, second_operand) };
+        if (!power)
+        {
+            mErrorMessage = first_operand.IsZero() ? QStringLiteral("division by zero") : QStringLiteral("exponent is too large");
+        }
+
+        return power;
+    }
+
+    mErrorMessage = QStringLiteral("unknown operator");
+    return std::nullopt;
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Evaluates an RPN expression with exact decimal arithmetic, so e.g. 0.1 + 0.2 is exactly 0.3.
+    Slower than RPNEvaluator once the values leave the inline int64 range.
+
+    Literals are parsed straight from the UTF-16 lexemes and the operand stack keeps its capacity 
+    between evaluations, so as long as the values stay inline a reused evaluator does not allocate.
+*/
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <QString>
+
+#include <decimal.hpp>
+#include <tokenizer.hpp>
+#include <resource-limits.hpp>
+
+class RPNDecimalEvaluator
+{
+public:
+    RPNDecimalEvaluator();
+    ~RPNDecimalEvaluator() noexcept = default;
+
+    [[nodiscard]] Utils::Decimal Evaluate(const std::vector<Tokenizer::TokenPair>& rpn_expression);
+
+    // Checks the operand stack depth and the deadline of limits on the way, like RPNEvaluator. 
+    // A violation is also an error, described by Utils::DescribeLimitViolation.
+    [[nodiscard]] Utils::Decimal Evaluate(const std::vector<Tokenizer::TokenPair>& rpn_expression, 
+        const Utils::ResourceLimits& limits, Utils::LimitViolation& violation);
+
+    [[nodiscard]] bool HasError() const noexcept;
+    [[nodiscard]] const QString& GetErrorMessage() const noexcept;
+
+private:
+    template <typename TGovernor>
+    [[nodiscard]] std::optional<Utils::Decimal> EvaluateTokens(const std::vector<Tokenizer::TokenPair>& rpn_expression, TGovernor& governor);
+
+    [[nodiscard]] std::optional<Utils::Decimal> ApplyOperator(const QString& op, const Utils::Decimal& first_operand, const Utils::Decimal& second_operand);
+
+private:
+    std::vector<Utils::Decimal> mOperands;
+    QString mErrorMessage;
+};
\ No newline at end of file
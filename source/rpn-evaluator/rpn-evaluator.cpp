@@ -22,75 +22,250 @@
 
 #include "rpn-evaluator.hpp"
 
-double RPNEvaluator::Evaluate(const std::vector<Tokenizer::TokenPair>& rpn_expression)
+#include <limits>
+
+namespace
+{
+    // False if the governor stopped the evaluation. TOperands is std::vector<double> or Utils::UndoStack<double>.
+    template <typename TOperands, typename TGovernor>
+    [[nodiscard]] bool EvaluateTokens(std::span<const Tokenizer::TokenPair> rpn_part, TOperands& operands, double& pending_sign, TGovernor& governor);
+}
+
+double RPNEvaluator::Evaluate(std::span<const Tokenizer::TokenPair> rpn_expression)
+{
+    std::vector<double> operands{};
+    return Evaluate(rpn_expression, operands);
+}
+
+double RPNEvaluator::Evaluate(std::span<const Tokenizer::TokenPair> rpn_expression, std::vector<double>& operands)
+{
+    operands.clear();
+    double sign{ 1.0 };
+
+    EvaluatePart(rpn_expression, operands, sign);
+    return operands.back();
+}
+
+void RPNEvaluator::EvaluatePart(std::span<const Tokenizer::TokenPair> rpn_part, std::vector<double>& operands, double& pending_sign)
+{
+    Utils::Unlimited governor{};
+    std::ignore = EvaluateTokens(rpn_part, operands, pending_sign, governor);
+}
+
+bool RPNEvaluator::EvaluatePart(std::span<const Tokenizer::TokenPair> rpn_part, Utils::UndoStack<double>& operands, double& pending_sign, 
+    Utils::EvaluationGovernor& governor)
+{
+    return EvaluateTokens(rpn_part, operands, pending_sign, governor);
+}
+
+double RPNEvaluator::Evaluate(std::span<const Tokenizer::TokenPair> rpn_expression, std::vector<double>& operands, 
+    const Utils::ResourceLimits& limits, Utils::LimitViolation& violation)
 {
-    std::stack<double> stack{};
+    operands.clear();
     double sign{ 1.0 };
 
-    for (std::size_t i{}; i < std::size(rpn_expression); ++i)
+    Utils::EvaluationGovernor governor{ limits, violation };
+
+    if (!EvaluateTokens(rpn_expression, operands, sign, governor))
     {
-        const auto& [lexeme, token]{ rpn_expression[i] };
-        
-        switch (token) 
-        {
-        case Tokenizer::Token::Integer:
-        case Tokenizer::Token::FloatingPoint:
-        {
-            const auto num{ lexeme.toDouble() * sign };
-            sign = 1.0;
+        return std::numeric_limits<double>::quiet_NaN();
+    }
 
-            stack.push(num);
-            break;
-        }
+    return operands.back();
+}
 
-        case Tokenizer::Token::UnaryOperator:
-        {
-            sign = -1.0;
-            break;
-        }
+namespace
+{
+    template <typename TOperands, typename TGovernor>
+    bool EvaluateTokens(std::span<const Tokenizer::TokenPair> rpn_part, TOperands& operands, double& pending_sign, TGovernor& governor)
+    {
+        // A local copy, so the loop does not go through the reference.
+        auto sign{ pending_sign };
 
-        case Tokenizer::Token::Operator:
+        for (std::size_t i{}; i < std::size(rpn_part); ++i)
         {
-            const auto second_operand{ stack.top() };
-            stack.pop();
+            if (governor.IsExceeded(std::size(operands)))
+            {
+                return false;
+            }
 
-            const auto first_operand{ stack.top() };
-            stack.pop();
+            const auto& [lexeme, token, value]{ rpn_part[i] };
 
-            if (lexeme == QStringLiteral("+"))
+            switch (token) 
+            {
+            case Tokenizer::Token::Integer:
+            case Tokenizer::Token::FloatingPoint:
             {
-                stack.push(second_operand + first_operand);
+                const auto num{ value * sign };
+                sign = 1.0;
+
+                operands.push_back(num);
                 break;
             }
 
-            if (lexeme == QStringLiteral("-"))
+            case Tokenizer::Token::UnaryOperator:
             {
-                stack.push(first_operand - second_operand);
+                sign = -1.0;
                 break;
             }
 
-            if (lexeme == QStringLiteral("/"))
+            // Variables are bound only by a compiled RPNProgram, here they are unknown.
+            case Tokenizer::Token::Identifier:
             {
-                stack.push(first_operand / second_operand);
+                operands.push_back(std::numeric_limits<double>::quiet_NaN());
+                sign = 1.0;
                 break;
             }
 
-            if (lexeme == QStringLiteral("*"))
+            case Tokenizer::Token::Operator:
             {
-                stack.push(first_operand * second_operand);
+                const auto second_operand{ operands.back() };
+                operands.pop_back();
+
+                const auto first_operand{ operands.back() };
+                operands.pop_back();
+
+                operands.push_back(RPNEvaluator::ApplyOperator(lexeme, first_operand, second_operand));
                 break;
             }
 
-            if (lexeme == QStringLiteral("^"))
+            // The converter places a pending unary minus right before the call, it applies to the result.
+            case Tokenizer::Token::Function:
             {
-                stack.push(std::pow(first_operand, second_operand));
+                const auto& descriptor{ *MathFunctions::Find(lexeme) };
+                const auto arguments_begin{ std::size(operands) - descriptor.mArity };
+
+                const auto result{ MathFunctions::Apply(descriptor.mId, std::span{ operands }.subspan(arguments_begin)) * sign };
+                sign = 1.0;
+
+                operands.resize(arguments_begin);
+                operands.push_back(result);
+                break;
+            }
+
+            // The converter leaves no parentheses or separators in the RPN.
+            case Tokenizer::Token::LeftParenthesis:
+            case Tokenizer::Token::RightParenthesis:
+            case Tokenizer::Token::Separator:
                 break;
             }
+        }
+
+        pending_sign = sign;
+        return !governor.IsExceeded(std::size(operands));
+    }
+}
+
+double RPNEvaluator::Evaluate(const TokenStream& rpn_expression)
+{
+    std::vector<double> operands{};
+    return Evaluate(rpn_expression, operands);
+}
 
+double RPNEvaluator::Evaluate(const TokenStream& rpn_expression, std::vector<double>& operands)
+{
+    using Kind = TokenStream::Kind;
+
+    operands.clear();
+    double sign{ 1.0 };
+
+    const auto kinds{ rpn_expression.GetKinds() };
+    const auto values{ rpn_expression.GetValues() };
+
+    for (std::size_t i{}; i < std::size(kinds); ++i)
+    {
+        switch (kinds[i])
+        {
+        case Kind::Number:
+        {
+            operands.push_back(values[i] * sign);
+            sign = 1.0;
+            break;
+        }
+
+        case Kind::Negate:
+        {
+            sign = -1.0;
+            break;
+        }
+
+        case Kind::Identifier:
+        {
+            operands.push_back(std::numeric_limits<double>::quiet_NaN());
+            sign = 1.0;
             break;
         }
+
+        case Kind::Add:
+        case Kind::Subtract:
+        case Kind::Multiply:
+        case Kind::Divide:
+        case Kind::Power:
+        {
+            const auto second_operand{ operands.back() };
+            operands.pop_back();
+
+            auto& first_operand{ operands.back() };
+            switch (kinds[i])
+            {
+            case Kind::Add:      first_operand += second_operand; break;
+            case Kind::Subtract: first_operand -= second_operand; break;
+            case Kind::Multiply: first_operand *= second_operand; break;
+            case Kind::Divide:   first_operand /= second_operand; break;
+            default:             first_operand = MathFunctions::Power(first_operand, second_operand); break;
+            }
+
+            break;
         }
+
+        case Kind::Function:
+        {
+            const auto& descriptor{ MathFunctions::Get(static_cast<MathFunctions::Id>(values[i])) };
+            const auto arguments_begin{ std::size(operands) - descriptor.mArity };
+
+            const auto result{ MathFunctions::Apply(descriptor.mId, std::span{ operands }.subspan(arguments_begin)) * sign };
+            sign = 1.0;
+
+            operands.resize(arguments_begin);
+            operands.push_back(result);
+            break;
+        }
+
+        // A converted stream holds no parentheses or separators.
+        default:
+            break;
+        }
+    }
+
+    return operands.back();
+}
+
+double RPNEvaluator::ApplyOperator(const QString& op, double first_operand, double second_operand) noexcept
+{
+    if (op == QStringLiteral("+"))
+    {
+        return first_operand + second_operand;
+    }
+
+    if (op == QStringLiteral("-"))
+    {
+        return first_operand - second_operand;
+    }
+
+    if (op == QStringLiteral("/"))
+    {
+        return first_operand / second_operand;
+    }
+
+    if (op == QStringLiteral("*"))
+    {
+        return first_operand * second_operand;
+    }
+
+    if (op == QStringLiteral("^"))
+    {
+        return MathFunctions::Power(first_operand, second_operand);
     }
 
-    return stack.top();
+    return 0.0;
 }
\ No newline at end of file
@@ -22,10 +22,14 @@
 
 #pragma once
 
-#include <stack>
+#include <span>
 #include <vector>
 
 #include <tokenizer.hpp>
+#include <token-stream.hpp>
+#include <math-functions.hpp>
+#include <resource-limits.hpp>
+#include <undo-stack.hpp>
 
 class RPNEvaluator
 {
@@ -33,5 +37,29 @@ public:
     RPNEvaluator() = default;
     ~RPNEvaluator() noexcept = default;
 
-    [[nodiscard]] static double Evaluate(const std::vector<Tokenizer::TokenPair>& rpn_expression);
+    [[nodiscard]] static double Evaluate(std::span<const Tokenizer::TokenPair> rpn_expression);
+
+    // Uses the caller's operand buffer, which keeps its capacity between evaluations.
+    [[nodiscard]] static double Evaluate(std::span<const Tokenizer::TokenPair> rpn_expression, std::vector<double>& operands);
+
+    // Evaluates an RPN expression given in consecutive parts, e.g. by RPNConverter::ConvertPart. Operands and 
+    // a unary minus not yet applied carry over between the calls, start with no operands and pending_sign 1.0. 
+    // Only the operands still waiting for an operator are kept, the result is the last operand after the last part.
+    static void EvaluatePart(std::span<const Tokenizer::TokenPair> rpn_part, std::vector<double>& operands, double& pending_sign);
+
+    // The same on operands which can log their changes, so a part can be taken back, see IncrementalEvaluator. The 
+    // governor is kept by the caller across the parts, so its deadline countdown carries over. False when it stopped.
+    [[nodiscard]] static bool EvaluatePart(std::span<const Tokenizer::TokenPair> rpn_part, Utils::UndoStack<double>& operands, double& pending_sign, 
+        Utils::EvaluationGovernor& governor);
+
+    // Checks the operand stack depth and the deadline of limits on the way. 
+    // When one is exceeded the evaluation stops, violation tells which and NaN is returned.
+    [[nodiscard]] static double Evaluate(std::span<const Tokenizer::TokenPair> rpn_expression, std::vector<double>& operands, 
+        const Utils::ResourceLimits& limits, Utils::LimitViolation& violation);
+
+    // The same over a converted TokenStream, reads only the kinds and the values.
+    [[nodiscard]] static double Evaluate(const TokenStream& rpn_expression);
+    [[nodiscard]] static double Evaluate(const TokenStream& rpn_expression, std::vector<double>& operands);
+
+    [[nodiscard]] static double ApplyOperator(const QString& op, double first_operand, double second_operand) noexcept;
 };
\ No newline at end of file
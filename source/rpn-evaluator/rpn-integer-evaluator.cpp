@@ -0,0 +1,249 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rpn-integer-evaluator.hpp"
+
+#include <algorithm>
+#include <optional>
+
+namespace
+{
+    // Every integer up to 2^53 is exactly representable as a double.
+    constexpr double kMaxExactDouble{ 9007199254740992.0 };
+
+    [[nodiscard]] bool IsIntegerToken(const Tokenizer::TokenPair& token_pair) noexcept
+    {
+        const auto token{ token_pair.mToken };
+        return token == Tokenizer::Token::Integer || token == Tokenizer::Token::UnaryOperator || token == Tokenizer::Token::Operator;
+    }
+
+    // Parses the lexeme instead of using the token value, which is exact only up to 2^53.
+    [[nodiscard]] std::optional<std::int64_t> ParseLiteral(const QString& lexeme) noexcept
+    {
+        std::int64_t value{};
+
+        for (const auto digit : lexeme)
+        {
+            if (__builtin_mul_overflow(value, 10, &value) || __builtin_add_overflow(value, digit.unicode() - u'0', &value))
+            {
+                return std::nullopt;
+            }
+        }
+
+        return value;
+    }
+
+    [[nodiscard]] RPNIntegerEvaluator::Result Power(std::int64_t base, std::int64_t exponent) noexcept
+    {
+        using Outcome = RPNIntegerEvaluator::Outcome;
+
+        if (exponent < 0)
+        {
+            if (base == 1)  { return { Outcome::Exact, 1 }; }
+            if (base == -1) { return { Outcome::Exact, exponent % 2 == 0 ? 1 : -1 }; }
+
+            return { Outcome::Inexact, 0 };
+        }
+
+        // Square and multiply, the last square is skipped so it cannot report a spurious overflow.
+        std::int64_t result{ 1 };
+
+        while (exponent != 0)
+        {
+            if ((exponent & 1) != 0 && __builtin_mul_overflow(result, base, &result))
+            {
+                return { Outcome::Overflow, 0 };
+            }
+
+            exponent >>= 1;
+
+            if (exponent != 0 && __builtin_mul_overflow(base, base, &base))
+            {
+                return { Outcome::Overflow, 0 };
+            }
+        }
+
+        return { Outcome::Exact, result };
+    }
+
+    [[nodiscard]] RPNIntegerEvaluator::Result ApplyOperator(QChar op, std::int64_t first_operand, std::int64_t second_operand) noexcept
+    {
+        using Outcome = RPNIntegerEvaluator::Outcome;
+
+        std::int64_t result{};
+        bool overflow{ false };
+
+        switch (op.unicode())
+        {
+        case u'+': overflow = __builtin_add_overflow(first_operand, second_operand, &result); break;
+        case u'-': overflow = __builtin_sub_overflow(first_operand, second_operand, &result); break;
+        case u'*': overflow = __builtin_mul_overflow(first_operand, second_operand, &result); break;
+
+        case u'/':
+        {
+            if (second_operand == 0)
+            {
+                return { Outcome::Inexact, 0 };
+            }
+
+            // INT64_MIN / -1 is the only quotient which overflows, the remainder would trap on it as well.
+            if (second_operand == -1)
+            {
+                overflow = __builtin_sub_overflow(std::int64_t{}, first_operand, &result);
+                break;
+            }
+
+            if (first_operand % second_operand != 0)
+            {
+                return { Outcome::Inexact, 0 };
+            }
+
+            result = first_operand / second_operand;
+            break;
+        }
+
+        case u'^': return Power(first_operand, second_operand);
+        }
+
+        return { overflow ? Outcome::Overflow : Outcome::Exact, result };
+    }
+
+    // The governor is asked before every token and after the last one, see Utils::EvaluationGovernor.
+    template <typename TGovernor>
+    [[nodiscard]] RPNIntegerEvaluator::Result EvaluateTokens(const std::vector<Tokenizer::TokenPair>& rpn_expression, std::vector<std::int64_t>& operands, TGovernor& governor)
+    {
+        using Outcome = RPNIntegerEvaluator::Outcome;
+
+        // On a failure the rest is still scanned, an overflow must not hide that the expression is not integer only.
+        auto Stop = [&rpn_expression](Outcome outcome, std::size_t next) -> RPNIntegerEvaluator::Result
+        {
+            const auto is_integer{ std::all_of(std::begin(rpn_expression) + static_cast<std::ptrdiff_t>(next), 
+                std::end(rpn_expression), IsIntegerToken) };
+
+            return { is_integer ? outcome : Outcome::NotInteger, 0 };
+        };
+
+        operands.clear();
+        bool is_negative{ false };
+
+        for (std::size_t i{}; i < std::size(rpn_expression); ++i)
+        {
+            if (governor.IsExceeded(std::size(operands)))
+            {
+                return { Outcome::LimitExceeded, 0 };
+            }
+
+            const auto& [lexeme, token, value]{ rpn_expression[i] };
+
+            switch (token)
+            {
+            case Tokenizer::Token::Integer:
+            {
+                // The token value is exact below 2^53, only longer literals are parsed again. 
+                // Larger values are never converted, from 2^63 on the conversion is undefined.
+                std::int64_t literal{};
+
+                if (value < kMaxExactDouble)
+                {
+                    literal = static_cast<std::int64_t>(value);
+                }
+                else
+                {
+                    const auto parsed{ ParseLiteral(lexeme) };
+                    if (!parsed)
+                    {
+                        return Stop(Outcome::Overflow, i + 1);
+                    }
+
+                    literal = *parsed;
+                }
+
+                operands.push_back(is_negative ? -literal : literal);
+                is_negative = false;
+                break;
+            }
+
+            case Tokenizer::Token::UnaryOperator:
+            {
+                is_negative = true;
+                break;
+            }
+
+            case Tokenizer::Token::Operator:
+            {
+                const auto second_operand{ operands.back() };
+                operands.pop_back();
+
+                const auto [outcome, result]{ ApplyOperator(lexeme[0], operands.back(), second_operand) };
+                if (outcome != Outcome::Exact)
+                {
+                    return Stop(outcome, i + 1);
+                }
+
+                operands.back() = result;
+                break;
+            }
+
+            default:
+            {
+                return { Outcome::NotInteger, 0 };
+            }
+            }
+        }
+
+        if (std::empty(operands))
+        {
+            return { Outcome::NotInteger, 0 };
+        }
+
+        if (governor.IsExceeded(std::size(operands)))
+        {
+            return { Outcome::LimitExceeded, 0 };
+        }
+
+        return { Outcome::Exact, operands.back() };
+    }
+}
+
+RPNIntegerEvaluator::Result RPNIntegerEvaluator::Evaluate(const std::vector<Tokenizer::TokenPair>& rpn_expression)
+{
+    std::vector<std::int64_t> operands{};
+    return Evaluate(rpn_expression, operands);
+}
+
+RPNIntegerEvaluator::Result RPNIntegerEvaluator::Evaluate(const std::vector<Tokenizer::TokenPair>& rpn_expression, std::vector<std::int64_t>& operands)
+{
+    Utils::Unlimited governor{};
+    return EvaluateTokens(rpn_expression, operands, governor);
+}
+
+RPNIntegerEvaluator::Result RPNIntegerEvaluator::Evaluate(const std::vector<Tokenizer::TokenPair>& rpn_expression, std::vector<std::int64_t>& operands, 
+    const Utils::ResourceLimits& limits, Utils::LimitViolation& violation)
+{
+    Utils::EvaluationGovernor governor{ limits, violation };
+    return EvaluateTokens(rpn_expression, operands, governor);
+}
+
+bool RPNIntegerEvaluator::IsIntegerExpression(const std::vector<Tokenizer::TokenPair>& rpn_expression) noexcept
+{
+    return !std::empty(rpn_expression) && std::all_of(std::begin(rpn_expression), std::end(rpn_expression), IsIntegerToken);
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Evaluates an RPN expression whose literals are all integers in std::int64_t, exactly.
+    Every operation is overflow checked, the outcome tells the caller when and why 
+    the expression has to be evaluated again with doubles or with Utils::Decimal.
+
+    Semantics of the operators which can leave the integers:
+        a / b   exact quotient, Inexact when b divides a with a remainder or b is 0.
+        a ^ b   exact power for b >= 0 (0^0 is 1), for b < 0 only 1^b and (-1)^b, Inexact otherwise.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <tokenizer.hpp>
+#include <resource-limits.hpp>
+
+class RPNIntegerEvaluator
+{
+public:
+    enum class Outcome : std::uint8_t
+    {
+        Exact,          // mValue holds the result
+        NotInteger,     // floating point literal, variable or function call
+        Inexact,        // the result is not an integer, see the semantics above
+        Overflow,       // an intermediate value or a literal does not fit in std::int64_t
+        LimitExceeded   // only from the governed Evaluate, the violation tells which limit
+    };
+
+    struct Result
+    {
+        Outcome mOutcome;
+        std::int64_t mValue;
+    };
+
+public:
+    RPNIntegerEvaluator() = default;
+    ~RPNIntegerEvaluator() noexcept = default;
+
+    [[nodiscard]] static Result Evaluate(const std::vector<Tokenizer::TokenPair>& rpn_expression);
+
+    // Uses the caller's operand buffer, which keeps its capacity between evaluations.
+    [[nodiscard]] static Result Evaluate(const std::vector<Tokenizer::TokenPair>& rpn_expression, std::vector<std::int64_t>& operands);
+
+    // Checks the operand stack depth and the deadline of limits on the way, like RPNEvaluator.
+    [[nodiscard]] static Result Evaluate(const std::vector<Tokenizer::TokenPair>& rpn_expression, std::vector<std::int64_t>& operands, 
+        const Utils::ResourceLimits& limits, Utils::LimitViolation& violation);
+
+    [[nodiscard]] static bool IsIntegerExpression(const std::vector<Tokenizer::TokenPair>& rpn_expression) noexcept;
+};
\ No newline at end of file
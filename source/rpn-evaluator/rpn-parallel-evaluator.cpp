@@ -0,0 +1,286 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rpn-parallel-evaluator.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include <math-functions.hpp>
+#include <rpn-evaluator.hpp>
+
+namespace
+{
+    constexpr auto kNoToken{ std::numeric_limits<std::size_t>::max() };
+
+    // Node on the path down to the only large child, finished once that child is evaluated.
+    struct PendingNode
+    {
+        std::size_t mRoot;
+        std::size_t mArgumentsBegin;
+        std::size_t mLargeChild;
+    };
+
+    double EvaluateSequentially(std::span<const Tokenizer::TokenPair> rpn_expression)
+    {
+        thread_local std::vector<double> operands{};
+        return RPNEvaluator::Evaluate(rpn_expression, operands);
+    }
+}
+
+RPNParallelEvaluator::RPNParallelEvaluator(std::size_t thread_count, std::size_t grain_size) :
+    mTaskScheduler{ thread_count }, mGrainSize{ std::max(grain_size, std::size_t{ 1 }) }, mSubtreeBegins{}, mOpenSubtrees{}
+{ }
+
+double RPNParallelEvaluator::Evaluate(const std::vector<Tokenizer::TokenPair>& rpn_expression)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+
+    // There is no root to start from, the same result as a failed evaluation.
+    if (std::empty(rpn_expression))
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    BuildTree(rpn_expression);
+    return EvaluateSubtree(rpn_expression, std::size(rpn_expression) - 1);
+}
+
+std::size_t RPNParallelEvaluator::GetThreadCount() const noexcept
+{
+    return mTaskScheduler.GetThreadCount();
+}
+
+void RPNParallelEvaluator::BuildTree(std::span<const Tokenizer::TokenPair> rpn_expression)
+{
+    mSubtreeBegins.resize(std::size(rpn_expression));
+    mOpenSubtrees.clear();
+
+    // A unary minus precedes the literal or identifier it belongs to, or directly precedes a call.
+    auto pending_sign{ kNoToken };
+
+    for (std::size_t i{}; i < std::size(rpn_expression); ++i)
+    {
+        auto begin{ i };
+
+        switch (rpn_expression[i].mToken)
+        {
+        case Tokenizer::Token::Integer:
+        case Tokenizer::Token::FloatingPoint:
+        case Tokenizer::Token::Identifier:
+        {
+            begin = std::min(pending_sign, i);
+            pending_sign = kNoToken;
+            break;
+        }
+
+        case Tokenizer::Token::UnaryOperator:
+        {
+            pending_sign = i;
+            mSubtreeBegins[i] = i;
+            continue;
+        }
+
+        case Tokenizer::Token::Operator:
+        {
+            mOpenSubtrees.pop_back();
+            begin = mOpenSubtrees.back();
+            mOpenSubtrees.pop_back();
+            break;
+        }
+
+        case Tokenizer::Token::Function:
+        {
+            const auto arity{ MathFunctions::Find(rpn_expression[i].mLexeme)->mArity };
+            if (arity == 0)
+            {
+                begin = std::min(pending_sign, i);
+            }
+            else
+            {
+                begin = mOpenSubtrees[std::size(mOpenSubtrees) - arity];
+                mOpenSubtrees.resize(std::size(mOpenSubtrees) - arity);
+            }
+
+            pending_sign = kNoToken;
+            break;
+        }
+
+        default:
+            break;
+        }
+
+        mSubtreeBegins[i] = begin;
+        mOpenSubtrees.push_back(begin);
+    }
+}
+
+void RPNParallelEvaluator::CollectChildren(std::span<const Tokenizer::TokenPair> rpn_expression, std::size_t root, std::vector<std::size_t>& children) const
+{
+    const auto& [lexeme, token, value]{ rpn_expression[root] };
+
+    auto arity{ std::size_t{ 2 } };
+    auto child{ root - 1 };
+
+    if (token == Tokenizer::Token::Function)
+    {
+        arity = MathFunctions::Find(lexeme)->mArity;
+
+        // The sign of a negated call sits between its arguments and the call.
+        if (child < root && rpn_expression[child].mToken == Tokenizer::Token::UnaryOperator)
+        {
+            --child;
+        }
+    }
+
+    // Children are found from the last one backwards, each ends right before the next begins.
+    children.resize(arity);
+    for (auto k{ arity }; k > 0; --k)
+    {
+        children[k - 1] = child;
+        child = mSubtreeBegins[child] - 1;
+    }
+}
+
+std::size_t RPNParallelEvaluator::GetSubtreeSize(std::size_t root) const noexcept
+{
+    return root - mSubtreeBegins[root] + 1;
+}
+
+double RPNParallelEvaluator::EvaluateSubtree(std::span<const Tokenizer::TokenPair> rpn_expression, std::size_t root)
+{
+    // Only operators and calls can be split, a negated literal is two tokens but a single leaf.
+    auto IsLarge = [this, rpn_expression](std::size_t node)
+    {
+        const auto token{ rpn_expression[node].mToken };
+        return GetSubtreeSize(node) > mGrainSize && (token == Tokenizer::Token::Operator || token == Tokenizer::Token::Function);
+    };
+
+    auto EvaluateSmall = [this, rpn_expression](std::size_t child)
+    {
+        return EvaluateSequentially(rpn_expression.subspan(mSubtreeBegins[child], GetSubtreeSize(child)));
+    };
+
+    // A chain of nodes with a single large child, e.g. the left spine of a+b+c+..., 
+    // is walked in a loop rather than by recursion, it can be millions of nodes deep.
+    std::vector<PendingNode> path{};
+    std::vector<double> path_arguments{};
+    std::vector<std::size_t> children{};
+
+    double value{};
+
+    while (true)
+    {
+        if (!IsLarge(root))
+        {
+            value = EvaluateSmall(root);
+            break;
+        }
+
+        CollectChildren(rpn_expression, root, children);
+
+        const auto large_count{ std::count_if(std::cbegin(children), std::cend(children), IsLarge) };
+
+        if (large_count <= 1)
+        {
+            const auto arguments_begin{ std::size(path_arguments) };
+            auto large_child{ kNoToken };
+
+            for (std::size_t k{}; k < std::size(children); ++k)
+            {
+                path_arguments.push_back(IsLarge(children[k]) ? 0.0 : EvaluateSmall(children[k]));
+                large_child = IsLarge(children[k]) ? k : large_child;
+            }
+
+            if (large_child == kNoToken)
+            {
+                value = Apply(rpn_expression, root, std::span{ path_arguments }.subspan(arguments_begin));
+                path_arguments.resize(arguments_begin);
+                break;
+            }
+
+            path.push_back({ root, arguments_begin, large_child });
+            root = children[large_child];
+            continue;
+        }
+
+        // Fork: every large child but the last runs as a task, the last one and the small ones run here.
+        std::vector<double> arguments(std::size(children));
+        Utils::TaskScheduler::TaskGroup group{};
+
+        auto last_large{ std::size(children) - 1 };
+        while (!IsLarge(children[last_large]))
+        {
+            --last_large;
+        }
+
+        for (std::size_t k{}; k < last_large; ++k)
+        {
+            if (IsLarge(children[k]))
+            {
+                mTaskScheduler.Spawn(group, [this, rpn_expression, &arguments, k, child = children[k]]()
+                {
+                    arguments[k] = EvaluateSubtree(rpn_expression, child);
+                });
+            }
+        }
+
+        for (std::size_t k{}; k < std::size(children); ++k)
+        {
+            if (!IsLarge(children[k]))
+            {
+                arguments[k] = EvaluateSmall(children[k]);
+            }
+        }
+
+        arguments[last_large] = EvaluateSubtree(rpn_expression, children[last_large]);
+        mTaskScheduler.Wait(group);
+
+        value = Apply(rpn_expression, root, arguments);
+        break;
+    }
+
+    // Join: the nodes on the path get the value of their large child, deepest first.
+    for (auto node{ std::crbegin(path) }; node != std::crend(path); ++node)
+    {
+        const auto arguments{ std::span{ path_arguments }.subspan(node->mArgumentsBegin) };
+        arguments[node->mLargeChild] = value;
+
+        value = Apply(rpn_expression, node->mRoot, arguments);
+        path_arguments.resize(node->mArgumentsBegin);
+    }
+
+    return value;
+}
+
+double RPNParallelEvaluator::Apply(std::span<const Tokenizer::TokenPair> rpn_expression, std::size_t root, std::span<const double> arguments)
+{
+    const auto& lexeme{ rpn_expression[root].mLexeme };
+
+    if (rpn_expression[root].mToken == Tokenizer::Token::Operator)
+    {
+        return RPNEvaluator::ApplyOperator(lexeme, arguments[0], arguments[1]);
+    }
+
+    const auto sign{ root > 0 && rpn_expression[root - 1].mToken == Tokenizer::Token::UnaryOperator ? -1.0 : 1.0 };
+    return MathFunctions::Apply(MathFunctions::Find(lexeme)->mId, arguments) * sign;
+}
\ No newline at end of file
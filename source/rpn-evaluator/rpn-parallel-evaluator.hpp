@@ -0,0 +1,78 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Evaluates one very large RPN expression on several threads.
+
+    The expression tree is kept implicit: in RPN every subtree is a contiguous range of tokens ending 
+    at its root, so one pass recording where each subtree begins is enough to walk it from the root down.
+    Subtrees of at most the grain size are evaluated by RPNEvaluator on their own token range. 
+    Above it, a node whose children are large enough spawns all but the last of them as tasks 
+    on a work-stealing TaskScheduler, evaluates the last one itself and combines the results at the join.
+
+    The operations and their operands are the same as in RPNEvaluator, so is the result, bit for bit.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <tokenizer.hpp>
+#include <task-scheduler.hpp>
+
+class RPNParallelEvaluator
+{
+public:
+    // Below this many tokens spawning a task costs more than evaluating the subtree.
+    static constexpr std::size_t kDefaultGrainSize{ std::size_t{ 1 } << 14 };
+
+public:
+    // thread_count counts the calling thread, 0 means one thread per hardware thread.
+    explicit RPNParallelEvaluator(std::size_t thread_count = 0, std::size_t grain_size = kDefaultGrainSize);
+    ~RPNParallelEvaluator() noexcept = default;
+
+    // Expects a valid RPN expression, as produced by RPNConverter. An empty expression gives NaN.
+    [[nodiscard]] double Evaluate(const std::vector<Tokenizer::TokenPair>& rpn_expression);
+
+    [[nodiscard]] std::size_t GetThreadCount() const noexcept;
+
+private:
+    void BuildTree(std::span<const Tokenizer::TokenPair> rpn_expression);
+
+    // Ends of the children of the node at root, in evaluation order.
+    void CollectChildren(std::span<const Tokenizer::TokenPair> rpn_expression, std::size_t root, std::vector<std::size_t>& children) const;
+
+    [[nodiscard]] std::size_t GetSubtreeSize(std::size_t root) const noexcept;
+    [[nodiscard]] double EvaluateSubtree(std::span<const Tokenizer::TokenPair> rpn_expression, std::size_t root);
+
+    [[nodiscard]] static double Apply(std::span<const Tokenizer::TokenPair> rpn_expression, std::size_t root, std::span<const double> arguments);
+
+private:
+    Utils::TaskScheduler mTaskScheduler;
+    std::size_t mGrainSize;
+
+    // Index of the first token of the subtree whose root is the token at the same index.
+    std::vector<std::size_t> mSubtreeBegins;
+    std::vector<std::size_t> mOpenSubtrees;
+};
\ No newline at end of file
@@ -0,0 +1,288 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <gtest/gtest.h>
+
+#include <calc-daemon.hpp>
+#include <calc-protocol.hpp>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+class CalcDaemonTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        mSocketPath = "/tmp/calc-daemon-test-" + std::to_string(::getpid()) + ".sock";
+
+        ASSERT_TRUE(mCalcDaemon.Listen(mSocketPath)) << mCalcDaemon.GetErrorMessage().toStdString();
+        mThread = std::thread{ [this]() { mIsRunOk = mCalcDaemon.Run(); } };
+    }
+
+    void TearDown() override
+    {
+        mCalcDaemon.Stop();
+        if (mThread.joinable())
+        {
+            mThread.join();
+        }
+    }
+
+    [[nodiscard]] int Connect() const
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, mSocketPath.c_str(), std::size(mSocketPath) + 1);
+
+        const auto descriptor{ ::socket(AF_UNIX, SOCK_STREAM, 0) };
+        EXPECT_EQ(::connect(descriptor, reinterpret_cast<const sockaddr*>(&address), sizeof(address)), 0);
+
+        return descriptor;
+    }
+
+    // Sends all the requests at once and reads back as many responses.
+    static std::vector<CalcProtocol::Response> Exchange(int descriptor, const std::vector<char>& requests, std::size_t count, std::vector<char>& input)
+    {
+        EXPECT_EQ(::send(descriptor, std::data(requests), std::size(requests), MSG_NOSIGNAL), std::ssize(requests));
+        return ReadResponses(descriptor, count, input);
+    }
+
+    // Up to count responses, fewer if the daemon closes the connection before.
+    static std::vector<CalcProtocol::Response> ReadResponses(int descriptor, std::size_t count, std::vector<char>& input)
+    {
+        std::vector<CalcProtocol::Response> responses{};
+        std::array<char, 4096> buffer{};
+        std::size_t parsed{};
+
+        while (std::size(responses) < count)
+        {
+            CalcProtocol::Frame frame{};
+            if (CalcProtocol::ParseFrame(std::span<const char>{ input }.subspan(parsed), frame) == CalcProtocol::ParseStatus::Complete)
+            {
+                CalcProtocol::Response response{};
+                EXPECT_TRUE(CalcProtocol::DecodeResponse(frame, response));
+                EXPECT_EQ(frame.mRequestId, std::size(responses));
+
+                responses.push_back(response);
+                parsed += frame.GetSize();
+                continue;
+            }
+
+            const auto size{ ::read(descriptor, std::data(buffer), std::size(buffer)) };
+            if (size <= 0)
+            {
+                break;
+            }
+
+            input.insert(std::end(input), std::data(buffer), std::data(buffer) + size);
+        }
+
+        return responses;
+    }
+
+protected:
+    CalcDaemon mCalcDaemon;
+    std::string mSocketPath;
+    std::thread mThread;
+    bool mIsRunOk{};
+};
+
+TEST(CalcProtocolTest, FramesRoundTrip)
+{
+    std::vector<char> buffer{};
+    CalcProtocol::AppendRequest(buffer, 7, std::array{ 1.5, -2.0 }, "x*y");
+    CalcProtocol::AppendResult(buffer, 8, 0.1);
+    CalcProtocol::AppendError(buffer, 9, "division");
+
+    CalcProtocol::Frame frame{};
+    std::span<const char> input{ buffer };
+
+    for (std::size_t size{}; size < CalcProtocol::kHeaderSize + 4 + 16 + 3; ++size)
+    {
+        ASSERT_EQ(CalcProtocol::ParseFrame(input.first(size), frame), CalcProtocol::ParseStatus::Incomplete);
+    }
+
+    ASSERT_EQ(CalcProtocol::ParseFrame(input, frame), CalcProtocol::ParseStatus::Complete);
+    ASSERT_EQ(frame.mRequestId, 7);
+
+    std::vector<double> bindings{};
+    std::string_view expression{};
+    ASSERT_TRUE(CalcProtocol::DecodeRequest(frame, bindings, expression));
+    ASSERT_EQ(bindings, (std::vector{ 1.5, -2.0 }));
+    ASSERT_EQ(expression, "x*y");
+
+    CalcProtocol::Response response{};
+
+    input = input.subspan(frame.GetSize());
+    ASSERT_EQ(CalcProtocol::ParseFrame(input, frame), CalcProtocol::ParseStatus::Complete);
+    ASSERT_TRUE(CalcProtocol::DecodeResponse(frame, response));
+    ASSERT_EQ(response.mStatus, CalcProtocol::Status::Ok);
+    ASSERT_EQ(response.mValue, 0.1);
+
+    input = input.subspan(frame.GetSize());
+    ASSERT_EQ(CalcProtocol::ParseFrame(input, frame), CalcProtocol::ParseStatus::Complete);
+    ASSERT_TRUE(CalcProtocol::DecodeResponse(frame, response));
+    ASSERT_EQ(response.mStatus, CalcProtocol::Status::Error);
+    ASSERT_EQ(response.mErrorMessage, "division");
+    ASSERT_EQ(frame.GetSize(), std::size(input));
+
+    // A size above the limit is rejected from the header alone.
+    const std::array<std::uint32_t, 2> header{ CalcProtocol::kMaxPayloadSize + 1, 0 };
+    ASSERT_EQ(CalcProtocol::ParseFrame(std::span{ reinterpret_cast<const char*>(std::data(header)), sizeof(header) }, frame), CalcProtocol::ParseStatus::Malformed);
+}
+
+TEST_F(CalcDaemonTest, AnswersPipelinedRequests)
+{
+    const auto descriptor{ Connect() };
+
+    std::vector<char> requests{};
+    for (std::uint32_t i{}; i < 1000; ++i)
+    {
+        const auto x{ static_cast<double>(i) };
+        CalcProtocol::AppendRequest(requests, i, std::array{ x }, i % 3 == 2 ? "(1+" : "3*x^2+2*x+1");
+    }
+
+    std::vector<char> input{};
+    const auto responses{ Exchange(descriptor, requests, 1000, input) };
+    ASSERT_EQ(std::size(responses), 1000);
+
+    for (std::size_t i{}; i < std::size(responses); ++i)
+    {
+        if (i % 3 == 2)
+        {
+            ASSERT_EQ(responses[i].mStatus, CalcProtocol::Status::Error) << i;
+            ASSERT_FALSE(std::empty(responses[i].mErrorMessage));
+        }
+        else
+        {
+            const auto x{ static_cast<double>(i) };
+            ASSERT_EQ(responses[i].mStatus, CalcProtocol::Status::Ok) << i;
+            ASSERT_DOUBLE_EQ(responses[i].mValue, 3 * x * x + 2 * x + 1) << i;
+        }
+    }
+
+    ::close(descriptor);
+}
+
+TEST_F(CalcDaemonTest, SharesCompiledProgramsBetweenClients)
+{
+    std::array<std::thread, 4> clients{};
+    std::array<bool, 4> is_ok{};
+
+    for (std::size_t c{}; c < std::size(clients); ++c)
+    {
+        clients[c] = std::thread{ [this, c, &is_ok]()
+        {
+            const auto descriptor{ Connect() };
+
+            std::vector<char> requests{};
+            for (std::uint32_t i{}; i < 500; ++i)
+            {
+                CalcProtocol::AppendRequest(requests, i, std::array{ static_cast<double>(c), 2.0 }, "sqrt(x*x+y*y)");
+            }
+
+            std::vector<char> input{};
+            const auto responses{ Exchange(descriptor, requests, 500, input) };
+
+            is_ok[c] = std::size(responses) == 500 && std::all_of(std::begin(responses), std::end(responses), [c](const auto& response)
+            {
+                return response.mStatus == CalcProtocol::Status::Ok && response.mValue == std::sqrt(static_cast<double>(c * c) + 4.0);
+            });
+
+            ::close(descriptor);
+        } };
+    }
+
+    for (auto& client : clients)
+    {
+        client.join();
+    }
+
+    TearDown();
+    ASSERT_TRUE(mIsRunOk);
+
+    for (const auto ok : is_ok)
+    {
+        ASSERT_TRUE(ok);
+    }
+
+    const auto& statistics{ mCalcDaemon.GetStatistics() };
+    ASSERT_EQ(statistics.mConnections, 4);
+    ASSERT_EQ(statistics.mRequests, 2000);
+    ASSERT_EQ(statistics.mCompilations, 1);
+    ASSERT_EQ(statistics.mCacheHits, 1999);
+    ASSERT_LT(statistics.mBatches, 2000);
+}
+
+TEST_F(CalcDaemonTest, AnswersEverythingBeforeAHalfClose)
+{
+    // Far more responses than the socket buffers and the output queue hold, the daemon has to stop 
+    // reading until the client reads them, and go on writing after the client has stopped sending.
+    constexpr std::uint32_t kCount{ 200'000 };
+
+    std::vector<char> requests{};
+    for (std::uint32_t i{}; i < kCount; ++i)
+    {
+        CalcProtocol::AppendRequest(requests, i, std::array{ static_cast<double>(i) }, "x+1");
+    }
+
+    const auto descriptor{ Connect() };
+
+    std::thread writer{ [descriptor, &requests]()
+    {
+        EXPECT_EQ(::send(descriptor, std::data(requests), std::size(requests), MSG_NOSIGNAL), std::ssize(requests));
+        ::shutdown(descriptor, SHUT_WR);
+    } };
+
+    // Let the responses pile up first.
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 500 });
+
+    std::vector<char> input{};
+    const auto responses{ ReadResponses(descriptor, kCount, input) };
+    writer.join();
+
+    ASSERT_EQ(std::size(responses), kCount);
+    for (std::size_t i{}; i < std::size(responses); ++i)
+    {
+        ASSERT_EQ(responses[i].mValue, static_cast<double>(i) + 1.0) << i;
+    }
+
+    // Closed by the daemon once everything is written.
+    std::array<char, 16> buffer{};
+    ASSERT_EQ(::read(descriptor, std::data(buffer), std::size(buffer)), 0);
+    ::close(descriptor);
+
+    TearDown();
+    ASSERT_TRUE(mIsRunOk);
+    ASSERT_GT(mCalcDaemon.GetStatistics().mReadPauses, 0);
+}
\ No newline at end of file
@@ -0,0 +1,177 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <decimal.hpp>
+
+#include <tokenizer.hpp>
+#include <rpn-converter.hpp>
+#include <rpn-decimal-evaluator.hpp>
+
+#include <array>
+#include <string_view>
+#include <utility>
+
+class DecimalTest : public ::testing::Test
+{
+protected:
+    [[nodiscard]] std::string Evaluate(const QString& expression)
+    {
+        mTokenizer.Init(expression);
+        mTokenizer.Run();
+
+        const auto rpn_expression{ mRPNConverter.Convert(mTokenizer.GetTokens()) };
+        return mRPNDecimalEvaluator.Evaluate(rpn_expression).ToString();
+    }
+
+protected:
+    Tokenizer mTokenizer;
+    RPNConverter mRPNConverter;
+    RPNDecimalEvaluator mRPNDecimalEvaluator;
+};
+
+TEST_F(DecimalTest, ExactDecimalFractions)
+{
+    ASSERT_EQ(Evaluate(QStringLiteral("0.1+0.2")), "0.3");
+    ASSERT_EQ(Evaluate(QStringLiteral("1-0.9")), "0.1");
+    ASSERT_EQ(Evaluate(QStringLiteral("1.10*3")), "3.3");
+    ASSERT_EQ(Evaluate(QStringLiteral("(-2.5)*4")), "-10");
+    ASSERT_EQ(Evaluate(QStringLiteral("7/2")), "3.5");
+    ASSERT_EQ(Evaluate(QStringLiteral("1/3")), "0.333333333333333333");
+    ASSERT_EQ(Evaluate(QStringLiteral("2/3")), "0.666666666666666667");
+}
+
+TEST_F(DecimalTest, PromotesOnOverflowAndDemotesBack)
+{
+    const auto max{ Utils::Decimal{ std::numeric_limits<std::int64_t>::max() } };
+
+    const auto promoted{ max + Utils::Decimal{ 1 } };
+    ASSERT_FALSE(promoted.IsSmall());
+    ASSERT_EQ(promoted.ToString(), "9223372036854775808");
+
+    const auto demoted{ promoted - Utils::Decimal{ 1 } };
+    ASSERT_TRUE(demoted.IsSmall());
+    ASSERT_EQ(demoted.ToString(), "9223372036854775807");
+
+    ASSERT_EQ((-max - Utils::Decimal{ 2 }).ToString(), "-9223372036854775809");
+}
+
+TEST_F(DecimalTest, LargeNumbers)
+{
+    ASSERT_EQ(Evaluate(QStringLiteral("99999999999999999999*99999999999999999999")), "9999999999999999999800000000000000000001");
+    ASSERT_EQ(Evaluate(QStringLiteral("2^100")), "1267650600228229401496703205376");
+    ASSERT_EQ(Evaluate(QStringLiteral("2^100/2^98")), "4");
+    ASSERT_EQ(Evaluate(QStringLiteral("2^(-2)")), "0.25");
+    ASSERT_EQ(Evaluate(QStringLiteral("1267650600228229401496703205376/3")), "422550200076076467165567735125.333333333333333333");
+    ASSERT_EQ(Evaluate(QStringLiteral("0.5^3+123456789012345678901234567890-123456789012345678901234567890")), "0.125");
+
+    const auto text{ std::string{ "123456789012345678901234567890.123456789" } };
+    ASSERT_EQ(Utils::Decimal::FromString(text).ToString(), text);
+
+    // Lexemes are parsed from UTF-16, around the 18 digits of the inline coefficient and the 9 digits of a limb.
+    const std::array<std::pair<std::u16string_view, std::string_view>, 6> kNumbers
+    {{
+        { u"0.5", "0.5" }, { u"123456789012345678", "123456789012345678" }, { u"1234567890123456789", "1234567890123456789" },
+        { u"12345678.90123456789", "12345678.90123456789" }, { u"1000000000000000000000000007", "1000000000000000000000000007" },
+        { u"0.000000000000000000001", "0.000000000000000000001" },
+    }};
+
+    for (const auto& [number, expected] : kNumbers)
+    {
+        ASSERT_EQ(Utils::Decimal::FromString(number).ToString(), expected);
+        ASSERT_EQ(Utils::Decimal::FromString(expected).ToString(), expected);
+    }
+}
+
+TEST_F(DecimalTest, DivisionMatchesMultiplication)
+{
+    const auto divisor{ Utils::Decimal::FromString("987654321987654321987") };
+    const auto quotient{ Utils::Decimal::FromString("123456789123456789123456789123456789") };
+
+    const auto dividend{ quotient * divisor };
+    const auto result{ Utils::Decimal::Divide(dividend, divisor) };
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->ToString(), quotient.ToString());
+}
+
+TEST_F(DecimalTest, Errors)
+{
+    std::ignore = Evaluate(QStringLiteral("1/0"));
+    ASSERT_TRUE(mRPNDecimalEvaluator.HasError());
+
+    std::ignore = Evaluate(QStringLiteral("2^0.5"));
+    ASSERT_TRUE(mRPNDecimalEvaluator.HasError());
+
+    std::ignore = Evaluate(QStringLiteral("2^100000"));
+    ASSERT_TRUE(mRPNDecimalEvaluator.HasError());
+
+    std::ignore = Evaluate(QStringLiteral("1+1"));
+    ASSERT_FALSE(mRPNDecimalEvaluator.HasError());
+}
+
+TEST_F(DecimalTest, RejectsPowersByTheirLength)
+{
+    // The estimate is the digits of the base times the exponent: 8192 for 10^4096, which has 4097 digits.
+    ASSERT_EQ(std::size(Evaluate(QStringLiteral("10^4096"))), 4097);
+    ASSERT_FALSE(mRPNDecimalEvaluator.HasError());
+
+    ASSERT_TRUE(Utils::Decimal::IsPowerTooLong(Utils::Decimal{ 123456789 }, Utils::Decimal{ 4096 }));
+    ASSERT_FALSE(Utils::Decimal::Pow(Utils::Decimal{ 123456789 }, Utils::Decimal{ 4096 }).has_value());
+
+    std::ignore = Evaluate(QStringLiteral("123456789^4096"));
+    ASSERT_EQ(mRPNDecimalEvaluator.GetErrorMessage(), QStringLiteral("power longer than 32768 digits"));
+
+    // Powers group from the left: 9^4096 fits, its own power to 4096 would take minutes.
+    std::ignore = Evaluate(QStringLiteral("9^4096^4096"));
+    ASSERT_EQ(mRPNDecimalEvaluator.GetErrorMessage(), QStringLiteral("power longer than 32768 digits"));
+
+    std::ignore = Evaluate(QStringLiteral("(-0.5)^4096"));
+    ASSERT_FALSE(mRPNDecimalEvaluator.HasError());
+}
+
+TEST_F(DecimalTest, GovernedEvaluationStopsAtTheLimits)
+{
+    mTokenizer.Init(QStringLiteral("1+(2+(3+(4+5)))"));
+    mTokenizer.Run();
+    const auto rpn_expression{ mRPNConverter.Convert(mTokenizer.GetTokens()) };
+
+    Utils::ResourceLimits limits{};
+    Utils::LimitViolation violation{};
+
+    ASSERT_EQ(mRPNDecimalEvaluator.Evaluate(rpn_expression, limits, violation).ToString(), "15");
+    ASSERT_EQ(violation, Utils::LimitViolation::None);
+    ASSERT_FALSE(mRPNDecimalEvaluator.HasError());
+
+    limits.mMaxOperandStackDepth = 3;
+    std::ignore = mRPNDecimalEvaluator.Evaluate(rpn_expression, limits, violation);
+    ASSERT_EQ(violation, Utils::LimitViolation::OperandStackDepth);
+    ASSERT_EQ(mRPNDecimalEvaluator.GetErrorMessage(), QStringLiteral("operand stack deeper than 3"));
+
+    limits = {};
+    limits.mDeadline = Utils::ResourceLimits::Clock::now();
+    limits.mDeadlineCheckInterval = 1;
+    std::ignore = mRPNDecimalEvaluator.Evaluate(rpn_expression, limits, violation);
+    ASSERT_EQ(violation, Utils::LimitViolation::Deadline);
+    ASSERT_TRUE(mRPNDecimalEvaluator.HasError());
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <evaluation-pipeline.hpp>
+
+#include <array>
+
+class EvaluationPipelineTest : public ::testing::Test
+{
+protected:
+    EvaluationPipeline mEvaluationPipeline;
+};
+
+TEST_F(EvaluationPipelineTest, ReusedPipelineMatchesFreshEvaluation)
+{
+    const std::array<QString, 5> expressions
+    {
+        QStringLiteral("3+4*2"),
+        QStringLiteral("(-2.5)*(4-1)^2"),
+        QStringLiteral("3+4*2/(1-5)^2^3"),
+        QStringLiteral("7"),
+        QStringLiteral("100/(-4)"),
+    };
+
+    for (const auto& expression : expressions)
+    {
+        Tokenizer tokenizer{};
+        tokenizer.Init(expression);
+        tokenizer.Run();
+
+        RPNConverter rpn_converter{};
+        const auto expected{ RPNEvaluator::Evaluate(rpn_converter.Convert(tokenizer.GetTokens())) };
+
+        ASSERT_TRUE(mEvaluationPipeline.Run(expression));
+        ASSERT_DOUBLE_EQ(mEvaluationPipeline.GetResult(), expected);
+    }
+}
+
+TEST_F(EvaluationPipelineTest, BuffersKeepTheirCapacity)
+{
+    ASSERT_TRUE(mEvaluationPipeline.Run(QStringLiteral("((1+2)*(3+4))^2-5*6")));
+    const auto* rpn_buffer{ std::data(mEvaluationPipeline.GetRPNExpression()) };
+
+    ASSERT_TRUE(mEvaluationPipeline.Run(QStringLiteral("2*3")));
+    ASSERT_EQ(std::data(mEvaluationPipeline.GetRPNExpression()), rpn_buffer);
+
+    ASSERT_FALSE(mEvaluationPipeline.Run(QStringLiteral("2*3)")));
+    ASSERT_FALSE(mEvaluationPipeline.GetErrorMessage().isEmpty());
+
+    ASSERT_TRUE(mEvaluationPipeline.Run(QStringLiteral("(8-2)/3")));
+    ASSERT_EQ(std::data(mEvaluationPipeline.GetRPNExpression()), rpn_buffer);
+    ASSERT_DOUBLE_EQ(mEvaluationPipeline.GetResult(), 2.0);
+}
+
+TEST_F(EvaluationPipelineTest, IntegerExpressionsAreExact)
+{
+    ASSERT_TRUE(mEvaluationPipeline.Run(QStringLiteral("9007199254740993*1")));
+    ASSERT_EQ(mEvaluationPipeline.GetIntegerResult().mOutcome, RPNIntegerEvaluator::Outcome::Exact);
+    ASSERT_EQ(mEvaluationPipeline.GetIntegerResult().mValue, 9'007'199'254'740'993);
+
+    // Falls back to doubles once the result is not an integer or does not fit.
+    ASSERT_TRUE(mEvaluationPipeline.Run(QStringLiteral("7/2")));
+    ASSERT_EQ(mEvaluationPipeline.GetIntegerResult().mOutcome, RPNIntegerEvaluator::Outcome::Inexact);
+    ASSERT_DOUBLE_EQ(mEvaluationPipeline.GetResult(), 3.5);
+
+    ASSERT_TRUE(mEvaluationPipeline.Run(QStringLiteral("2^64")));
+    ASSERT_EQ(mEvaluationPipeline.GetIntegerResult().mOutcome, RPNIntegerEvaluator::Outcome::Overflow);
+    ASSERT_DOUBLE_EQ(mEvaluationPipeline.GetResult(), 18446744073709551616.0);
+
+    ASSERT_TRUE(mEvaluationPipeline.Run(QStringLiteral("1.5*2")));
+    ASSERT_EQ(mEvaluationPipeline.GetIntegerResult().mOutcome, RPNIntegerEvaluator::Outcome::NotInteger);
+    ASSERT_DOUBLE_EQ(mEvaluationPipeline.GetResult(), 3.0);
+}
+
+TEST_F(EvaluationPipelineTest, ReassociationIsOptIn)
+{
+    const auto expression{ QStringLiteral("0.5+10000000000000000+(-10000000000000000)+0.5") };
+
+    ASSERT_TRUE(mEvaluationPipeline.Run(expression));
+    ASSERT_EQ(mEvaluationPipeline.GetResult(), 0.5);
+
+    // (0.5 + 10^16) + (-10^16 + 0.5): both halves round the 0.5 away.
+    mEvaluationPipeline.SetReassociation(true);
+    ASSERT_TRUE(mEvaluationPipeline.Run(expression));
+    ASSERT_EQ(mEvaluationPipeline.GetResult(), 0.0);
+}
+
+TEST_F(EvaluationPipelineTest, LongUnbalancedInputIsRejectedUpFront)
+{
+    QString expression{ QStringLiteral("(") };
+    while (expression.size() < EvaluationPipeline::kParenthesisCheckThreshold)
+    {
+        expression += QStringLiteral("(1+2)*");
+    }
+
+    expression += QStringLiteral("3");
+
+    ASSERT_FALSE(mEvaluationPipeline.Run(expression));
+    ASSERT_EQ(mEvaluationPipeline.GetErrorMessage(), QStringLiteral("right parenthesis missing for the left one at 0"));
+}
+
+TEST_F(EvaluationPipelineTest, UnboundVariableIsAnError)
+{
+    ASSERT_FALSE(mEvaluationPipeline.Run(QStringLiteral("2*x+1")));
+    ASSERT_EQ(mEvaluationPipeline.GetErrorMessage(), QStringLiteral("unknown variable: x"));
+
+    ASSERT_TRUE(mEvaluationPipeline.Run(QStringLiteral("2*1+1")));
+    ASSERT_EQ(mEvaluationPipeline.GetResult(), 3.0);
+}
\ No newline at end of file
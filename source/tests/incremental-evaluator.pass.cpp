@@ -0,0 +1,189 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <tokenizer.hpp>
+#include <rpn-converter.hpp>
+#include <rpn-evaluator.hpp>
+#include <incremental-evaluator.hpp>
+
+#include <cmath>
+
+class IncrementalEvaluatorTest : public ::testing::Test
+{
+protected:
+    [[nodiscard]] double EvaluateFromScratch(const QString& expression)
+    {
+        mTokenizer.Init(expression);
+        mTokenizer.Run();
+
+        const auto rpn_expression{ mRPNConverter.Convert(mTokenizer.GetTokens()) };
+        return RPNEvaluator::Evaluate(rpn_expression);
+    }
+
+protected:
+    Tokenizer mTokenizer;
+    RPNConverter mRPNConverter;
+    IncrementalEvaluator mIncrementalEvaluator;
+};
+
+TEST_F(IncrementalEvaluatorTest, TypingCharacterByCharacter)
+{
+    const auto expression{ QStringLiteral("(-2.5)+13*(4-1)^2/3") };
+
+    for (qsizetype i{ 1 }; i <= expression.size(); ++i)
+    {
+        const auto prefix{ expression.left(i) };
+        
+        mTokenizer.Init(prefix);
+        mTokenizer.Run();
+
+        const bool is_complete{ !mTokenizer.HasError() && !mRPNConverter.Convert(mTokenizer.GetTokens()).empty() };
+        ASSERT_EQ(mIncrementalEvaluator.Update(prefix), is_complete);
+
+        if (is_complete)
+        {
+            ASSERT_DOUBLE_EQ(mIncrementalEvaluator.GetResult(), EvaluateFromScratch(prefix));
+        }
+    }
+}
+
+TEST_F(IncrementalEvaluatorTest, DeletingFromTail)
+{
+    ASSERT_TRUE(mIncrementalEvaluator.Update(QStringLiteral("12*34+56")));
+    ASSERT_DOUBLE_EQ(mIncrementalEvaluator.GetResult(), 464);
+
+    ASSERT_TRUE(mIncrementalEvaluator.Update(QStringLiteral("12*34+5")));
+    ASSERT_DOUBLE_EQ(mIncrementalEvaluator.GetResult(), 413);
+
+    ASSERT_FALSE(mIncrementalEvaluator.Update(QStringLiteral("12*34+")));
+    ASSERT_TRUE(mIncrementalEvaluator.HasError());
+
+    ASSERT_TRUE(mIncrementalEvaluator.Update(QStringLiteral("12*34")));
+    ASSERT_DOUBLE_EQ(mIncrementalEvaluator.GetResult(), 408);
+
+    ASSERT_TRUE(mIncrementalEvaluator.Update(QStringLiteral("12")));
+    ASSERT_DOUBLE_EQ(mIncrementalEvaluator.GetResult(), 12);
+}
+
+TEST_F(IncrementalEvaluatorTest, EditInTheMiddle)
+{
+    ASSERT_TRUE(mIncrementalEvaluator.Update(QStringLiteral("2+3*4")));
+    ASSERT_DOUBLE_EQ(mIncrementalEvaluator.GetResult(), 14);
+
+    ASSERT_TRUE(mIncrementalEvaluator.Update(QStringLiteral("2^3*4")));
+    ASSERT_DOUBLE_EQ(mIncrementalEvaluator.GetResult(), 32);
+}
+
+TEST_F(IncrementalEvaluatorTest, RecoversAfterError)
+{
+    ASSERT_FALSE(mIncrementalEvaluator.Update(QStringLiteral("(1+2))")));
+    ASSERT_TRUE(mIncrementalEvaluator.HasError());
+
+    ASSERT_TRUE(mIncrementalEvaluator.Update(QStringLiteral("(1+2)")));
+    ASSERT_FALSE(mIncrementalEvaluator.HasError());
+    ASSERT_DOUBLE_EQ(mIncrementalEvaluator.GetResult(), 3);
+
+    ASSERT_FALSE(mIncrementalEvaluator.Update(QStringLiteral("(1+2")));
+    ASSERT_TRUE(mIncrementalEvaluator.Update(QStringLiteral("(1+2)*2")));
+    ASSERT_DOUBLE_EQ(mIncrementalEvaluator.GetResult(), 6);
+}
+
+TEST_F(IncrementalEvaluatorTest, TypingFunctionCalls)
+{
+    const QString expression{ QStringLiteral("2*(-max(1,sqrt(16)))+cos(0)") };
+
+    for (qsizetype length{ 1 }; length <= expression.size(); ++length)
+    {
+        const auto prefix{ expression.left(length) };
+        const bool is_complete{ prefix == QStringLiteral("2") || prefix == QStringLiteral("2*(-max(1,sqrt(16)))") || prefix == expression };
+
+        if (is_complete)
+        {
+            ASSERT_TRUE(mIncrementalEvaluator.Update(prefix)) << prefix.toStdString();
+            ASSERT_DOUBLE_EQ(mIncrementalEvaluator.GetResult(), EvaluateFromScratch(prefix));
+        }
+        else
+        {
+            std::ignore = mIncrementalEvaluator.Update(prefix);
+        }
+    }
+
+    ASSERT_DOUBLE_EQ(mIncrementalEvaluator.GetResult(), -7.0);
+
+    ASSERT_FALSE(mIncrementalEvaluator.Update(QStringLiteral("max(1)")));
+    ASSERT_FALSE(mIncrementalEvaluator.Update(QStringLiteral("(1,2)")));
+}
+
+TEST_F(IncrementalEvaluatorTest, DeletingBackThroughNestedCalls)
+{
+    const QString expression{ QStringLiteral("2^max(1,(3+4)*sqrt(9))-min(2*(5-1),6)/3") };
+
+    ASSERT_TRUE(mIncrementalEvaluator.Update(expression));
+    ASSERT_DOUBLE_EQ(mIncrementalEvaluator.GetResult(), EvaluateFromScratch(expression));
+
+    // Every shorter prefix undoes the operators and operands popped after it, complete ones must match a full evaluation.
+    // A function name typed in part is a variable, NaN either way.
+    for (auto length{ expression.size() - 1 }; length > 0; --length)
+    {
+        const auto prefix{ expression.left(length) };
+
+        if (!mIncrementalEvaluator.Update(prefix))
+        {
+            continue;
+        }
+
+        const auto expected{ EvaluateFromScratch(prefix) };
+        if (std::isnan(expected))
+        {
+            ASSERT_TRUE(std::isnan(mIncrementalEvaluator.GetResult())) << prefix.toStdString();
+        }
+        else
+        {
+            ASSERT_DOUBLE_EQ(mIncrementalEvaluator.GetResult(), expected) << prefix.toStdString();
+        }
+    }
+
+    ASSERT_TRUE(mIncrementalEvaluator.Update(expression));
+    ASSERT_DOUBLE_EQ(mIncrementalEvaluator.GetResult(), EvaluateFromScratch(expression));
+}
+
+TEST_F(IncrementalEvaluatorTest, StopsAtTheLimits)
+{
+    Utils::ResourceLimits limits{};
+    limits.mMaxNestingDepth = 2;
+    limits.mMaxOperandStackDepth = 3;
+    mIncrementalEvaluator.SetLimits(limits);
+
+    ASSERT_TRUE(mIncrementalEvaluator.Update(QStringLiteral("((1+2))")));
+    ASSERT_FALSE(mIncrementalEvaluator.Update(QStringLiteral("(((1+2)))")));
+    ASSERT_EQ(mIncrementalEvaluator.GetErrorMessage(), QStringLiteral("nesting deeper than 2"));
+
+    ASSERT_TRUE(mIncrementalEvaluator.Update(QStringLiteral("1+2*3")));
+    ASSERT_FALSE(mIncrementalEvaluator.Update(QStringLiteral("1+2*3^4^5")));
+    ASSERT_EQ(mIncrementalEvaluator.GetErrorMessage(), QStringLiteral("operand stack deeper than 3"));
+
+    // The checkpoints before the limit was hit are still good.
+    ASSERT_TRUE(mIncrementalEvaluator.Update(QStringLiteral("1+2*3-4")));
+    ASSERT_DOUBLE_EQ(mIncrementalEvaluator.GetResult(), 3.0);
+}
\ No newline at end of file
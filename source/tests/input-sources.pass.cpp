@@ -0,0 +1,182 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <gtest/gtest.h>
+
+#include <evaluation-pipeline.hpp>
+#include <input-sources.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+class InputSourcesTest : public ::testing::Test
+{
+protected:
+    // Reads text in chunks of at most chunk_size bytes, whatever the buffer size.
+    static Utils::InputSources::ChunkReader MakeReader(std::string text, std::size_t chunk_size)
+    {
+        return [text = std::move(text), chunk_size, position = std::size_t{}](std::span<char> buffer) mutable -> qsizetype
+        {
+            const auto size{ std::min({ chunk_size, std::size(buffer), std::size(text) - position }) };
+            std::memcpy(std::data(buffer), std::data(text) + position, size);
+            position += size;
+
+            return static_cast<qsizetype>(size);
+        };
+    }
+
+protected:
+    EvaluationPipeline mEvaluationPipeline;
+    bool mHasReadError{};
+};
+
+TEST_F(InputSourcesTest, MatchesEvaluationPipeline)
+{
+    const std::array expressions
+    {
+        QStringLiteral("3+4*2/(1-5)^2^3"),
+        QStringLiteral("(-2.5)*(4-1)^2"),
+        QStringLiteral("1250.125*36-(480+125)*12"),
+        QStringLiteral("max(sqrt(16),2^3)-1/3"),
+        QStringLiteral("2*(-sqrt(16))+(-max(2,3))*min(4,-5)"),
+        QStringLiteral("100/(-4)"),
+        QStringLiteral("7"),
+    };
+
+    for (const auto& expression : expressions)
+    {
+        ASSERT_TRUE(mEvaluationPipeline.Run(expression)) << expression.toStdString();
+        const auto expected{ mEvaluationPipeline.GetResult() };
+
+        // Chunks and batches of one split every number and every unary minus from its operand.
+        for (const std::size_t size : { 1, 3, 7, 4096 })
+        {
+            auto input{ Utils::InputSources::FromChunks(MakeReader(expression.toStdString(), size), mHasReadError, size) };
+
+            ASSERT_TRUE(mEvaluationPipeline.RunStream(std::move(input), mHasReadError, size)) << expression.toStdString() << " " << size;
+            ASSERT_DOUBLE_EQ(mEvaluationPipeline.GetResult(), expected) << expression.toStdString() << " " << size;
+            ASSERT_FALSE(mHasReadError);
+        }
+    }
+}
+
+TEST_F(InputSourcesTest, ReportsErrors)
+{
+    const std::array expressions
+    {
+        QStringLiteral("(1+2"), QStringLiteral("1+2)"), QStringLiteral("2*+"), QStringLiteral("max(1)"), QStringLiteral(""), QStringLiteral("2*x+1"),
+    };
+
+    for (const auto& expression : expressions)
+    {
+        ASSERT_FALSE(mEvaluationPipeline.Run(expression)) << expression.toStdString();
+
+        for (const std::size_t size : { 1, 4096 })
+        {
+            auto input{ Utils::InputSources::FromChunks(MakeReader(expression.toStdString(), size), mHasReadError, size) };
+
+            ASSERT_FALSE(mEvaluationPipeline.RunStream(std::move(input), mHasReadError, size)) << expression.toStdString() << " " << size;
+            ASSERT_FALSE(mEvaluationPipeline.GetErrorMessage().isEmpty());
+        }
+    }
+
+    // A failed read ends the input where it failed.
+    auto failing_input{ Utils::InputSources::FromChunks([](std::span<char>) -> qsizetype { return -1; }, mHasReadError) };
+    ASSERT_FALSE(mEvaluationPipeline.RunStream(std::move(failing_input), mHasReadError));
+    ASSERT_TRUE(mHasReadError);
+
+    // Even when what was read before it is a complete expression.
+    auto truncated_input{ Utils::InputSources::FromChunks([is_read = false](std::span<char> buffer) mutable -> qsizetype
+    {
+        if (std::exchange(is_read, true))
+        {
+            return -1;
+        }
+
+        std::memcpy(std::data(buffer), "1+2", 3);
+        return 3;
+    }, mHasReadError) };
+
+    ASSERT_FALSE(mEvaluationPipeline.RunStream(std::move(truncated_input), mHasReadError));
+    ASSERT_TRUE(mHasReadError);
+    ASSERT_EQ(mEvaluationPipeline.GetErrorMessage(), QStringLiteral("Failed to read the input"));
+}
+
+TEST_F(InputSourcesTest, TokensArriveInBatches)
+{
+    std::string text{ "0" };
+    for (int i{}; i < 1000; ++i)
+    {
+        text += "+12.5*(-x)";
+    }
+
+    auto input{ Utils::InputSources::FromChunks(MakeReader(text, 5), mHasReadError, 16) };
+
+    Tokenizer tokenizer{};
+    std::size_t token_count{};
+    std::size_t largest_batch{};
+
+    tokenizer.Run(std::move(input), [&](std::span<const Tokenizer::TokenPair> tokens)
+    {
+        token_count += std::size(tokens);
+        largest_batch = std::max(largest_batch, std::size(tokens));
+        return true;
+    }, 64);
+
+    ASSERT_FALSE(tokenizer.HasError());
+    ASSERT_EQ(token_count, 1 + 1000 * 7);
+    ASSERT_LE(largest_batch, 64 + 1);
+    ASSERT_TRUE(std::empty(tokenizer.GetTokens()));
+
+    // A consumer refusing a batch stops the input.
+    tokenizer.Run(Utils::InputSources::FromChunks(MakeReader(text, 5), mHasReadError), [](std::span<const Tokenizer::TokenPair>) { return false; }, 64);
+    ASSERT_TRUE(tokenizer.HasError());
+}
+
+TEST_F(InputSourcesTest, FileDescriptor)
+{
+    std::string text{ "1" };
+    for (int i{}; i < 100'000; ++i)
+    {
+        text += "+2*3";
+    }
+
+    const auto file{ std::tmpfile() };
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(std::fwrite(std::data(text), 1, std::size(text), file), std::size(text));
+    std::fflush(file);
+    std::rewind(file);
+
+    auto input{ Utils::InputSources::FromFileDescriptor(fileno(file), mHasReadError, 1000) };
+
+    ASSERT_TRUE(mEvaluationPipeline.RunStream(std::move(input), mHasReadError, 100));
+    ASSERT_DOUBLE_EQ(mEvaluationPipeline.GetResult(), 1.0 + 100'000 * 6.0);
+    ASSERT_FALSE(mHasReadError);
+
+    std::fclose(file);
+}
@@ -24,10 +24,15 @@
 
 #include <logger.hpp>
 
+#include <QCoreApplication>
+
 int main(int argc, char** argv)
 {
     UT_CC_DEFAULT_LOGGER_INIT();
 
+    // Queued calls back to the main thread, as the controller makes, need an application to run them.
+    QCoreApplication application{ argc, argv };
+
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
 }
\ No newline at end of file
@@ -0,0 +1,154 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <math-evaluator-controller.hpp>
+
+#include <vector>
+
+#include <QCoreApplication>
+#include <QDeadlineTimer>
+#include <QStringList>
+
+class MathEvaluatorControllerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        QObject::connect(&mController, &MathEvaluatorController::resultReady, [this](double result, const QString& text)
+        {
+            mResults.push_back(result);
+            mResultTexts.push_back(text);
+        });
+        QObject::connect(&mController, &MathEvaluatorController::errorOccurred, [this](const QString& message) { mErrors.push_back(message); });
+        QObject::connect(&mController, &MathEvaluatorController::previewReady, [this](double result) { mPreviews.push_back(result); });
+    }
+
+    // Results are delivered through the event loop of the calling thread.
+    void ProcessEventsFor(int milliseconds)
+    {
+        const QDeadlineTimer deadline{ milliseconds };
+
+        while (!deadline.hasExpired())
+        {
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+        }
+    }
+
+    void ProcessEventsUntilResult(int milliseconds)
+    {
+        const QDeadlineTimer deadline{ milliseconds };
+
+        while (std::empty(mResults) && std::empty(mErrors) && std::empty(mPreviews) && !deadline.hasExpired())
+        {
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+        }
+    }
+
+protected:
+    MathEvaluatorController mController;
+
+    std::vector<double> mResults;
+    QStringList mResultTexts;
+    QStringList mErrors;
+    std::vector<double> mPreviews;
+};
+
+TEST_F(MathEvaluatorControllerTest, DeliversOnlyTheLatestAsyncResult)
+{
+    mController.EvaluateAsync(QStringLiteral("1+2"));
+    mController.EvaluateAsync(QStringLiteral("3*4"));
+
+    // The first request is dropped whenever it finishes, so waiting longer must not bring it in.
+    ProcessEventsUntilResult(5000);
+    ProcessEventsFor(200);
+
+    ASSERT_EQ(std::size(mResults), 1);
+    EXPECT_EQ(mResults[0], 12.0);
+    EXPECT_TRUE(mErrors.isEmpty());
+    EXPECT_EQ(mController.GetResult(), 12.0);
+}
+
+TEST_F(MathEvaluatorControllerTest, DropsTheErrorOfASupersededRequest)
+{
+    mController.EvaluateAsync(QStringLiteral("1+"));
+    mController.EvaluateAsync(QStringLiteral("2^10"));
+
+    ProcessEventsUntilResult(5000);
+    ProcessEventsFor(200);
+
+    ASSERT_EQ(std::size(mResults), 1);
+    EXPECT_EQ(mResults[0], 1024.0);
+    EXPECT_TRUE(mErrors.isEmpty());
+}
+
+TEST_F(MathEvaluatorControllerTest, AsyncResultCarriesTheResultText)
+{
+    mController.EvaluateAsync(QStringLiteral("2^64"));
+
+    ProcessEventsUntilResult(5000);
+
+    ASSERT_EQ(std::size(mResultTexts), 1);
+    EXPECT_EQ(mResultTexts[0], QStringLiteral("18446744073709551616"));
+    EXPECT_EQ(mController.GetResultText(), mResultTexts[0]);
+}
+
+TEST_F(MathEvaluatorControllerTest, DeliversOnlyTheLatestPreview)
+{
+    mController.PreviewAsync(QStringLiteral("1"));
+    mController.PreviewAsync(QStringLiteral("1+"));
+    mController.PreviewAsync(QStringLiteral("1+2"));
+    mController.PreviewAsync(QStringLiteral("1+2*3"));
+
+    ProcessEventsUntilResult(5000);
+    ProcessEventsFor(200);
+
+    ASSERT_EQ(std::size(mPreviews), 1);
+    EXPECT_EQ(mPreviews[0], 7.0);
+    EXPECT_TRUE(std::empty(mResults));
+}
+
+TEST_F(MathEvaluatorControllerTest, DropsThePreviewOfAnEvaluatedExpression)
+{
+    mController.PreviewAsync(QStringLiteral("2*5"));
+    mController.EvaluateAsync(QStringLiteral("2*5"));
+
+    ProcessEventsUntilResult(5000);
+    ProcessEventsFor(200);
+
+    ASSERT_EQ(std::size(mResults), 1);
+    EXPECT_EQ(mResults[0], 10.0);
+    EXPECT_TRUE(std::empty(mPreviews));
+}
+
+TEST_F(MathEvaluatorControllerTest, OverflowedIntegersKeepTheirDigitsWithinBounds)
+{
+    ASSERT_TRUE(mController.Evaluate(QStringLiteral("2^64")));
+    EXPECT_EQ(mController.GetResultText(), QStringLiteral("18446744073709551616"));
+
+    // Far too long for the bignum, the double's text is shown instead of waiting for the digits.
+    const QDeadlineTimer deadline{ 5000 };
+    ASSERT_TRUE(mController.Evaluate(QStringLiteral("9^4096^4096")));
+    EXPECT_FALSE(deadline.hasExpired());
+    EXPECT_EQ(mController.GetResultText(), mController.FormatNumber(mController.GetResult()));
+}
\ No newline at end of file
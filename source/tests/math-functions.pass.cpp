@@ -0,0 +1,111 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+#include <math-functions.hpp>
+
+class MathFunctionsTest : public ::testing::Test
+{
+protected:
+    // Number of doubles between the two values, 0 for equal values and for two NaNs.
+    static std::uint64_t UlpDistance(double first, double second)
+    {
+        if (std::isnan(first) || std::isnan(second))
+        {
+            return std::isnan(first) && std::isnan(second) ? 0 : std::numeric_limits<std::uint64_t>::max();
+        }
+
+        // Maps the sign-magnitude bit patterns onto a monotonic integer line, -0 and +0 meet at 0.
+        auto Ordered = [](double value)
+        {
+            const auto bits{ std::bit_cast<std::int64_t>(value) };
+            return bits < 0 ? std::numeric_limits<std::int64_t>::min() - bits : bits;
+        };
+
+        const auto lhs{ Ordered(first) };
+        const auto rhs{ Ordered(second) };
+
+        return lhs > rhs ? static_cast<std::uint64_t>(lhs) - static_cast<std::uint64_t>(rhs) : static_cast<std::uint64_t>(rhs) - static_cast<std::uint64_t>(lhs);
+    }
+};
+
+TEST_F(MathFunctionsTest, IntegerPowerWithinOneUlpOfPow)
+{
+    std::mt19937_64 generator{ 42 };
+
+    // Bases around 1, where the steps cancel least, and far from it, close to overflow and underflow for larger exponents.
+    const std::array distributions{ std::uniform_real_distribution{ -2.0, 2.0 }, std::uniform_real_distribution{ -1e3, 1e3 }, std::uniform_real_distribution{ 1e-30, 1e30 } };
+
+    for (auto exponent{ -MathFunctions::kMaxSquaringExponent }; exponent <= MathFunctions::kMaxSquaringExponent; ++exponent)
+    {
+        for (auto distribution : distributions)
+        {
+            for (std::size_t i{}; i < 20'000; ++i)
+            {
+                const auto base{ distribution(generator) };
+                const auto expected{ std::pow(base, static_cast<double>(exponent)) };
+
+                ASSERT_LE(UlpDistance(MathFunctions::IntegerPower(base, exponent), expected), 1) << base << "^" << exponent;
+            }
+        }
+    }
+}
+
+TEST_F(MathFunctionsTest, IntegerPowerSpecialValues)
+{
+    constexpr auto kInfinity{ std::numeric_limits<double>::infinity() };
+    constexpr auto kNaN{ std::numeric_limits<double>::quiet_NaN() };
+
+    const std::array<double, 9> bases{ 0.0, -0.0, kInfinity, -kInfinity, kNaN, 1e300, -1e-300, 1e-160, std::numeric_limits<double>::denorm_min() };
+
+    for (auto exponent{ -MathFunctions::kMaxSquaringExponent }; exponent <= MathFunctions::kMaxSquaringExponent; ++exponent)
+    {
+        for (const auto base : bases)
+        {
+            const auto expected{ std::pow(base, static_cast<double>(exponent)) };
+            const auto result{ MathFunctions::IntegerPower(base, exponent) };
+
+            ASSERT_EQ(UlpDistance(result, expected), 0) << base << "^" << exponent;
+            ASSERT_EQ(std::signbit(result), std::signbit(expected)) << base << "^" << exponent;
+        }
+    }
+}
+
+TEST_F(MathFunctionsTest, PowerKeepsStdPowForOtherExponents)
+{
+    ASSERT_EQ(MathFunctions::Power(2.0, 0.5), std::pow(2.0, 0.5));
+    ASSERT_EQ(MathFunctions::Power(1.5, 40.0), std::pow(1.5, 40.0));
+    ASSERT_TRUE(std::isnan(MathFunctions::Power(-8.0, 1.0 / 3.0)));
+    ASSERT_TRUE(std::isnan(MathFunctions::Power(2.0, std::numeric_limits<double>::quiet_NaN())));
+
+    ASSERT_EQ(MathFunctions::Power(3.0, 4.0), 81.0);
+    ASSERT_EQ(MathFunctions::Power(2.0, -3.0), 0.125);
+    ASSERT_EQ(MathFunctions::Power(std::numeric_limits<double>::quiet_NaN(), 0.0), 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <gtest/gtest.h>
+
+#include <number-formatter.hpp>
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class NumberFormatterTest : public ::testing::Test
+{
+protected:
+    [[nodiscard]] static std::string Format(double value, Utils::NumberFormatter::Notation notation = Utils::NumberFormatter::Notation::Shortest, int precision = -1)
+    {
+        std::array<char, Utils::NumberFormatter::kMaxLength> buffer{};
+        const auto length{ Utils::NumberFormatter{ notation, precision }.Format(value, buffer) };
+
+        return { std::data(buffer), length };
+    }
+};
+
+TEST_F(NumberFormatterTest, ShortestRoundTrip)
+{
+    ASSERT_EQ(Format(0.1), "0.1");
+    ASSERT_EQ(Format(0.1 + 0.2), "0.30000000000000004");
+    ASSERT_EQ(Format(-2.5), "-2.5");
+    ASSERT_EQ(Format(100.0), "100");
+    ASSERT_EQ(Format(1e21), "1e+21");
+    ASSERT_EQ(Format(1.0 / 3.0), "0.3333333333333333");
+    ASSERT_EQ(Format(std::numeric_limits<double>::infinity()), "inf");
+    ASSERT_EQ(Format(-std::numeric_limits<double>::infinity()), "-inf");
+
+    std::mt19937_64 generator{ 42 };
+    for (int i{}; i < 100'000; ++i)
+    {
+        const auto value{ std::bit_cast<double>(generator()) };
+        if (!std::isfinite(value))
+        {
+            continue;
+        }
+
+        const auto text{ Format(value) };
+        ASSERT_EQ(std::strtod(text.c_str(), nullptr), value) << text;
+
+        // Not longer than the 17 significant digits which always round trip.
+        std::array<char, 64> reference{};
+        const auto reference_length{ std::snprintf(std::data(reference), std::size(reference), "%.17g", value) };
+        ASSERT_LE(std::ssize(text), reference_length) << text;
+    }
+}
+
+TEST_F(NumberFormatterTest, PrecisionAndNotation)
+{
+    using Notation = Utils::NumberFormatter::Notation;
+
+    const std::array values{ 0.0, 1.0, -2.5, 3.14159265358979, 1234567.891, 1e-7, 6.02214076e23, 1e308, 5e-324 };
+
+    for (const auto value : values)
+    {
+        for (const int precision : { 0, 2, 6, 17 })
+        {
+            std::array<char, 512> reference{};
+
+            std::snprintf(std::data(reference), std::size(reference), "%.*f", precision, value);
+            ASSERT_EQ(Format(value, Notation::Fixed, precision), std::data(reference));
+
+            std::snprintf(std::data(reference), std::size(reference), "%.*e", precision, value);
+            ASSERT_EQ(Format(value, Notation::Scientific, precision), std::data(reference));
+
+            std::snprintf(std::data(reference), std::size(reference), "%.*g", precision, value);
+            ASSERT_EQ(Format(value, Notation::Shortest, precision), std::data(reference));
+        }
+    }
+
+    ASSERT_EQ(Format(1234.5, Notation::Fixed), "1234.5");
+    ASSERT_EQ(Format(1234.5, Notation::Scientific), "1.2345e+03");
+    ASSERT_EQ(Format(-std::numeric_limits<double>::max(), Notation::Fixed, Utils::NumberFormatter::kMaxPrecision).size(), Utils::NumberFormatter::kMaxLength);
+
+    // Out of range precisions fall back to the shortest round trip.
+    ASSERT_EQ(Utils::NumberFormatter(Notation::Fixed, Utils::NumberFormatter::kMaxPrecision + 1).GetPrecision(), Utils::NumberFormatter::kShortestPrecision);
+}
+
+TEST_F(NumberFormatterTest, CallerBuffers)
+{
+    const Utils::NumberFormatter number_formatter{};
+
+    std::array<char, 4> small{ 'x', 'x', 'x', 'x' };
+    ASSERT_EQ(number_formatter.Format(12345.0, small), 0);
+    ASSERT_EQ(number_formatter.Format(1234.0, small), 4);
+    ASSERT_EQ(std::string_view(std::data(small), 4), "1234");
+
+    const std::vector values{ 1.5, -2.0, 0.1, 1e100, 7.0 };
+    std::array<char, 64> buffer{};
+    std::size_t value_count{};
+
+    auto length{ number_formatter.Format(values, ',', buffer, value_count) };
+    ASSERT_EQ(value_count, std::size(values));
+    ASSERT_EQ(std::string_view(std::data(buffer), length), "1.5,-2,0.1,1e+100,7");
+
+    // Stops at the first value which does not fit, without a dangling separator.
+    length = number_formatter.Format(values, '\n', std::span{ buffer }.first(12), value_count);
+    ASSERT_EQ(value_count, 3);
+    ASSERT_EQ(std::string_view(std::data(buffer), length), "1.5\n-2\n0.1");
+}
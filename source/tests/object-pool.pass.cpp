@@ -0,0 +1,108 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <object-pool.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+class ObjectPoolTest : public ::testing::Test
+{
+protected:
+    struct Counter
+    {
+        std::size_t mUses{};
+        std::atomic<bool> mInUse{};
+    };
+};
+
+TEST_F(ObjectPoolTest, ReleasedObjectIsReused)
+{
+    Utils::ObjectPool<Counter> pool{ 1 };
+
+    Counter* first{};
+    {
+        auto handle{ pool.Acquire() };
+        ASSERT_TRUE(handle.IsPooled());
+
+        handle->mUses++;
+        first = &*handle;
+    }
+
+    auto handle{ pool.Acquire() };
+    ASSERT_EQ(&*handle, first);
+    ASSERT_EQ(handle->mUses, 1);
+}
+
+TEST_F(ObjectPoolTest, ExhaustedPoolFallsBackToHeap)
+{
+    Utils::ObjectPool<Counter> pool{ 2 };
+
+    auto first{ pool.Acquire() };
+    auto second{ pool.Acquire() };
+    auto third{ pool.Acquire() };
+
+    ASSERT_TRUE(first.IsPooled());
+    ASSERT_TRUE(second.IsPooled());
+    ASSERT_FALSE(third.IsPooled());
+
+    ASSERT_NE(&*first, &*second);
+    ASSERT_NE(&*second, &*third);
+}
+
+TEST_F(ObjectPoolTest, ConcurrentCallersGetPrivateObjects)
+{
+    constexpr std::uint32_t kThreads{ 4 };
+    Utils::ObjectPool<Counter> pool{ kThreads };
+
+    std::atomic<bool> is_shared{ false };
+    std::vector<std::thread> threads{};
+
+    for (std::uint32_t i{}; i < kThreads; ++i)
+    {
+        threads.emplace_back([&pool, &is_shared]()
+        {
+            for (std::size_t j{}; j < 10'000; ++j)
+            {
+                auto handle{ pool.Acquire() };
+
+                if (handle->mInUse.exchange(true))
+                {
+                    is_shared = true;
+                }
+
+                handle->mUses++;
+                handle->mInUse = false;
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_FALSE(is_shared);
+}
\ No newline at end of file
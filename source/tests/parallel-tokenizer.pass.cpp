@@ -0,0 +1,129 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <tokenizer.hpp>
+#include <parallel-tokenizer.hpp>
+
+#include <random>
+#include <string_view>
+
+class ParallelTokenizerTest : public ::testing::Test
+{
+protected:
+    // Tokens, values and errors must be exactly those of Tokenizer, whatever the chunk boundaries cut.
+    void ExpectSameAsTokenizer(const QString& input)
+    {
+        mTokenizer.Init(input);
+        mTokenizer.Run();
+
+        for (const qsizetype chunk_size : { 1, 2, 3, 5, 8, 64 })
+        {
+            ParallelTokenizer parallel_tokenizer{ 3, chunk_size };
+            parallel_tokenizer.Init(input);
+            parallel_tokenizer.Run();
+
+            ASSERT_EQ(parallel_tokenizer.HasError(), mTokenizer.HasError()) << input.toStdString();
+            ASSERT_EQ(parallel_tokenizer.GetErrorMessage(), mTokenizer.GetErrorMessage()) << input.toStdString();
+            ASSERT_EQ(parallel_tokenizer.GetTokens(), mTokenizer.GetTokens()) << input.toStdString() << ", chunk size " << chunk_size;
+
+            for (std::size_t i{}; i < std::size(mTokenizer.GetTokens()); ++i)
+            {
+                ASSERT_EQ(parallel_tokenizer.GetTokens()[i].mValue, mTokenizer.GetTokens()[i].mValue);
+            }
+        }
+    }
+
+    // Random operand: number, variable, call, negated operand or parenthesized expression.
+    QString MakeOperand(int depth)
+    {
+        switch (std::uniform_int_distribution{ 0, depth > 0 ? 5 : 2 }(mGenerator))
+        {
+        case 0:
+            return QString::number(std::uniform_int_distribution{ 0, 100'000 }(mGenerator));
+        case 1:
+            return QString::number(std::uniform_int_distribution{ 0, 999 }(mGenerator)) + QStringLiteral(".") + QString::number(std::uniform_int_distribution{ 0, 99'999 }(mGenerator));
+        case 2:
+            return std::uniform_int_distribution{ 0, 1 }(mGenerator) == 0 ? QStringLiteral("x_1") : QStringLiteral("rate");
+        case 3:
+            return QStringLiteral("max(") + MakeExpression(depth - 1) + QStringLiteral(",(-") + MakeOperand(0) + QStringLiteral("))");
+        case 4:
+            return QStringLiteral("(-sin(") + MakeExpression(depth - 1) + QStringLiteral("))");
+        default:
+            return QStringLiteral("(") + MakeExpression(depth - 1) + QStringLiteral(")");
+        }
+    }
+
+    QString MakeExpression(int depth)
+    {
+        constexpr std::string_view kOperators{ "+-*/^" };
+
+        auto expression{ MakeOperand(depth) };
+        for (int i{ std::uniform_int_distribution{ 0, 4 }(mGenerator) }; i > 0; --i)
+        {
+            expression += QChar{ static_cast<char16_t>(kOperators[std::uniform_int_distribution<std::size_t>{ 0, std::size(kOperators) - 1 }(mGenerator)]) };
+            expression += MakeOperand(depth);
+        }
+
+        return expression;
+    }
+
+protected:
+    Tokenizer mTokenizer;
+    std::mt19937 mGenerator{ 42 };
+};
+
+TEST_F(ParallelTokenizerTest, ValidExpressions)
+{
+    ExpectSameAsTokenizer(QStringLiteral("1"));
+    ExpectSameAsTokenizer(QStringLiteral("sin(x)+12.5"));
+    ExpectSameAsTokenizer(QStringLiteral("123456789.123456789*abcdefgh_42"));
+
+    for (int i{}; i < 200; ++i)
+    {
+        ExpectSameAsTokenizer(MakeExpression(3));
+    }
+}
+
+TEST_F(ParallelTokenizerTest, ErrorsMatchTokenizer)
+{
+    ExpectSameAsTokenizer(QString{});
+    ExpectSameAsTokenizer(QStringLiteral("-1"));
+    ExpectSameAsTokenizer(QStringLiteral("1+"));
+    ExpectSameAsTokenizer(QStringLiteral("2x"));
+    ExpectSameAsTokenizer(QStringLiteral("1..5"));
+
+    // Random strings over the alphabet of the grammar, most of them fail somewhere.
+    constexpr std::string_view kAlphabet{ "0123456789.+-*/^(),ax_ #" };
+
+    for (int i{}; i < 300; ++i)
+    {
+        QString input{};
+        for (int length{ std::uniform_int_distribution{ 1, 12 }(mGenerator) }; length > 0; --length)
+        {
+            input += QChar{ static_cast<char16_t>(kAlphabet[std::uniform_int_distribution<std::size_t>{ 0, std::size(kAlphabet) - 1 }(mGenerator)]) };
+        }
+
+        ExpectSameAsTokenizer(input);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <parenthesis-matcher.hpp>
+
+#include <random>
+#include <string_view>
+#include <vector>
+
+class ParenthesisMatcherTest : public ::testing::Test
+{
+protected:
+    struct Expected
+    {
+        qsizetype mErrorOffset;
+        qsizetype mMaxDepth;
+        std::vector<ParenthesisMatcher::Pair> mPairs;
+    };
+
+    // Character by character with a stack.
+    static Expected Reference(const QString& input)
+    {
+        Expected expected{ -1, 0, {} };
+        std::vector<std::size_t> open{};
+
+        for (qsizetype i{}; i < input.size(); ++i)
+        {
+            if (input[i] == QChar{ u'(' })
+            {
+                open.push_back(std::size(expected.mPairs));
+                expected.mPairs.push_back({ i, -1 });
+                expected.mMaxDepth = std::max(expected.mMaxDepth, static_cast<qsizetype>(std::size(open)));
+            }
+            else if (input[i] == QChar{ u')' })
+            {
+                if (std::empty(open))
+                {
+                    expected.mErrorOffset = i;
+                    return expected;
+                }
+
+                expected.mPairs[open.back()].mRight = i;
+                open.pop_back();
+            }
+        }
+
+        if (!std::empty(open))
+        {
+            expected.mErrorOffset = expected.mPairs[open.front()].mLeft;
+        }
+
+        return expected;
+    }
+
+    void ExpectSameAsReference(const QString& input)
+    {
+        const auto expected{ Reference(input) };
+
+        ASSERT_EQ(mParenthesisMatcher.Check(input), expected.mErrorOffset < 0) << input.toStdString();
+        ASSERT_EQ(mParenthesisMatcher.GetErrorOffset(), expected.mErrorOffset) << input.toStdString();
+
+        if (expected.mErrorOffset < 0)
+        {
+            ASSERT_EQ(mParenthesisMatcher.GetMaxDepth(), expected.mMaxDepth) << input.toStdString();
+        }
+
+        ASSERT_EQ(mParenthesisMatcher.Match(input), expected.mErrorOffset < 0) << input.toStdString();
+        ASSERT_EQ(mParenthesisMatcher.GetErrorOffset(), expected.mErrorOffset) << input.toStdString();
+
+        if (expected.mErrorOffset < 0)
+        {
+            ASSERT_EQ(mParenthesisMatcher.GetMaxDepth(), expected.mMaxDepth) << input.toStdString();
+            ASSERT_EQ(std::size(mParenthesisMatcher.GetPairs()), std::size(expected.mPairs));
+
+            for (const auto& [left, right] : expected.mPairs)
+            {
+                ASSERT_EQ(mParenthesisMatcher.FindMatch(left), right) << input.toStdString();
+            }
+        }
+    }
+
+protected:
+    ParenthesisMatcher mParenthesisMatcher;
+};
+
+TEST_F(ParenthesisMatcherTest, Offsets)
+{
+    ASSERT_TRUE(mParenthesisMatcher.Match(QStringLiteral("max(1,(2+3)*4)-(5)")));
+    ASSERT_EQ(mParenthesisMatcher.FindMatch(3), 13);
+    ASSERT_EQ(mParenthesisMatcher.FindMatch(6), 10);
+    ASSERT_EQ(mParenthesisMatcher.FindMatch(15), 17);
+    ASSERT_EQ(mParenthesisMatcher.FindMatch(4), -1);
+    ASSERT_EQ(mParenthesisMatcher.GetMaxDepth(), 2);
+
+    ASSERT_FALSE(mParenthesisMatcher.Check(QStringLiteral("(1+2))*(3")));
+    ASSERT_EQ(mParenthesisMatcher.GetErrorOffset(), 5);
+    ASSERT_FALSE(mParenthesisMatcher.GetErrorMessage().isEmpty());
+
+    // The outermost parenthesis which is never closed, not the last one opened.
+    ASSERT_FALSE(mParenthesisMatcher.Check(QStringLiteral("(1)+((2)+(3")));
+    ASSERT_EQ(mParenthesisMatcher.GetErrorOffset(), 4);
+
+    ASSERT_TRUE(mParenthesisMatcher.Check(QString{}));
+    ASSERT_FALSE(mParenthesisMatcher.HasError());
+}
+
+TEST_F(ParenthesisMatcherTest, MatchesReference)
+{
+    std::mt19937 generator{ 42 };
+    constexpr std::string_view kAlphabet{ "((()))1+x" };
+
+    // Lengths around the block width leave every possible tail.
+    for (int i{}; i < 2000; ++i)
+    {
+        QString input{};
+        for (int length{ std::uniform_int_distribution{ 0, 40 }(generator) }; length > 0; --length)
+        {
+            input += QChar{ static_cast<char16_t>(kAlphabet[std::uniform_int_distribution<std::size_t>{ 0, std::size(kAlphabet) - 1 }(generator)]) };
+        }
+
+        ExpectSameAsReference(input);
+    }
+
+    // Long balanced input with the error far from the start.
+    QString input{};
+    for (int i{}; i < 20'000; ++i)
+    {
+        input += QStringLiteral("(1+(x*2))-");
+    }
+
+    ExpectSameAsReference(input + QStringLiteral("3"));
+    ExpectSameAsReference(input + QStringLiteral("3)"));
+    ExpectSameAsReference(QStringLiteral("(") + input + QStringLiteral("3"));
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+
+#include <register-compiler.hpp>
+#include <rpn-compiler.hpp>
+#include <rpn-evaluator.hpp>
+
+class RegisterVMTest : public ::testing::Test
+{
+protected:
+    [[nodiscard]] double EvaluateWithStack(const QString& expression)
+    {
+        mTokenizer.Init(expression);
+        mTokenizer.Run();
+
+        return RPNEvaluator::Evaluate(mRPNConverter.Convert(mTokenizer.GetTokens()));
+    }
+
+protected:
+    Tokenizer mTokenizer;
+    RPNConverter mRPNConverter;
+    RegisterCompiler mRegisterCompiler;
+};
+
+TEST_F(RegisterVMTest, ConstantExpressionsMatchStackEvaluator)
+{
+    const std::array<QString, 7> expressions
+    {
+        QStringLiteral("3+4*2/(1-5)^2^3"),
+        QStringLiteral("(-2.5)*(4-1)^2"),
+        QStringLiteral("100/(-4)-7"),
+        QStringLiteral("42"),
+        QStringLiteral("(-max(2,3))*sqrt(16)+sin(0)"),
+        QStringLiteral("((1+2)*(3+4))/((5-6)*(7+8))"),
+        QStringLiteral("1-2-3-4-5-6-7-8-9"),
+    };
+
+    for (const auto& expression : expressions)
+    {
+        const auto program{ mRegisterCompiler.Compile(expression) };
+
+        ASSERT_FALSE(mRegisterCompiler.HasError()) << expression.toStdString();
+        ASSERT_DOUBLE_EQ(program.Evaluate({}), EvaluateWithStack(expression)) << expression.toStdString();
+    }
+}
+
+TEST_F(RegisterVMTest, OneInstructionPerOperator)
+{
+    // Literals are frame operands, so only the two operators are executed.
+    const auto program{ mRegisterCompiler.Compile(QStringLiteral("2*3+4")) };
+
+    ASSERT_FALSE(mRegisterCompiler.HasError());
+    ASSERT_EQ(std::size(program.GetInstructions()), 2);
+    ASSERT_EQ(program.GetUsedRegisterCount(), 1);
+    ASSERT_EQ(program.GetSpillSlotCount(), 0);
+    ASSERT_DOUBLE_EQ(program.Evaluate({}), 10.0);
+}
+
+TEST_F(RegisterVMTest, DeepExpressionSpills)
+{
+    // Every product stays live until the innermost sum is done, more than the register file holds.
+    QString expression{ QStringLiteral("1") };
+    for (int i{ 1 }; i <= 40; ++i)
+    {
+        expression = QStringLiteral("(%1*2)+(").arg(i) + expression + QStringLiteral(")");
+    }
+
+    const auto program{ mRegisterCompiler.Compile(expression) };
+
+    ASSERT_FALSE(mRegisterCompiler.HasError());
+    ASSERT_EQ(program.GetUsedRegisterCount(), RegisterProgram::kRegisterCount);
+    ASSERT_GT(program.GetSpillSlotCount(), 0);
+    ASSERT_DOUBLE_EQ(program.Evaluate({}), EvaluateWithStack(expression));
+}
+
+TEST_F(RegisterVMTest, VariablesMatchCompiledRPNProgram)
+{
+    const auto expression{ QStringLiteral("rate*amount+rate^2-(-fee)/max(rate,amount)") };
+
+    const auto program{ mRegisterCompiler.Compile(expression) };
+    const auto rpn_program{ RPNCompiler{}.Compile(expression) };
+
+    ASSERT_FALSE(mRegisterCompiler.HasError());
+    ASSERT_EQ(program.GetVariables(), rpn_program.GetVariables());
+
+    const std::array<double, 3> bindings{ 0.5, 200.0, 3.0 };
+    ASSERT_DOUBLE_EQ(program.Evaluate(bindings), rpn_program.Evaluate(bindings));
+    ASSERT_TRUE(std::isnan(program.Evaluate(std::span{ bindings }.first(2))));
+
+    const auto single{ mRegisterCompiler.Compile(QStringLiteral("(-x)")) };
+    const std::array<double, 1> x{ 4.0 };
+    ASSERT_DOUBLE_EQ(single.Evaluate(x), -4.0);
+}
+
+TEST_F(RegisterVMTest, Errors)
+{
+    std::ignore = mRegisterCompiler.Compile(QStringLiteral("2x"));
+    ASSERT_TRUE(mRegisterCompiler.HasError());
+
+    std::ignore = mRegisterCompiler.Compile(QStringLiteral("(x+1"));
+    ASSERT_TRUE(mRegisterCompiler.HasError());
+
+    std::ignore = mRegisterCompiler.Compile(QStringLiteral("max(1)"));
+    ASSERT_TRUE(mRegisterCompiler.HasError());
+}
\ No newline at end of file
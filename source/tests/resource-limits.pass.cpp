@@ -0,0 +1,246 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <evaluation-pipeline.hpp>
+#include <rpn-integer-evaluator.hpp>
+#include <input-sources.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+class ResourceLimitsTest : public ::testing::Test
+{
+protected:
+    static QString Repeat(const QString& part, int count)
+    {
+        QString result{};
+        for (int i{}; i < count; ++i)
+        {
+            result += part;
+        }
+
+        return result;
+    }
+
+protected:
+    EvaluationPipeline mEvaluationPipeline;
+    Utils::ResourceLimits mLimits;
+};
+
+TEST_F(ResourceLimitsTest, UnlimitedByDefault)
+{
+    const auto expression{ Repeat(QStringLiteral("("), 1000) + QStringLiteral("1.5") + Repeat(QStringLiteral(")"), 1000) };
+
+    ASSERT_TRUE(mEvaluationPipeline.Run(expression));
+    ASSERT_EQ(mEvaluationPipeline.GetResult(), 1.5);
+}
+
+TEST_F(ResourceLimitsTest, InputLength)
+{
+    mLimits.mMaxInputLength = 5;
+    mEvaluationPipeline.SetLimits(mLimits);
+
+    ASSERT_TRUE(mEvaluationPipeline.Run(QStringLiteral("1+2*3")));
+    ASSERT_FALSE(mEvaluationPipeline.Run(QStringLiteral("1+2*34")));
+    ASSERT_EQ(mEvaluationPipeline.GetErrorMessage(), QStringLiteral("input longer than 5 characters"));
+
+    // Edits after a violation start over instead of resuming from the cut input.
+    ASSERT_TRUE(mEvaluationPipeline.Run(QStringLiteral("1+2*4")));
+    ASSERT_EQ(mEvaluationPipeline.GetResult(), 9.0);
+}
+
+TEST_F(ResourceLimitsTest, TokenCount)
+{
+    Tokenizer tokenizer{};
+
+    mLimits.mMaxTokenCount = 5;
+    tokenizer.SetLimits(mLimits);
+
+    tokenizer.Init(QStringLiteral("1+2*3"));
+    tokenizer.Run();
+    ASSERT_FALSE(tokenizer.HasError());
+
+    // The last token only comes from the end of the input.
+    tokenizer.Init(QStringLiteral("1+2*3-4"));
+    tokenizer.Run();
+    ASSERT_TRUE(tokenizer.HasError());
+    ASSERT_EQ(tokenizer.GetLimitViolation(), Utils::LimitViolation::TokenCount);
+
+    // A long input stops early, not at its end.
+    tokenizer.Init(Repeat(QStringLiteral("1+"), 100'000) + QStringLiteral("1"));
+    tokenizer.Run();
+    ASSERT_EQ(tokenizer.GetLimitViolation(), Utils::LimitViolation::TokenCount);
+    ASSERT_LE(std::size(tokenizer.GetTokens()), 7);
+
+    RPNConverter rpn_converter{};
+    std::vector<Tokenizer::TokenPair> rpn_expression{};
+
+    tokenizer.SetLimits({});
+    tokenizer.Init(QStringLiteral("1+2*3-4"));
+    tokenizer.Run();
+
+    rpn_converter.SetLimits(mLimits);
+    ASSERT_FALSE(rpn_converter.Convert(tokenizer.GetTokens(), rpn_expression));
+    ASSERT_EQ(rpn_converter.GetLimitViolation(), Utils::LimitViolation::TokenCount);
+    ASSERT_EQ(rpn_converter.GetErrorMessage(), QStringLiteral("more than 5 tokens"));
+}
+
+TEST_F(ResourceLimitsTest, NestingDepth)
+{
+    mLimits.mMaxNestingDepth = 64;
+    mEvaluationPipeline.SetLimits(mLimits);
+
+    const auto nested = [this](int depth)
+    {
+        return Repeat(QStringLiteral("("), depth) + QStringLiteral("2") + Repeat(QStringLiteral(")"), depth);
+    };
+
+    ASSERT_TRUE(mEvaluationPipeline.Run(nested(64)));
+    ASSERT_TRUE(mEvaluationPipeline.Run(QStringLiteral("max(") + nested(63) + QStringLiteral(",1)")));
+
+    ASSERT_FALSE(mEvaluationPipeline.Run(nested(65)));
+    ASSERT_EQ(mEvaluationPipeline.GetErrorMessage(), QStringLiteral("nesting deeper than 64"));
+
+    ASSERT_FALSE(mEvaluationPipeline.Run(nested(1'000'000)));
+    ASSERT_EQ(mEvaluationPipeline.GetErrorMessage(), QStringLiteral("nesting deeper than 64"));
+}
+
+TEST_F(ResourceLimitsTest, OperandStackDepth)
+{
+    // Every 1.5 waits for the sum nested to its right: 21 operands before the first addition.
+    const auto expression{ Repeat(QStringLiteral("1.5+("), 20) + QStringLiteral("1") + Repeat(QStringLiteral(")"), 20) };
+
+    Tokenizer tokenizer{};
+    tokenizer.Init(expression);
+    tokenizer.Run();
+
+    RPNConverter rpn_converter{};
+    const auto rpn_expression{ rpn_converter.Convert(tokenizer.GetTokens()) };
+
+    // Nested deep enough for the stack, not for the nesting limit.
+    mLimits.mMaxNestingDepth = 64;
+
+    std::vector<double> operands{};
+    Utils::LimitViolation violation{};
+
+    mLimits.mMaxOperandStackDepth = 21;
+    ASSERT_EQ(RPNEvaluator::Evaluate(rpn_expression, operands, mLimits, violation), RPNEvaluator::Evaluate(rpn_expression));
+    ASSERT_EQ(violation, Utils::LimitViolation::None);
+
+    mLimits.mMaxOperandStackDepth = 20;
+    ASSERT_TRUE(std::isnan(RPNEvaluator::Evaluate(rpn_expression, operands, mLimits, violation)));
+    ASSERT_EQ(violation, Utils::LimitViolation::OperandStackDepth);
+
+    mEvaluationPipeline.SetLimits(mLimits);
+    ASSERT_FALSE(mEvaluationPipeline.Run(expression));
+    ASSERT_EQ(mEvaluationPipeline.GetErrorMessage(), QStringLiteral("operand stack deeper than 20"));
+
+    // A streamed input is checked between its batches. The additions only come with the closing 
+    // parentheses, every batch of 8 tokens before them adds about 3 operands.
+    mLimits.mMaxOperandStackDepth = 12;
+    mEvaluationPipeline.SetLimits(mLimits);
+
+    const auto text{ expression.toStdString() };
+    bool has_read_error{};
+
+    auto input{ Utils::InputSources::FromChunks([&text, position = std::size_t{}](std::span<char> buffer) mutable -> qsizetype
+    {
+        const auto size{ std::min(std::size(buffer), std::size(text) - position) };
+        std::memcpy(std::data(buffer), std::data(text) + position, size);
+        position += size;
+
+        return static_cast<qsizetype>(size);
+    }, has_read_error) };
+
+    ASSERT_FALSE(mEvaluationPipeline.RunStream(std::move(input), has_read_error, 8));
+    ASSERT_EQ(mEvaluationPipeline.GetErrorMessage(), QStringLiteral("operand stack deeper than 12"));
+}
+
+TEST_F(ResourceLimitsTest, IntegerOnlyExpressions)
+{
+    // The exact integer path is governed as well.
+    const auto expression{ Repeat(QStringLiteral("1+("), 20) + QStringLiteral("1") + Repeat(QStringLiteral(")"), 20) };
+
+    mLimits.mMaxOperandStackDepth = 21;
+    mEvaluationPipeline.SetLimits(mLimits);
+
+    ASSERT_TRUE(mEvaluationPipeline.Run(expression));
+    ASSERT_EQ(mEvaluationPipeline.GetResult(), 21.0);
+
+    mLimits.mMaxOperandStackDepth = 20;
+    mEvaluationPipeline.SetLimits(mLimits);
+
+    ASSERT_FALSE(mEvaluationPipeline.Run(expression));
+    ASSERT_EQ(mEvaluationPipeline.GetErrorMessage(), QStringLiteral("operand stack deeper than 20"));
+    ASSERT_EQ(mEvaluationPipeline.GetIntegerResult().mOutcome, RPNIntegerEvaluator::Outcome::LimitExceeded);
+
+    Tokenizer tokenizer{};
+    tokenizer.Init(expression);
+    tokenizer.Run();
+
+    RPNConverter rpn_converter{};
+    const auto rpn_expression{ rpn_converter.Convert(tokenizer.GetTokens()) };
+
+    std::vector<std::int64_t> operands{};
+    Utils::LimitViolation violation{};
+
+    Utils::ResourceLimits past_deadline{};
+    past_deadline.mDeadline = Utils::ResourceLimits::Clock::now();
+    past_deadline.mDeadlineCheckInterval = 1;
+
+    ASSERT_EQ(RPNIntegerEvaluator::Evaluate(rpn_expression, operands, past_deadline, violation).mOutcome, RPNIntegerEvaluator::Outcome::LimitExceeded);
+    ASSERT_EQ(violation, Utils::LimitViolation::Deadline);
+
+    ASSERT_EQ(RPNIntegerEvaluator::Evaluate(rpn_expression, operands, Utils::ResourceLimits{}, violation).mValue, 21);
+    ASSERT_EQ(violation, Utils::LimitViolation::None);
+}
+
+TEST_F(ResourceLimitsTest, Deadline)
+{
+    const auto expression{ QStringLiteral("0") + Repeat(QStringLiteral("+1.5*2"), 100'000) };
+
+    mLimits.mDeadline = Utils::ResourceLimits::Clock::now() + std::chrono::hours{ 1 };
+    mEvaluationPipeline.SetLimits(mLimits);
+    ASSERT_TRUE(mEvaluationPipeline.Run(expression));
+
+    // Already past, the tokenizer reads the clock after 256 characters and stops there.
+    mLimits.mDeadline = Utils::ResourceLimits::Clock::now();
+    mLimits.mDeadlineCheckInterval = 256;
+
+    Tokenizer tokenizer{};
+    tokenizer.SetLimits(mLimits);
+    tokenizer.Init(expression);
+    tokenizer.Run();
+
+    ASSERT_EQ(tokenizer.GetLimitViolation(), Utils::LimitViolation::Deadline);
+    ASSERT_EQ(tokenizer.GetErrorMessage(), QStringLiteral("deadline exceeded"));
+    ASSERT_LE(std::size(tokenizer.GetTokens()), 256);
+
+    mEvaluationPipeline.SetLimits(mLimits);
+    ASSERT_FALSE(mEvaluationPipeline.Run(expression));
+    ASSERT_EQ(mEvaluationPipeline.GetErrorMessage(), QStringLiteral("deadline exceeded"));
+}
@@ -0,0 +1,127 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <result-memo.hpp>
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+class ResultMemoTest : public ::testing::Test
+{ };
+
+TEST_F(ResultMemoTest, KeysDependOnExpressionAndBindings)
+{
+    const std::array bindings{ 1.5, -2.0 };
+    const std::array other_bindings{ 1.5, 2.0 };
+
+    ASSERT_EQ(ResultMemo::MakeKey(QStringLiteral("x*y+1"), bindings), ResultMemo::MakeKey(QStringLiteral("x*y+1"), bindings));
+    ASSERT_FALSE(ResultMemo::MakeKey(QStringLiteral("x*y+1"), bindings) == ResultMemo::MakeKey(QStringLiteral("x*y+1"), other_bindings));
+    ASSERT_FALSE(ResultMemo::MakeKey(QStringLiteral("x*y+1")) == ResultMemo::MakeKey(QStringLiteral("x*y+2")));
+
+    // Trailing zero code units are told apart by the length.
+    ASSERT_FALSE(ResultMemo::MakeKey(QStringLiteral("1+2")) == ResultMemo::MakeKey(QString{ QStringLiteral("1+2") } + QChar{ u'\0' }));
+}
+
+TEST_F(ResultMemoTest, EvictsWithinTheMemoryCap)
+{
+    // One shard of 64 slots, at most 48 entries.
+    ResultMemo result_memo{ 64 * 25, 1 };
+    ASSERT_EQ(result_memo.GetStatistics().mCapacity, 48);
+
+    for (int i{}; i < 1000; ++i)
+    {
+        result_memo.Insert(ResultMemo::MakeKey(QString::number(i)), i);
+
+        // Entry 0 is looked up all the time, CLOCK keeps it.
+        ASSERT_EQ(result_memo.Find(ResultMemo::MakeKey(QString::number(0))), 0.0);
+    }
+
+    const auto statistics{ result_memo.GetStatistics(0) };
+    ASSERT_EQ(statistics.mSize, 48);
+    ASSERT_EQ(statistics.mInsertions, 1000);
+    ASSERT_EQ(statistics.mEvictions, 1000 - 48);
+
+    // Every entry still present is found at its value after all the moves of the evictions.
+    std::size_t found{};
+    for (int i{}; i < 1000; ++i)
+    {
+        if (const auto value{ result_memo.Find(ResultMemo::MakeKey(QString::number(i))) }; value.has_value())
+        {
+            ASSERT_EQ(*value, i);
+            ++found;
+        }
+    }
+
+    ASSERT_EQ(found, 48);
+
+    result_memo.Clear();
+    ASSERT_FALSE(result_memo.Find(ResultMemo::MakeKey(QString::number(0))).has_value());
+}
+
+TEST_F(ResultMemoTest, SharedAcrossThreads)
+{
+    ResultMemo result_memo{};
+
+    std::vector<QString> expressions{};
+    for (int i{}; i < 64; ++i)
+    {
+        expressions.push_back(QStringLiteral("(%1+0.5)*2-1").arg(i));
+    }
+
+    std::atomic<int> mismatches{};
+    std::vector<std::thread> threads{};
+
+    for (int thread{}; thread < 4; ++thread)
+    {
+        threads.emplace_back([&]
+        {
+            EvaluationPipeline pipeline{};
+
+            for (int round{}; round < 50; ++round)
+            {
+                for (int i{}; i < std::ssize(expressions); ++i)
+                {
+                    const auto value{ result_memo.Evaluate(pipeline, expressions[i]) };
+                    mismatches += !value.has_value() || *value != (i + 0.5) * 2 - 1;
+                }
+            }
+
+            mismatches += result_memo.Evaluate(pipeline, QStringLiteral("(1+")).has_value();
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(mismatches, 0);
+
+    const auto statistics{ result_memo.GetStatistics() };
+    ASSERT_EQ(statistics.mSize, std::size(expressions));
+    ASSERT_EQ(statistics.mHits + statistics.mMisses, 4 * (50 * std::size(expressions) + 1));
+    ASSERT_GE(statistics.mHits, 4 * 49 * std::size(expressions));
+}
\ No newline at end of file
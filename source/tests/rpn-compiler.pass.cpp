@@ -0,0 +1,403 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <rpn-compiler.hpp>
+#include <rpn-evaluator.hpp>
+#include <rpn-reassociator.hpp>
+
+#include <array>
+#include <cmath>
+#include <span>
+#include <vector>
+
+class RPNCompilerTest : public ::testing::Test
+{
+protected:
+    RPNCompiler mRPNCompiler;
+};
+
+TEST_F(RPNCompilerTest, ConstantExpressionsMatchRPNEvaluator)
+{
+    const std::array<QString, 4> expressions
+    {
+        QStringLiteral("3+4*2/(1-5)^2^3"),
+        QStringLiteral("(-2.5)*(4-1)^2"),
+        QStringLiteral("100/(-4)-7"),
+        QStringLiteral("42"),
+    };
+
+    for (const auto& expression : expressions)
+    {
+        Tokenizer tokenizer{};
+        tokenizer.Init(expression);
+        tokenizer.Run();
+
+        RPNConverter rpn_converter{};
+        const auto expected{ RPNEvaluator::Evaluate(rpn_converter.Convert(tokenizer.GetTokens())) };
+
+        const auto program{ mRPNCompiler.Compile(expression) };
+
+        ASSERT_FALSE(mRPNCompiler.HasError());
+        ASSERT_DOUBLE_EQ(program.Evaluate({}), expected);
+    }
+}
+
+TEST_F(RPNCompilerTest, VariablesResolveToDenseSlots)
+{
+    const auto program{ mRPNCompiler.Compile(QStringLiteral("rate*amount+rate^2-(-fee)")) };
+
+    ASSERT_FALSE(mRPNCompiler.HasError());
+    ASSERT_EQ(std::size(program.GetVariables()), 3);
+
+    ASSERT_EQ(program.GetSlot(QStringLiteral("rate")), 0);
+    ASSERT_EQ(program.GetSlot(QStringLiteral("amount")), 1);
+    ASSERT_EQ(program.GetSlot(QStringLiteral("fee")), 2);
+    ASSERT_FALSE(program.GetSlot(QStringLiteral("other")).has_value());
+
+    const std::array<double, 3> bindings{ 0.5, 200.0, 3.0 };
+    ASSERT_DOUBLE_EQ(program.Evaluate(bindings), 0.5 * 200.0 + 0.25 + 3.0);
+}
+
+TEST_F(RPNCompilerTest, Rebinding)
+{
+    const auto program{ mRPNCompiler.Compile(QStringLiteral("x_1*x_1-2*x_1+1")) };
+    ASSERT_FALSE(mRPNCompiler.HasError());
+
+    std::array<double, 1> bindings{};
+    for (double x{ -3.0 }; x <= 3.0; x += 0.5)
+    {
+        bindings[0] = x;
+        ASSERT_DOUBLE_EQ(program.Evaluate(bindings), (x - 1.0) * (x - 1.0));
+    }
+
+    ASSERT_TRUE(std::isnan(program.Evaluate({})));
+}
+
+TEST_F(RPNCompilerTest, Errors)
+{
+    std::ignore = mRPNCompiler.Compile(QStringLiteral("2x"));
+    ASSERT_TRUE(mRPNCompiler.HasError());
+
+    std::ignore = mRPNCompiler.Compile(QStringLiteral("x("));
+    ASSERT_TRUE(mRPNCompiler.HasError());
+
+    std::ignore = mRPNCompiler.Compile(QStringLiteral("(x+1"));
+    ASSERT_TRUE(mRPNCompiler.HasError());
+
+    std::ignore = mRPNCompiler.Compile(QStringLiteral("x+"));
+    ASSERT_TRUE(mRPNCompiler.HasError());
+
+    // Malformed RPN reaches the reassociator before the checks of the compiler.
+    mRPNCompiler.SetReassociation(true);
+
+    const std::vector<Tokenizer::TokenPair> operator_without_operands{ { QStringLiteral("+"), Tokenizer::Token::Operator } };
+    std::ignore = mRPNCompiler.Compile(operator_without_operands);
+    ASSERT_EQ(mRPNCompiler.GetErrorMessage(), QStringLiteral("operator without operands"));
+
+    const std::vector<Tokenizer::TokenPair> call_without_arguments{ { QStringLiteral("1"), Tokenizer::Token::Integer }, { QStringLiteral("max"), Tokenizer::Token::Function } };
+    std::ignore = mRPNCompiler.Compile(call_without_arguments);
+    ASSERT_EQ(mRPNCompiler.GetErrorMessage(), QStringLiteral("function without enough arguments"));
+
+    const std::vector<Tokenizer::TokenPair> two_values{ { QStringLiteral("1"), Tokenizer::Token::Integer }, { QStringLiteral("2"), Tokenizer::Token::Integer } };
+    std::ignore = mRPNCompiler.Compile(two_values);
+    ASSERT_EQ(mRPNCompiler.GetErrorMessage(), QStringLiteral("expression does not reduce to a single value"));
+}
+
+TEST_F(RPNCompilerTest, FunctionCallsMatchRPNEvaluator)
+{
+    const std::array<QString, 4> expressions
+    {
+        QStringLiteral("sin(1)^2+cos(1)^2"),
+        QStringLiteral("(-exp(log(2.5)))*sqrt(16)"),
+        QStringLiteral("max(min(3,-4),2)-1"),
+        QStringLiteral("log(sqrt(max(2,3)))"),
+    };
+
+    for (const auto& expression : expressions)
+    {
+        Tokenizer tokenizer{};
+        tokenizer.Init(expression);
+        tokenizer.Run();
+
+        RPNConverter rpn_converter{};
+        const auto expected{ RPNEvaluator::Evaluate(rpn_converter.Convert(tokenizer.GetTokens())) };
+
+        const auto program{ mRPNCompiler.Compile(expression) };
+
+        ASSERT_FALSE(mRPNCompiler.HasError());
+        ASSERT_DOUBLE_EQ(program.Evaluate({}), expected);
+    }
+
+    ASSERT_NEAR(mRPNCompiler.Compile(QStringLiteral("sin(1)^2+cos(1)^2")).Evaluate({}), 1.0, 1e-15);
+    ASSERT_DOUBLE_EQ(mRPNCompiler.Compile(QStringLiteral("(-exp(log(2.5)))*sqrt(16)")).Evaluate({}), -10.0);
+}
+
+TEST_F(RPNCompilerTest, ColumnEvaluationMatchesRowEvaluation)
+{
+    const auto program{ mRPNCompiler.Compile(QStringLiteral("x*sin(y)+max(x,(-exp(y)))/2")) };
+    ASSERT_FALSE(mRPNCompiler.HasError());
+
+    // More rows than one block and not a multiple of the vector width.
+    std::vector<double> xs(1'003);
+    std::vector<double> ys(std::size(xs));
+
+    for (std::size_t i{}; i < std::size(xs); ++i)
+    {
+        xs[i] = static_cast<double>(i) * 0.37 - 150.0;
+        ys[i] = static_cast<double>(i % 97) * 0.11 - 5.0;
+    }
+
+    const std::array<std::span<const double>, 2> columns{ xs, ys };
+    std::vector<double> output(std::size(xs));
+
+    program.Evaluate(columns, output);
+
+    for (std::size_t i{}; i < std::size(xs); ++i)
+    {
+        const std::array<double, 2> bindings{ xs[i], ys[i] };
+        ASSERT_NEAR(output[i], program.Evaluate(bindings), 1e-12 * std::max(1.0, std::fabs(output[i])));
+    }
+
+    const std::array<std::span<const double>, 1> missing_column{ xs };
+    program.Evaluate(missing_column, output);
+    ASSERT_TRUE(std::isnan(output.front()));
+}
+
+TEST_F(RPNCompilerTest, SuperinstructionsAreEmitted)
+{
+    using OpCode = RPNProgram::OpCode;
+
+    auto OpCodes = [](const RPNProgram& program)
+    {
+        std::vector<OpCode> op_codes{};
+        for (const auto& instruction : program.GetInstructions()) { op_codes.push_back(instruction.mOpCode); }
+        return op_codes;
+    };
+
+    const auto scaled{ mRPNCompiler.Compile(QStringLiteral("x*2+1")) };
+    ASSERT_EQ(OpCodes(scaled), (std::vector{ OpCode::PushVariable, OpCode::MultiplyConstant, OpCode::AddConstant, OpCode::Return }));
+
+    const auto multiply_add{ mRPNCompiler.Compile(QStringLiteral("z+x*y")) };
+    ASSERT_EQ(OpCodes(multiply_add), (std::vector{ OpCode::PushVariable, OpCode::PushVariable, OpCode::PushVariable, OpCode::MultiplyAdd, OpCode::Return }));
+
+    const auto multiply_add_constant{ mRPNCompiler.Compile(QStringLiteral("(-x)*y+2")) };
+    ASSERT_EQ(OpCodes(multiply_add_constant), (std::vector{ OpCode::PushNegatedVariable, OpCode::PushVariable, OpCode::MultiplyAddConstant, OpCode::Return }));
+
+    const std::array<double, 2> bindings{ 3.0, 5.0 };
+    ASSERT_DOUBLE_EQ(multiply_add_constant.Evaluate(bindings), -13.0);
+}
+
+TEST_F(RPNCompilerTest, FusedProgramsMatchRPNEvaluator)
+{
+    const std::array<QString, 6> expressions
+    {
+        QStringLiteral("2*3+1-4/8^2"),
+        QStringLiteral("1+2*3+4*5*6"),
+        QStringLiteral("(1.5+2)*(3-0.25)/7^0.5"),
+        QStringLiteral("(-2)^2+(-3)*(-4)"),
+        QStringLiteral("sin(2)*3+cos(1)*exp(0.5)"),
+        QStringLiteral("10-(-sqrt(4))*2+1"),
+    };
+
+    for (const auto& expression : expressions)
+    {
+        Tokenizer tokenizer{};
+        tokenizer.Init(expression);
+        tokenizer.Run();
+
+        RPNConverter rpn_converter{};
+        const auto expected{ RPNEvaluator::Evaluate(rpn_converter.Convert(tokenizer.GetTokens())) };
+
+        const auto program{ mRPNCompiler.Compile(expression) };
+        ASSERT_FALSE(mRPNCompiler.HasError());
+        ASSERT_DOUBLE_EQ(program.Evaluate({}), expected);
+
+        const std::array<std::span<const double>, 0> columns{};
+        std::array<double, 1> output{};
+
+        program.Evaluate(columns, output);
+        ASSERT_DOUBLE_EQ(output.front(), expected);
+    }
+}
+
+TEST_F(RPNCompilerTest, ConstantIntegerExponents)
+{
+    using OpCode = RPNProgram::OpCode;
+
+    auto PowerOpCode = [this](const QString& expression)
+    {
+        const auto program{ mRPNCompiler.Compile(expression) };
+        return program.GetInstructions()[1].mOpCode;
+    };
+
+    ASSERT_EQ(PowerOpCode(QStringLiteral("x^2")), OpCode::Square);
+    ASSERT_EQ(PowerOpCode(QStringLiteral("x^5")), OpCode::PowerInteger);
+    ASSERT_EQ(PowerOpCode(QStringLiteral("x^(-3)")), OpCode::PowerInteger);
+    ASSERT_EQ(PowerOpCode(QStringLiteral("x^0.5")), OpCode::PowerConstant);
+    ASSERT_EQ(PowerOpCode(QStringLiteral("x^20")), OpCode::PowerConstant);
+
+    const auto program{ mRPNCompiler.Compile(QStringLiteral("x^2+x^3*2-x^(-2)+x^7")) };
+    ASSERT_FALSE(mRPNCompiler.HasError());
+
+    for (const auto x : { -3.5, -0.75, 0.3, 1.25, 9.0 })
+    {
+        const std::array<double, 1> bindings{ x };
+        const auto expected{ std::pow(x, 2.0) + std::pow(x, 3.0) * 2 - std::pow(x, -2.0) + std::pow(x, 7.0) };
+
+        ASSERT_NEAR(program.Evaluate(bindings), expected, 1e-13 * std::fabs(expected));
+    }
+}
+
+TEST_F(RPNCompilerTest, ReassociatedChainsBecomeReductions)
+{
+    using OpCode = RPNProgram::OpCode;
+
+    const auto expression{ QStringLiteral("0.1+x+0.3*y*0.7+0.001+x*y*x+0.25+y+100000+3") };
+
+    const auto sequential{ mRPNCompiler.Compile(expression) };
+    ASSERT_FALSE(mRPNCompiler.IsReassociating());
+
+    mRPNCompiler.SetReassociation(true);
+    const auto reduced{ mRPNCompiler.Compile(expression) };
+    ASSERT_FALSE(mRPNCompiler.HasError());
+
+    auto Count = [](const RPNProgram& program, OpCode op_code)
+    {
+        std::size_t count{};
+        for (const auto& instruction : program.GetInstructions()) { count += instruction.mOpCode == op_code; }
+        return count;
+    };
+
+    ASSERT_EQ(Count(sequential, OpCode::Sum), 0);
+    ASSERT_EQ(Count(reduced, OpCode::Sum), 1);
+    ASSERT_EQ(Count(reduced, OpCode::Product), 2);
+
+    const std::array xs{ 0.5, -2.25, 1e-7, 3.0 };
+    const std::array ys{ 7.0, 0.125, -1e4, 1.0 / 3.0 };
+
+    std::array<double, std::size(xs)> output{};
+    const std::array<std::span<const double>, 2> columns{ xs, ys };
+    reduced.Evaluate(columns, output);
+
+    for (std::size_t i{}; i < std::size(xs); ++i)
+    {
+        const std::array<double, 2> bindings{ xs[i], ys[i] };
+
+        ASSERT_DOUBLE_EQ(reduced.Evaluate(bindings), sequential.Evaluate(bindings));
+        ASSERT_EQ(reduced.Evaluate(bindings), output[i]);
+    }
+
+    // The reduction instructions round like the balanced tree of the reassociator, bit for bit.
+    const auto constants{ QStringLiteral("0.1+0.2+0.3*1.1*0.7+0.001+(-0.9)+2^0.5*3*1.7+0.25+100000+3") };
+
+    Tokenizer tokenizer{};
+    tokenizer.Init(constants);
+    tokenizer.Run();
+
+    RPNConverter rpn_converter{};
+    const auto balanced{ RPNReassociator::Reassociate(rpn_converter.Convert(tokenizer.GetTokens())) };
+
+    ASSERT_EQ(mRPNCompiler.Compile(constants).Evaluate({}), RPNEvaluator::Evaluate(balanced));
+}
+TEST_F(RPNCompilerTest, PolynomialsContractToHorner)
+{
+    using OpCode = RPNProgram::OpCode;
+
+    auto Count = [](const RPNProgram& program, OpCode op_code)
+    {
+        std::size_t count{};
+        for (const auto& instruction : program.GetInstructions()) { count += instruction.mOpCode == op_code; }
+        return count;
+    };
+
+    const auto expression{ QStringLiteral("3*x^3+2*x^2+5*x+1") };
+
+    const auto written{ mRPNCompiler.Compile(expression) };
+    ASSERT_FALSE(mRPNCompiler.IsContracting());
+    ASSERT_EQ(Count(written, OpCode::Horner), 0);
+
+    mRPNCompiler.SetContraction(true);
+    const auto contracted{ mRPNCompiler.Compile(expression) };
+    ASSERT_FALSE(mRPNCompiler.HasError());
+
+    std::vector<OpCode> op_codes{};
+    for (const auto& instruction : contracted.GetInstructions()) { op_codes.push_back(instruction.mOpCode); }
+    ASSERT_EQ(op_codes, (std::vector{ OpCode::PushVariable, OpCode::Horner, OpCode::Return }));
+
+    for (const auto x : { -3.5, -0.75, 0.0, 0.3, 1.25, 9.0 })
+    {
+        const std::array<double, 1> bindings{ x };
+
+        ASSERT_EQ(contracted.Evaluate(bindings), std::fma(std::fma(std::fma(3.0, x, 2.0), x, 5.0), x, 1.0));
+        ASSERT_NEAR(contracted.Evaluate(bindings), written.Evaluate(bindings), 1e-13 * std::max(1.0, std::fabs(written.Evaluate(bindings))));
+    }
+
+    // Like terms and constant factors are folded, the rest of the expression keeps its code.
+    const std::array<QString, 6> partial
+    {
+        QStringLiteral("x^3/6-x^5/120+x-x^3"),
+        QStringLiteral("sin(x^2+x+1)*y+2"),
+        QStringLiteral("max(1+2*x+3*x^2+4*x^3,y)"),
+        QStringLiteral("x^2*3+1+y^2*3*y-2*y-y"),
+        QStringLiteral("(-x)^3-x^2+7"),
+        QStringLiteral("x*y*2+x^2+x*x*x*0.25"),
+    };
+
+    const std::array<std::size_t, 6> horner_counts{ 1, 1, 1, 2, 1, 1 };
+
+    const std::array xs{ -2.5, -1.0, 0.3, 1.7, 4.0 };
+    const std::array ys{ -1.5, 0.5, 2.0, 3.25, -0.125 };
+
+    for (std::size_t i{}; i < std::size(partial); ++i)
+    {
+        mRPNCompiler.SetContraction(false);
+        const auto expected{ mRPNCompiler.Compile(partial[i]) };
+
+        mRPNCompiler.SetContraction(true);
+        const auto program{ mRPNCompiler.Compile(partial[i]) };
+
+        ASSERT_FALSE(mRPNCompiler.HasError());
+        ASSERT_EQ(Count(program, OpCode::Horner), horner_counts[i]) << partial[i].toStdString();
+        ASSERT_LT(std::size(program.GetInstructions()), std::size(expected.GetInstructions())) << partial[i].toStdString();
+
+        std::array<double, std::size(xs)> output{};
+        const std::array<std::span<const double>, 2> columns{ xs, ys };
+        program.Evaluate(columns, output);
+
+        for (std::size_t row{}; row < std::size(xs); ++row)
+        {
+            const std::array<double, 2> bindings{ xs[row], ys[row] };
+            const auto value{ program.Evaluate(bindings) };
+
+            ASSERT_NEAR(value, expected.Evaluate(bindings), 1e-13 * std::max(1.0, std::fabs(value))) << partial[i].toStdString();
+            ASSERT_DOUBLE_EQ(value, output[row]) << partial[i].toStdString();
+        }
+    }
+
+    // Products of sums are not multiplied out, nor are polynomials mixing variables or powers beyond the degree limit.
+    for (const auto& kept : { QStringLiteral("(x+1)*(x+2)*(x+3)"), QStringLiteral("x^2+y^2+x+y"), QStringLiteral("x^40+x^2+1"), QStringLiteral("2^10-24") })
+    {
+        ASSERT_EQ(Count(mRPNCompiler.Compile(kept), OpCode::Horner), 0) << kept.toStdString();
+    }
+}
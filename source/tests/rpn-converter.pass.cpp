@@ -23,9 +23,11 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <vector>
 
 #include <tokenizer/tokenizer.hpp>
 #include <rpn-converter/rpn-converter.hpp>
+#include <rpn-converter/rpn-reassociator.hpp>
 
 #include <utils/logger/logger.hpp>
 
@@ -211,7 +213,7 @@ TEST_F(RPNConverterTest, UnaryOperator)
     
     for (std::size_t i{}; i < std::size(expected_rpn); ++i)
     {
-        UT_CC_DEFAULT_LOGGER_INFO("rpn: {}", expected_rpn[i].first.toStdString());
+        UT_CC_DEFAULT_LOGGER_INFO("rpn: {}", expected_rpn[i].mLexeme.toStdString());
         ASSERT_EQ(expected_rpn[i], rpn_tokens[i]);
     }
     
@@ -242,7 +244,7 @@ TEST_F(RPNConverterTest, ExponentOperatorPriority)
     
     for (std::size_t i{}; i < std::size(expected_rpn); ++i)
     {
-        UT_CC_DEFAULT_LOGGER_INFO("rpn: {}", expected_rpn[i].first.toStdString());
+        UT_CC_DEFAULT_LOGGER_INFO("rpn: {}", expected_rpn[i].mLexeme.toStdString());
         ASSERT_EQ(expected_rpn[i], rpn_tokens[i]);
     }
     
@@ -295,3 +297,147 @@ TEST_F(RPNConverterTest, UnbalancedLeftParenthesis)
     ASSERT_FALSE(mRPNConverter.GetErrorMessage().isEmpty());
     ASSERT_TRUE(mRPNConverter.HasError());
 }
+
+TEST_F(RPNConverterTest, FunctionCalls)
+{
+    std::array<Tokenizer::TokenPair, 9> expected_rpn
+    {
+        Tokenizer::TokenPair{ QStringLiteral("1"), Tokenizer::Token::Integer },
+        Tokenizer::TokenPair{ QStringLiteral("2"), Tokenizer::Token::Integer },
+        Tokenizer::TokenPair{ QStringLiteral("3"), Tokenizer::Token::Integer },
+        Tokenizer::TokenPair{ QStringLiteral("4"), Tokenizer::Token::Integer },
+        Tokenizer::TokenPair{ QStringLiteral("*"), Tokenizer::Token::Operator },
+        Tokenizer::TokenPair{ QStringLiteral("-"), Tokenizer::Token::UnaryOperator },
+        Tokenizer::TokenPair{ QStringLiteral("max"), Tokenizer::Token::Function },
+        Tokenizer::TokenPair{ QStringLiteral("+"), Tokenizer::Token::Operator },
+        Tokenizer::TokenPair{ QStringLiteral("sqrt"), Tokenizer::Token::Function },
+    };
+
+    // The unary minus before a call is emitted right before the function, so it negates the result.
+    mTokenizer.Init(QStringLiteral("sqrt(1+(-max(2,3*4)))"));
+    mTokenizer.Run();
+
+    const auto rpn_tokens{ mRPNConverter.Convert(mTokenizer.GetTokens()) };
+
+    ASSERT_FALSE(mRPNConverter.HasError());
+    ASSERT_EQ(std::size(expected_rpn), std::size(rpn_tokens));
+
+    for (std::size_t i{}; i < std::size(rpn_tokens); ++i)
+    {
+        ASSERT_EQ(rpn_tokens[i], expected_rpn[i]);
+    }
+}
+
+TEST_F(RPNConverterTest, FunctionCallErrors)
+{
+    const std::array<QString, 4> invalid_expressions
+    {
+        QStringLiteral("sin(1,2)"),
+        QStringLiteral("max(1)"),
+        QStringLiteral("foo(1)"),
+        QStringLiteral("(1,2)"),
+    };
+
+    for (const auto& expression : invalid_expressions)
+    {
+        mTokenizer.Init(expression);
+        mTokenizer.Run();
+        ASSERT_FALSE(mTokenizer.HasError());
+
+        std::ignore = mRPNConverter.Convert(mTokenizer.GetTokens());
+        ASSERT_TRUE(mRPNConverter.HasError()) << expression.toStdString();
+    }
+}
+
+TEST_F(RPNConverterTest, ReassociateChains)
+{
+    auto Reassociate = [this](const QString& expression, RPNReassociator::Shape shape)
+    {
+        mTokenizer.Init(expression);
+        mTokenizer.Run();
+
+        QString lexemes{};
+        for (const auto& token_pair : RPNReassociator::Reassociate(mRPNConverter.Convert(mTokenizer.GetTokens()), shape))
+        {
+            if (!lexemes.isEmpty())
+            {
+                lexemes += QChar{ u' ' };
+            }
+
+            lexemes += token_pair.mLexeme;
+        }
+
+        return lexemes;
+    };
+
+    using Shape = RPNReassociator::Shape;
+
+    // The level by level tree: an odd operand joins one level later.
+    ASSERT_EQ(Reassociate(QStringLiteral("1+2+3+4"), Shape::Balanced), QStringLiteral("1 2 + 3 4 + +"));
+    ASSERT_EQ(Reassociate(QStringLiteral("1+2+3+4+5"), Shape::Balanced), QStringLiteral("1 2 + 3 4 + + 5 +"));
+    ASSERT_EQ(Reassociate(QStringLiteral("1+(2+(3+4))"), Shape::Balanced), QStringLiteral("1 2 + 3 4 + +"));
+    ASSERT_EQ(Reassociate(QStringLiteral("1+2+3+4"), Shape::Flat), QStringLiteral("1 2 3 4 + + +"));
+
+    // Other operators end a chain, the chains inside them are regrouped on their own.
+    ASSERT_EQ(Reassociate(QStringLiteral("1*2*3-4-5"), Shape::Balanced), QStringLiteral("1 2 * 3 * 4 - 5 -"));
+    ASSERT_EQ(Reassociate(QStringLiteral("1+2*3*4*5+6"), Shape::Balanced), QStringLiteral("1 2 3 * 4 5 * * + 6 +"));
+    ASSERT_EQ(Reassociate(QStringLiteral("max(1+2+3,4)^2"), Shape::Flat), QStringLiteral("1 2 3 + + 4 max 2 ^"));
+
+    // A unary minus stays in front of its operand or its call.
+    ASSERT_EQ(Reassociate(QStringLiteral("2+(-3)+(-sin(1))+x"), Shape::Balanced), QStringLiteral("2 - 3 + 1 - sin x + +"));
+}
+
+TEST_F(RPNConverterTest, ReassociateMalformedRPN)
+{
+    using Token = Tokenizer::Token;
+    using Tokens = std::vector<Tokenizer::TokenPair>;
+
+    const std::array<Tokens, 6> kExpressions
+    {
+        Tokens{ { QStringLiteral("+"), Token::Operator } },
+        Tokens{ { QStringLiteral("1"), Token::Integer }, { QStringLiteral("*"), Token::Operator } },
+        Tokens{ { QStringLiteral("1"), Token::Integer }, { QStringLiteral("max"), Token::Function } },
+        Tokens{ { QStringLiteral("1"), Token::Integer }, { QStringLiteral("nope"), Token::Function } },
+        Tokens{ { QStringLiteral("1"), Token::Integer }, { QStringLiteral("2"), Token::Integer } },
+        Tokens{ { QStringLiteral("1"), Token::Integer }, { QStringLiteral("-"), Token::UnaryOperator } },
+    };
+
+    // Given back unchanged, to be reported by whoever validates it.
+    for (const auto shape : { RPNReassociator::Shape::Balanced, RPNReassociator::Shape::Flat })
+    {
+        for (const auto& expression : kExpressions)
+        {
+            ASSERT_EQ(RPNReassociator::Reassociate(expression, shape), expression);
+        }
+    }
+}
+
+TEST_F(RPNConverterTest, RewindTakesBackConvertedParts)
+{
+    mTokenizer.Init(QStringLiteral("2*(-max(1,3))-4"));
+    mTokenizer.Run();
+
+    const auto& tokens{ mTokenizer.GetTokens() };
+    const auto expected{ mRPNConverter.Convert(tokens) };
+
+    // One token per part, each one converted, taken back and converted again.
+    mRPNConverter.SetUndoLogging(true);
+    mRPNConverter.BeginParts();
+
+    std::vector<Tokenizer::TokenPair> output{};
+    for (std::size_t i{}; i < std::size(tokens); ++i)
+    {
+        const auto checkpoint{ mRPNConverter.GetCheckpoint() };
+        const auto output_size{ std::size(output) };
+
+        ASSERT_TRUE(mRPNConverter.ConvertPart(std::span{ tokens }.subspan(i), output));
+
+        mRPNConverter.Rewind(checkpoint);
+        output.erase(std::begin(output) + static_cast<std::ptrdiff_t>(output_size), std::end(output));
+
+        ASSERT_TRUE(mRPNConverter.ConvertPart(std::span{ tokens }.subspan(i, 1), output));
+    }
+
+    ASSERT_TRUE(mRPNConverter.FinishParts(output));
+    ASSERT_EQ(output, expected);
+}
\ No newline at end of file
@@ -0,0 +1,152 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <rpn-compiler.hpp>
+#include <rpn-gradient.hpp>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+class RPNGradientTest : public ::testing::Test
+{
+protected:
+    // Central differences of RPNProgram::Evaluate against every variable.
+    static std::vector<double> FiniteDifferences(const RPNProgram& program, std::vector<double> bindings)
+    {
+        std::vector<double> gradient(std::size(bindings));
+
+        for (std::size_t slot{}; slot < std::size(bindings); ++slot)
+        {
+            const auto value{ bindings[slot] };
+            const auto step{ 1e-6 * std::max(1.0, std::fabs(value)) };
+
+            bindings[slot] = value + step;
+            const auto forward{ program.Evaluate(bindings) };
+
+            bindings[slot] = value - step;
+            const auto backward{ program.Evaluate(bindings) };
+
+            bindings[slot] = value;
+            gradient[slot] = (forward - backward) / (2.0 * step);
+        }
+
+        return gradient;
+    }
+
+protected:
+    RPNCompiler mRPNCompiler;
+    RPNGradient mRPNGradient;
+};
+
+TEST_F(RPNGradientTest, Operators)
+{
+    std::array<double, 2> gradient{};
+
+    const auto quotient{ mRPNCompiler.Compile(QStringLiteral("x*y+x/y")) };
+    ASSERT_DOUBLE_EQ(mRPNGradient.Evaluate(quotient, std::array{ 3.0, 2.0 }, gradient), 7.5);
+    ASSERT_DOUBLE_EQ(gradient[0], 2.0 + 1.0 / 2.0);
+    ASSERT_DOUBLE_EQ(gradient[1], 3.0 - 3.0 / 4.0);
+
+    const auto power{ mRPNCompiler.Compile(QStringLiteral("x^y")) };
+    ASSERT_DOUBLE_EQ(mRPNGradient.Evaluate(power, std::array{ 2.0, 3.0 }, gradient), 8.0);
+    ASSERT_DOUBLE_EQ(gradient[0], 12.0);
+    ASSERT_DOUBLE_EQ(gradient[1], 8.0 * std::log(2.0));
+
+    const auto negated{ mRPNCompiler.Compile(QStringLiteral("(-x)-y*(-y)")) };
+    ASSERT_DOUBLE_EQ(mRPNGradient.Evaluate(negated, std::array{ 5.0, 4.0 }, gradient), 11.0);
+    ASSERT_DOUBLE_EQ(gradient[0], -1.0);
+    ASSERT_DOUBLE_EQ(gradient[1], 8.0);
+
+    // x^0 is constant in x, also at x = 0.
+    const auto zero_exponent{ mRPNCompiler.Compile(QStringLiteral("x^0+y")) };
+    ASSERT_DOUBLE_EQ(mRPNGradient.Evaluate(zero_exponent, std::array{ 0.0, 1.0 }, gradient), 2.0);
+    ASSERT_DOUBLE_EQ(gradient[0], 0.0);
+    ASSERT_DOUBLE_EQ(gradient[1], 1.0);
+
+    // Values computed from constants only have no derivative.
+    std::array<double, 0> no_gradient{};
+    ASSERT_DOUBLE_EQ(mRPNGradient.Evaluate(mRPNCompiler.Compile(QStringLiteral("2^10-24")), {}, no_gradient), 1000.0);
+
+    ASSERT_TRUE(std::isnan(mRPNGradient.Evaluate(quotient, std::array{ 1.0 }, gradient)));
+    ASSERT_TRUE(std::isnan(gradient[0]));
+}
+
+TEST_F(RPNGradientTest, MatchesFiniteDifferences)
+{
+    const std::array expressions
+    {
+        QStringLiteral("3*x^2*y-x/(y+z)+z^3"),
+        QStringLiteral("x*y*z*x+0.5+y+x*x+2"),
+        QStringLiteral("sin(x)*cos(y)+exp(z/4)-log(x+y)"),
+        QStringLiteral("sqrt(x*x+y*y)+max(x,z)-min(y,2)"),
+        QStringLiteral("(x+y)^(z/2)-(-x)^3+(-y)^(-2)"),
+        QStringLiteral("x*y*z*1.5*x*2*z*y"),
+    };
+
+    const std::array<std::array<double, 3>, 3> points
+    {{
+        { 1.5, 0.75, 2.0 },
+        { 0.3, 2.5, 1.25 },
+        { 2.0, 1.0, -0.5 },
+    }};
+
+    for (const bool is_reassociating : { false, true })
+    {
+        mRPNCompiler.SetReassociation(is_reassociating);
+
+        for (const auto& expression : expressions)
+        {
+            const auto program{ mRPNCompiler.Compile(expression) };
+            ASSERT_FALSE(mRPNCompiler.HasError());
+
+            for (const auto& point : points)
+            {
+                const std::vector<double> bindings(std::begin(point), std::begin(point) + std::ssize(program.GetVariables()));
+                const auto expected{ FiniteDifferences(program, bindings) };
+
+                std::vector<double> gradient(std::size(bindings));
+                ASSERT_EQ(mRPNGradient.Evaluate(program, bindings, gradient), program.Evaluate(bindings)) << expression.toStdString();
+
+                for (std::size_t slot{}; slot < std::size(gradient); ++slot)
+                {
+                    ASSERT_NEAR(gradient[slot], expected[slot], 1e-6 * std::max(1.0, std::fabs(expected[slot]))) << expression.toStdString() << " slot " << slot;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(RPNGradientTest, ContractedPolynomials)
+{
+    mRPNCompiler.SetContraction(true);
+
+    const auto program{ mRPNCompiler.Compile(QStringLiteral("3*x^3+2*x^2+5*x+1+y*x^2")) };
+    ASSERT_FALSE(mRPNCompiler.HasError());
+
+    std::array<double, 2> gradient{};
+    ASSERT_DOUBLE_EQ(mRPNGradient.Evaluate(program, std::array{ 1.5, 2.0 }, gradient), 10.125 + 4.5 + 7.5 + 1.0 + 4.5);
+    ASSERT_DOUBLE_EQ(gradient[0], 9.0 * 2.25 + 4.0 * 1.5 + 5.0 + 2.0 * 2.0 * 1.5);
+    ASSERT_DOUBLE_EQ(gradient[1], 2.25);
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <tokenizer.hpp>
+#include <rpn-converter.hpp>
+#include <rpn-integer-evaluator.hpp>
+
+#include <limits>
+
+class RPNIntegerEvaluatorTest : public ::testing::Test
+{
+protected:
+    using Outcome = RPNIntegerEvaluator::Outcome;
+
+    [[nodiscard]] RPNIntegerEvaluator::Result Evaluate(const QString& expression)
+    {
+        mTokenizer.Init(expression);
+        mTokenizer.Run();
+
+        const auto rpn_expression{ mRPNConverter.Convert(mTokenizer.GetTokens()) };
+        return RPNIntegerEvaluator::Evaluate(rpn_expression);
+    }
+
+    [[nodiscard]] std::int64_t EvaluateExact(const QString& expression)
+    {
+        const auto [outcome, value]{ Evaluate(expression) };
+
+        EXPECT_EQ(outcome, Outcome::Exact) << expression.toStdString();
+        return value;
+    }
+
+protected:
+    Tokenizer mTokenizer;
+    RPNConverter mRPNConverter;
+};
+
+TEST_F(RPNIntegerEvaluatorTest, ExactArithmetic)
+{
+    ASSERT_EQ(EvaluateExact(QStringLiteral("3+4*2")), 11);
+    ASSERT_EQ(EvaluateExact(QStringLiteral("(-7)*(3-5)")), 14);
+    ASSERT_EQ(EvaluateExact(QStringLiteral("10-(-4)")), 14);
+
+    // Beyond 2^53, where the double evaluation already rounds.
+    ASSERT_EQ(EvaluateExact(QStringLiteral("9007199254740993*1")), 9'007'199'254'740'993);
+    ASSERT_EQ(EvaluateExact(QStringLiteral("123456789*987654321+1")), 121'932'631'112'635'270);
+    ASSERT_EQ(EvaluateExact(QStringLiteral("9223372036854775807-1")), std::numeric_limits<std::int64_t>::max() - 1);
+}
+
+TEST_F(RPNIntegerEvaluatorTest, DivisionSemantics)
+{
+    ASSERT_EQ(EvaluateExact(QStringLiteral("100/(-4)")), -25);
+    ASSERT_EQ(EvaluateExact(QStringLiteral("(-9)/3")), -3);
+    ASSERT_EQ(EvaluateExact(QStringLiteral("0/5")), 0);
+
+    // A remainder or a zero divisor leaves the integers, the quotient is never truncated.
+    ASSERT_EQ(Evaluate(QStringLiteral("7/2")).mOutcome, Outcome::Inexact);
+    ASSERT_EQ(Evaluate(QStringLiteral("(-7)/2")).mOutcome, Outcome::Inexact);
+    ASSERT_EQ(Evaluate(QStringLiteral("1/0")).mOutcome, Outcome::Inexact);
+    ASSERT_EQ(Evaluate(QStringLiteral("0/0")).mOutcome, Outcome::Inexact);
+}
+
+TEST_F(RPNIntegerEvaluatorTest, PowerSemantics)
+{
+    ASSERT_EQ(EvaluateExact(QStringLiteral("2^10")), 1'024);
+    ASSERT_EQ(EvaluateExact(QStringLiteral("2^62")), std::int64_t{ 1 } << 62);
+    ASSERT_EQ(EvaluateExact(QStringLiteral("(-3)^3")), -27);
+    ASSERT_EQ(EvaluateExact(QStringLiteral("(2^3)^2")), 64);
+    ASSERT_EQ(EvaluateExact(QStringLiteral("0^0")), 1);
+    ASSERT_EQ(EvaluateExact(QStringLiteral("1^(-5)")), 1);
+    ASSERT_EQ(EvaluateExact(QStringLiteral("(-1)^(-3)")), -1);
+
+    ASSERT_EQ(Evaluate(QStringLiteral("2^(-1)")).mOutcome, Outcome::Inexact);
+    ASSERT_EQ(Evaluate(QStringLiteral("0^(-1)")).mOutcome, Outcome::Inexact);
+    ASSERT_EQ(Evaluate(QStringLiteral("2^63")).mOutcome, Outcome::Overflow);
+}
+
+TEST_F(RPNIntegerEvaluatorTest, Overflow)
+{
+    ASSERT_EQ(Evaluate(QStringLiteral("9223372036854775807+1")).mOutcome, Outcome::Overflow);
+    ASSERT_EQ(Evaluate(QStringLiteral("(-9223372036854775807)-2")).mOutcome, Outcome::Overflow);
+    ASSERT_EQ(Evaluate(QStringLiteral("4294967296*4294967296")).mOutcome, Outcome::Overflow);
+    ASSERT_EQ(Evaluate(QStringLiteral("99999999999999999999+1")).mOutcome, Outcome::Overflow);
+    ASSERT_EQ(Evaluate(QStringLiteral("((-9223372036854775807)-1)/(-1)")).mOutcome, Outcome::Overflow);
+
+    // Literals of 2^63 and beyond overflow without ever converting the token value.
+    ASSERT_EQ(Evaluate(QStringLiteral("9223372036854775808")).mOutcome, Outcome::Overflow);
+    ASSERT_EQ(Evaluate(QStringLiteral("1000000000000000000000000000000*0")).mOutcome, Outcome::Overflow);
+    ASSERT_EQ(Evaluate(QStringLiteral("9007199254740993")).mValue, 9007199254740993);
+}
+
+TEST_F(RPNIntegerEvaluatorTest, NotInteger)
+{
+    // Detected before evaluation, so an earlier overflow does not hide the floating point literal.
+    ASSERT_EQ(Evaluate(QStringLiteral("2^100+0.5")).mOutcome, Outcome::NotInteger);
+    ASSERT_EQ(Evaluate(QStringLiteral("1.0+2")).mOutcome, Outcome::NotInteger);
+    ASSERT_EQ(Evaluate(QStringLiteral("x+2")).mOutcome, Outcome::NotInteger);
+    ASSERT_EQ(Evaluate(QStringLiteral("max(1,2)")).mOutcome, Outcome::NotInteger);
+}
\ No newline at end of file
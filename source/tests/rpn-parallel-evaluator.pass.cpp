@@ -0,0 +1,127 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <tokenizer.hpp>
+#include <rpn-converter.hpp>
+#include <rpn-evaluator.hpp>
+#include <rpn-parallel-evaluator.hpp>
+
+#include <array>
+#include <cmath>
+
+class RPNParallelEvaluatorTest : public ::testing::Test
+{
+protected:
+    [[nodiscard]] std::vector<Tokenizer::TokenPair> ToRPN(const QString& expression)
+    {
+        mTokenizer.Init(expression);
+        mTokenizer.Run();
+
+        return mRPNConverter.Convert(mTokenizer.GetTokens());
+    }
+
+    // Balanced tree over 2^levels leaves, with calls of one and two large arguments, negated calls and negative literals.
+    static QString MakeWideExpression(int levels, int& next_leaf)
+    {
+        if (levels == 0)
+        {
+            const auto leaf{ QString::number(next_leaf % 7 + 1) };
+
+            switch (next_leaf++ % 4)
+            {
+            case 0:
+                return leaf;
+            case 1:
+                return QStringLiteral("(-") + leaf + QStringLiteral(".5)");
+            case 2:
+                return QStringLiteral("(-sin(") + leaf + QStringLiteral("))");
+            default:
+                return QStringLiteral("max(") + leaf + QStringLiteral(",2)");
+            }
+        }
+
+        const auto left{ MakeWideExpression(levels - 1, next_leaf) };
+        const auto right{ MakeWideExpression(levels - 1, next_leaf) };
+
+        switch (levels % 3)
+        {
+        case 0:
+            return QStringLiteral("max(") + left + QStringLiteral(",") + right + QStringLiteral(")");
+        case 1:
+            return QStringLiteral("(") + left + QStringLiteral("+") + right + QStringLiteral(")");
+        default:
+            return QStringLiteral("(-sin(") + left + QStringLiteral("-") + right + QStringLiteral("))");
+        }
+    }
+
+protected:
+    Tokenizer mTokenizer;
+    RPNConverter mRPNConverter;
+};
+
+TEST_F(RPNParallelEvaluatorTest, WideTreeMatchesRPNEvaluator)
+{
+    int next_leaf{};
+    const auto rpn_expression{ ToRPN(MakeWideExpression(8, next_leaf)) };
+    const auto expected{ RPNEvaluator::Evaluate(rpn_expression) };
+
+    // Grain sizes from one task per leaf to a single sequential evaluation.
+    const std::array<std::size_t, 4> grain_sizes{ 1, 4, 100, RPNParallelEvaluator::kDefaultGrainSize };
+
+    for (const auto grain_size : grain_sizes)
+    {
+        RPNParallelEvaluator evaluator{ 4, grain_size };
+
+        ASSERT_EQ(evaluator.Evaluate(rpn_expression), expected) << "grain size " << grain_size;
+        ASSERT_EQ(evaluator.Evaluate(rpn_expression), expected) << "grain size " << grain_size;
+    }
+}
+
+TEST_F(RPNParallelEvaluatorTest, DeepChainMatchesRPNEvaluator)
+{
+    // The left spine of a long chain is one large child after another, down to the first literal. 
+    // Written straight to RPN, the chain is too long for the recursion of the tokenizer coroutines.
+    std::vector<Tokenizer::TokenPair> rpn_expression{};
+    rpn_expression.emplace_back(QStringLiteral("1"), Tokenizer::Token::Integer);
+
+    for (int i{ 2 }; i <= 50'000; ++i)
+    {
+        rpn_expression.emplace_back(QString::number(i % 10) + QStringLiteral(".25"), Tokenizer::Token::FloatingPoint);
+        rpn_expression.emplace_back(i % 3 == 0 ? QStringLiteral("-") : QStringLiteral("+"), Tokenizer::Token::Operator);
+    }
+
+    RPNParallelEvaluator evaluator{ 4, 8 };
+    ASSERT_EQ(evaluator.Evaluate(rpn_expression), RPNEvaluator::Evaluate(rpn_expression));
+
+    ASSERT_EQ(evaluator.Evaluate(ToRPN(QStringLiteral("(-2)*3"))), -6.0);
+    ASSERT_EQ(evaluator.Evaluate(ToRPN(QStringLiteral("7"))), 7.0);
+}
+
+TEST_F(RPNParallelEvaluatorTest, EmptyExpressionIsNaN)
+{
+    RPNParallelEvaluator evaluator{ 4, 1 };
+
+    ASSERT_TRUE(std::isnan(evaluator.Evaluate({})));
+    ASSERT_EQ(evaluator.Evaluate(ToRPN(QStringLiteral("2+3"))), 5.0);
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <rpn-compiler.hpp>
+#include <rpn-program-cache.hpp>
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+class RPNProgramCacheTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        mPath = (std::filesystem::temp_directory_path() / "rpn-program-cache-test.bin").string();
+        std::filesystem::remove(mPath);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(mPath);
+    }
+
+    // Flips one byte of the file, at offset from the end.
+    void Corrupt(std::size_t offset_from_end) const
+    {
+        std::fstream file{ mPath, std::ios::binary | std::ios::in | std::ios::out };
+        file.seekg(-static_cast<std::streamoff>(offset_from_end), std::ios::end);
+
+        const auto position{ file.tellg() };
+        const auto byte{ static_cast<char>(file.get() ^ 0x5A) };
+
+        file.seekp(position);
+        file.put(byte);
+    }
+
+protected:
+    std::string mPath;
+    RPNCompiler mRPNCompiler;
+};
+
+TEST_F(RPNProgramCacheTest, SurvivesReopening)
+{
+    const std::array expressions
+    {
+        QStringLiteral("principal*(1+rate/12)^months-payment*months"),
+        QStringLiteral("3+4*2/(1-5)^2^3"),
+        QStringLiteral("x^3*0.25-x^2*1.5+max(x,y)"),
+        QStringLiteral("sin(a)*cos(b)-a*b*a*b"),
+    };
+
+    {
+        RPNProgramCache cache{};
+        ASSERT_FALSE(cache.Open(mPath));
+
+        for (const auto& expression : expressions)
+        {
+            cache.Add(expression, mRPNCompiler.Compile(expression));
+        }
+
+        // Already there, ignored.
+        cache.Add(expressions[0], mRPNCompiler.Compile(expressions[0]));
+        ASSERT_EQ(cache.GetSize(), std::size(expressions));
+
+        ASSERT_TRUE(cache.Find(expressions[1]).has_value());
+        ASSERT_TRUE(cache.Save(mPath)) << cache.GetErrorMessage().toStdString();
+    }
+
+    RPNProgramCache cache{};
+    ASSERT_TRUE(cache.Open(mPath)) << cache.GetErrorMessage().toStdString();
+    ASSERT_EQ(cache.GetSize(), std::size(expressions));
+    ASSERT_FALSE(cache.Find(QStringLiteral("1+1")).has_value());
+
+    const std::array bindings{ 1000.0, 0.05, 36.0, 25.0 };
+
+    for (const auto& expression : expressions)
+    {
+        const auto program{ mRPNCompiler.Compile(expression) };
+        const auto cached{ cache.Find(expression) };
+
+        ASSERT_TRUE(cached.has_value());
+        ASSERT_EQ(cached->GetVariableCount(), std::size(program.GetVariables()));
+
+        for (std::size_t slot{}; slot < std::size(program.GetVariables()); ++slot)
+        {
+            ASSERT_EQ(cached->GetVariable(slot).toString(), program.GetVariables()[slot]);
+            ASSERT_EQ(cached->GetSlot(program.GetVariables()[slot]), slot);
+        }
+
+        ASSERT_EQ(cached->Evaluate(bindings), program.Evaluate(bindings)) << expression.toStdString();
+    }
+
+    // Saving over the open file keeps the mapped programs and adds the new one.
+    const auto added{ QStringLiteral("x*y-1") };
+    cache.Add(added, mRPNCompiler.Compile(added));
+    ASSERT_TRUE(cache.Save(mPath));
+
+    RPNProgramCache reopened{};
+    ASSERT_TRUE(reopened.Open(mPath));
+    ASSERT_EQ(reopened.GetSize(), std::size(expressions) + 1);
+    ASSERT_EQ(reopened.Find(added)->Evaluate(std::array{ 3.0, 5.0 }), 14.0);
+    ASSERT_EQ(reopened.Find(expressions[1])->Evaluate({}), mRPNCompiler.Compile(expressions[1]).Evaluate({}));
+}
+
+TEST_F(RPNProgramCacheTest, RejectsDamagedFiles)
+{
+    {
+        RPNProgramCache cache{};
+        cache.Add(QStringLiteral("1+2*x"), mRPNCompiler.Compile(QStringLiteral("1+2*x")));
+        ASSERT_TRUE(cache.Save(mPath));
+    }
+
+    Corrupt(3);
+
+    RPNProgramCache cache{};
+    ASSERT_FALSE(cache.Open(mPath));
+    ASSERT_TRUE(cache.HasError());
+    ASSERT_EQ(cache.GetSize(), 0);
+
+    // Truncated.
+    std::filesystem::resize_file(mPath, 16);
+    ASSERT_FALSE(cache.Open(mPath));
+
+    {
+        std::ofstream file{ mPath, std::ios::binary | std::ios::trunc };
+        file << "not a program cache, just some text long enough for a header";
+    }
+
+    ASSERT_FALSE(cache.Open(mPath));
+    ASSERT_FALSE(cache.Find(QStringLiteral("1+2*x")).has_value());
+}
+TEST_F(RPNProgramCacheTest, VerifiesProgramsBeforeTrustingThem)
+{
+    using OpCode = RPNProgram::OpCode;
+
+    // Everything the compiler produces passes.
+    for (const bool is_contracting : { false, true })
+    {
+        mRPNCompiler.SetContraction(is_contracting);
+
+        for (const auto& expression : { QStringLiteral("1+(x+(x+(x+(x+x))))"), QStringLiteral("3*x^3+2*x^2+5*x+1"), QStringLiteral("max(sin(a),b)*2-(-c)^3") })
+        {
+            ASSERT_TRUE(RPNProgram::Verify(mRPNCompiler.Compile(expression).GetView())) << expression.toStdString();
+        }
+    }
+
+    const std::vector<double> constants{ 2.0, 1.0, 3.0, 4.0 };
+
+    auto Verify = [&constants](std::vector<RPNProgram::Instruction> instructions, std::size_t max_stack_depth = 2)
+    {
+        return RPNProgram::Verify({ instructions, constants, 1, max_stack_depth });
+    };
+
+    ASSERT_TRUE(Verify({ { OpCode::PushVariable, 0 }, { OpCode::PushConstant, 3 }, { OpCode::Add, 0 }, { OpCode::Return, 0 } }));
+    ASSERT_TRUE(Verify({ { OpCode::PushVariable, 0 }, { OpCode::Horner, 0 }, { OpCode::Return, 0 } }));
+
+    // Unknown opcode, operands out of range.
+    ASSERT_FALSE(Verify({ { OpCode::PushVariable, 0 }, { static_cast<OpCode>(200), 0 }, { OpCode::Return, 0 } }));
+    ASSERT_FALSE(Verify({ { OpCode::PushConstant, 4 }, { OpCode::Return, 0 } }));
+    ASSERT_FALSE(Verify({ { OpCode::PushVariable, 1 }, { OpCode::Return, 0 } }));
+    ASSERT_FALSE(Verify({ { OpCode::PushVariable, 0 }, { OpCode::Call, 99 }, { OpCode::Return, 0 } }));
+    ASSERT_FALSE(Verify({ { OpCode::PushVariable, 0 }, { OpCode::PowerInteger, 1000 }, { OpCode::Return, 0 } }));
+
+    // Horner with a degree beyond the constants, or not an integer.
+    ASSERT_FALSE(Verify({ { OpCode::PushVariable, 0 }, { OpCode::Horner, 2 }, { OpCode::Return, 0 } }));
+    ASSERT_FALSE(Verify({ { OpCode::PushVariable, 0 }, { OpCode::Horner, 1 }, { OpCode::Horner, 3 }, { OpCode::Return, 0 } }));
+
+    // Stack underflow, deeper than declared, a declared depth beyond the program, more than one value left.
+    ASSERT_FALSE(Verify({ { OpCode::PushVariable, 0 }, { OpCode::Add, 0 }, { OpCode::Return, 0 } }));
+    ASSERT_FALSE(Verify({ { OpCode::PushVariable, 0 }, { OpCode::PushVariable, 0 }, { OpCode::PushVariable, 0 }, { OpCode::MultiplyAdd, 0 }, { OpCode::Return, 0 } }));
+    ASSERT_FALSE(Verify({ { OpCode::PushVariable, 0 }, { OpCode::Return, 0 } }, 1'000'000'000));
+    ASSERT_FALSE(Verify({ { OpCode::PushVariable, 0 }, { OpCode::PushVariable, 0 }, { OpCode::Return, 0 } }));
+    ASSERT_FALSE(Verify({ { OpCode::PushVariable, 0 }, { OpCode::Sum, 0 }, { OpCode::Return, 0 } }));
+
+    // Return missing, or not last.
+    ASSERT_FALSE(Verify({ { OpCode::PushVariable, 0 } }));
+    ASSERT_FALSE(Verify({ { OpCode::PushVariable, 0 }, { OpCode::Return, 0 }, { OpCode::Negate, 0 } }));
+    ASSERT_FALSE(Verify({}));
+}
@@ -0,0 +1,78 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <spsc-queue.hpp>
+
+#include <thread>
+
+class SPSCQueueTest : public ::testing::Test
+{ };
+
+TEST_F(SPSCQueueTest, Capacity)
+{
+    Utils::SPSCQueue<int> queue{ 3 };
+    ASSERT_EQ(queue.GetCapacity(), 4);
+
+    for (int i{}; i < 4; ++i)
+    {
+        int value{ i };
+        ASSERT_TRUE(queue.TryPush(value));
+    }
+
+    int value{ 4 };
+    ASSERT_FALSE(queue.TryPush(value));
+    ASSERT_EQ(value, 4);
+
+    for (int i{}; i < 4; ++i)
+    {
+        ASSERT_TRUE(queue.TryPop(value));
+        ASSERT_EQ(value, i);
+    }
+
+    ASSERT_FALSE(queue.TryPop(value));
+}
+
+TEST_F(SPSCQueueTest, ValuesArriveInOrder)
+{
+    constexpr int kCount{ 100'000 };
+    Utils::SPSCQueue<int> queue{ 16 };
+
+    std::thread producer{ [&queue]
+    {
+        for (int i{}; i < kCount; ++i)
+        {
+            queue.Push(i);
+        }
+    } };
+
+    // Counted rather than asserted, the producer must be joined first.
+    int mismatches{};
+    for (int i{}; i < kCount; ++i)
+    {
+        mismatches += queue.Pop() != i;
+    }
+
+    producer.join();
+    ASSERT_EQ(mismatches, 0);
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <evaluation-pipeline.hpp>
+#include <streaming-pipeline.hpp>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+class StreamingPipelineTest : public ::testing::Test
+{
+protected:
+    static std::vector<QString> MakeExpressions(std::size_t count)
+    {
+        const std::array<QString, 8> templates
+        {
+            QStringLiteral("3+4*2/(1-5)^2^3"),
+            QStringLiteral("(-2.5)*(4-1)^2"),
+            QStringLiteral("1250*36-(480+125)*12"),
+            QStringLiteral("max(sqrt(16),2^3)-1/3"),
+            QStringLiteral("(1+2"),
+            QStringLiteral("2*+"),
+            QStringLiteral("100/(-4)"),
+            QStringLiteral("2*x"),
+        };
+
+        std::vector<QString> expressions{};
+        for (std::size_t i{}; i < count; ++i)
+        {
+            expressions.push_back(templates[i % std::size(templates)] + QStringLiteral("+") + QString::number(i));
+        }
+
+        return expressions;
+    }
+};
+
+TEST_F(StreamingPipelineTest, MatchesEvaluationPipeline)
+{
+    const auto expressions{ MakeExpressions(1000) };
+
+    EvaluationPipeline evaluation_pipeline{};
+    std::vector<double> expected(std::size(expressions));
+    std::size_t expected_failed{};
+
+    for (std::size_t i{}; i < std::size(expressions); ++i)
+    {
+        if (evaluation_pipeline.Run(expressions[i]))
+        {
+            expected[i] = evaluation_pipeline.GetResult();
+        }
+        else
+        {
+            ++expected_failed;
+        }
+    }
+
+    ASSERT_GT(expected_failed, 0);
+
+    for (const std::size_t batch_size : std::array<std::size_t, 4>{ 1, 3, 64, 5000 })
+    {
+        for (const std::size_t queue_capacity : std::array<std::size_t, 2>{ 1, 4 })
+        {
+            StreamingPipeline streaming_pipeline{ batch_size, queue_capacity };
+            std::vector<double> results(std::size(expressions));
+
+            // Twice, the second run reuses the batches of the first.
+            for (int run{}; run < 2; ++run)
+            {
+                ASSERT_EQ(streaming_pipeline.Run(expressions, results), expected_failed);
+
+                for (std::size_t i{}; i < std::size(expressions); ++i)
+                {
+                    if (std::isnan(results[i]))
+                    {
+                        ASSERT_FALSE(evaluation_pipeline.Run(expressions[i])) << expressions[i].toStdString();
+                    }
+                    else
+                    {
+                        ASSERT_EQ(results[i], expected[i]) << expressions[i].toStdString();
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(StreamingPipelineTest, EmptyStream)
+{
+    StreamingPipeline streaming_pipeline{};
+    ASSERT_EQ(streaming_pipeline.Run({}, {}), 0);
+
+    const auto expressions{ MakeExpressions(3) };
+    std::array<double, 2> results{};
+
+    ASSERT_EQ(streaming_pipeline.Run(expressions, results), std::size(results));
+    ASSERT_TRUE(std::isnan(results[0]));
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <task-scheduler.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+class TaskSchedulerTest : public ::testing::Test
+{
+protected:
+    // Fork-join sum over [begin, end), every level waits for the half it spawned.
+    std::uint64_t Sum(std::uint64_t begin, std::uint64_t end)
+    {
+        if (end - begin <= 64)
+        {
+            std::uint64_t sum{};
+            for (auto i{ begin }; i < end; ++i)
+            {
+                sum += i;
+            }
+
+            return sum;
+        }
+
+        const auto middle{ begin + (end - begin) / 2 };
+
+        std::uint64_t left{};
+        Utils::TaskScheduler::TaskGroup group{};
+
+        mTaskScheduler.Spawn(group, [this, &left, begin, middle]() { left = Sum(begin, middle); });
+        const auto right{ Sum(middle, end) };
+
+        mTaskScheduler.Wait(group);
+        return left + right;
+    }
+
+protected:
+    Utils::TaskScheduler mTaskScheduler{ 4 };
+};
+
+TEST_F(TaskSchedulerTest, NestedForkJoin)
+{
+    ASSERT_EQ(mTaskScheduler.GetThreadCount(), 4);
+    ASSERT_EQ(Sum(0, 100'000), std::uint64_t{ 100'000 } * 99'999 / 2);
+}
+
+TEST_F(TaskSchedulerTest, EveryTaskRunsOnce)
+{
+    std::vector<std::atomic<int>> runs(1000);
+    Utils::TaskScheduler::TaskGroup group{};
+
+    for (auto& run : runs)
+    {
+        mTaskScheduler.Spawn(group, [&run]() { run.fetch_add(1); });
+    }
+
+    mTaskScheduler.Wait(group);
+
+    for (const auto& run : runs)
+    {
+        ASSERT_EQ(run.load(), 1);
+    }
+
+    // Threads outside the scheduler spawn and wait concurrently through the shared queue.
+    std::atomic<std::uint64_t> total{};
+    std::vector<std::thread> threads{};
+
+    for (int t{}; t < 3; ++t)
+    {
+        threads.emplace_back([this, &total]() { total += Sum(0, 10'000); });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(total.load(), 3 * (std::uint64_t{ 10'000 } * 9'999 / 2));
+}
\ No newline at end of file
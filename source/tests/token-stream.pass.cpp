@@ -0,0 +1,163 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <tokenizer/tokenizer.hpp>
+#include <tokenizer/token-stream.hpp>
+#include <rpn-converter/rpn-converter.hpp>
+#include <rpn-evaluator/rpn-evaluator.hpp>
+
+class TokenStreamTest : public ::testing::Test
+{
+protected:
+    const std::vector<Tokenizer::TokenPair>& Tokenize(const QString& input)
+    {
+        mTokenizer.Init(input);
+        mTokenizer.Run();
+
+        return mTokenizer.GetTokens();
+    }
+
+    Tokenizer mTokenizer;
+    RPNConverter mRPNConverter;
+
+    TokenStream mInput;
+    TokenStream mOutput;
+    std::vector<Tokenizer::TokenPair> mRPN;
+};
+
+TEST_F(TokenStreamTest, EvaluatesLikeTokenPairs)
+{
+    const std::array kExpressions
+    {
+        QStringLiteral("5+4-3"), QStringLiteral("2^3^2"), QStringLiteral("(-2)^2"), QStringLiteral("(1+2)*(3-4)/5"),
+        QStringLiteral("(-2.5)*4+1"), QStringLiteral("sin(0.5)+cos(0.25)"), QStringLiteral("(-max(2,3))*min(4,-5)"),
+        QStringLiteral("2*(-sqrt(16))"), QStringLiteral("exp(log(3))-x"), QStringLiteral("max(1,max(2,max(3,4)))"),
+        QStringLiteral("4^(-3)"), QStringLiteral("1/0"),
+    };
+
+    for (const auto& expression : kExpressions)
+    {
+        const auto& tokens{ Tokenize(expression) };
+
+        ASSERT_TRUE(mRPNConverter.Convert(tokens, mRPN)) << expression.toStdString();
+        const auto expected{ RPNEvaluator::Evaluate(mRPN) };
+
+        ASSERT_TRUE(mInput.Assign(tokens));
+        ASSERT_TRUE(mRPNConverter.Convert(mInput, mOutput));
+        const auto actual{ RPNEvaluator::Evaluate(mOutput) };
+
+        ASSERT_EQ(mOutput.GetSize(), std::size(mRPN)) << expression.toStdString();
+        if (std::isnan(expected))
+        {
+            EXPECT_TRUE(std::isnan(actual)) << expression.toStdString();
+        }
+        else
+        {
+            EXPECT_EQ(actual, expected) << expression.toStdString();
+        }
+    }
+}
+
+TEST_F(TokenStreamTest, OffsetsPointIntoTheSource)
+{
+    using Kind = TokenStream::Kind;
+
+    const QString source{ QStringLiteral("rate*max(12.5,-x)") };
+    ASSERT_TRUE(mInput.Assign(Tokenize(source)));
+
+    constexpr std::array kKinds
+    {
+        Kind::Identifier, Kind::Multiply, Kind::Function, Kind::LeftParenthesis, Kind::Number,
+        Kind::Separator, Kind::Negate, Kind::Identifier, Kind::RightParenthesis,
+    };
+    constexpr std::array<std::uint32_t, 9> kOffsets{ 0, 4, 5, 8, 9, 13, 14, 15, 16 };
+
+    ASSERT_EQ(mInput.GetSize(), std::size(kKinds));
+    for (std::size_t i{}; i < std::size(kKinds); ++i)
+    {
+        EXPECT_EQ(mInput.GetKinds()[i], kKinds[i]) << i;
+        EXPECT_EQ(mInput.GetOffsets()[i], kOffsets[i]) << i;
+    }
+
+    EXPECT_EQ(mInput.GetValues()[4], 12.5);
+    EXPECT_EQ(mInput.GetValues()[2], static_cast<double>(MathFunctions::Id::Max));
+
+    ASSERT_EQ(std::size(mInput.GetNames()), 2);
+    EXPECT_EQ(mInput.GetNames()[static_cast<std::size_t>(mInput.GetValues()[7])], QStringLiteral("x"));
+
+    // The converted stream keeps the offsets and the names of the identifiers.
+    ASSERT_TRUE(mRPNConverter.Convert(mInput, mOutput));
+    ASSERT_EQ(mOutput.GetSize(), 6);
+    EXPECT_EQ(mOutput.GetOffsets()[0], 0);
+    EXPECT_EQ(mOutput.GetOffsets()[5], 4);
+    EXPECT_EQ(mOutput.GetNames()[static_cast<std::size_t>(mOutput.GetValues()[3])], QStringLiteral("x"));
+}
+
+TEST_F(TokenStreamTest, InternsNames)
+{
+    ASSERT_TRUE(mInput.Assign(Tokenize(QStringLiteral("x+x"))));
+
+    ASSERT_EQ(std::size(mInput.GetNames()), 1);
+    EXPECT_EQ(mInput.GetNames()[0], QStringLiteral("x"));
+    EXPECT_EQ(mInput.GetValues()[0], 0.0);
+    EXPECT_EQ(mInput.GetValues()[2], 0.0);
+
+    ASSERT_TRUE(mInput.Assign(Tokenize(QStringLiteral("y*x-y"))));
+
+    ASSERT_EQ(std::size(mInput.GetNames()), 2);
+    EXPECT_EQ(mInput.GetValues()[0], 0.0);
+    EXPECT_EQ(mInput.GetValues()[2], 1.0);
+    EXPECT_EQ(mInput.GetValues()[4], 0.0);
+}
+
+TEST_F(TokenStreamTest, ReportsTheSameErrors)
+{
+    const std::array kExpressions
+    {
+        QStringLiteral("max(1)"), QStringLiteral("sin(1,2)"), QStringLiteral("(1+2"),
+        QStringLiteral("1+2)"), QStringLiteral("1,2"), QStringLiteral("(1,2)"),
+    };
+
+    for (const auto& expression : kExpressions)
+    {
+        const auto& tokens{ Tokenize(expression) };
+
+        ASSERT_FALSE(mRPNConverter.Convert(tokens, mRPN)) << expression.toStdString();
+        const auto expected{ mRPNConverter.GetErrorMessage() };
+
+        ASSERT_TRUE(mInput.Assign(tokens));
+        ASSERT_FALSE(mRPNConverter.Convert(mInput, mOutput)) << expression.toStdString();
+
+        EXPECT_EQ(mRPNConverter.GetErrorMessage(), expected);
+        EXPECT_TRUE(mOutput.IsEmpty());
+    }
+
+    EXPECT_FALSE(mInput.Assign(Tokenize(QStringLiteral("foo(1)"))));
+    EXPECT_EQ(mInput.GetErrorMessage(), QStringLiteral("unknown function: foo"));
+    EXPECT_TRUE(mInput.IsEmpty());
+}
\ No newline at end of file
@@ -24,8 +24,11 @@
 
 #include <tokenizer.hpp>
 
+#include <algorithm>
 #include <array>
+#include <random>
 #include <string>
+#include <thread>
 
 using Tc = Utils::Logger::Tc;
 using Emp = Utils::Logger::Emp;
@@ -46,13 +49,14 @@ protected:
     case Tokenizer::Token::RightParenthesis: return "RightParenthesis";
     case Tokenizer::Token::UnaryOperator:    return "UnaryOperator";
     case Tokenizer::Token::Operator:         return "Operator";
+    case Tokenizer::Token::Identifier:       return "Identifier";
     default:                                 return "Unknown";
     }
 }
 
 [[maybe_unused]] static void PrintTokens(const std::vector<Tokenizer::TokenPair>& tokens)
 {
-    for (const auto& [lexeme, token] : tokens)
+    for (const auto& [lexeme, token, value] : tokens)
     {
         std::cout << lexeme.toStdString() << std::setw(10) << '[' << GetTokenStr(token) << ']' << '\n'; 
     }
@@ -75,11 +79,12 @@ TEST_F(TokenizerTest, TokenizeSimpleExpression)
 
     for (std::size_t i{}; i < std::size(expected_tokens); ++i)
     {
-        const auto& [token, lexeme]{ tokens[i] };
-        const auto& [expected_token, expected_lexeme]{ expected_tokens[i] };
+        const auto& [token, lexeme, value]{ tokens[i] };
+        const auto& [expected_token, expected_lexeme, expected_value]{ expected_tokens[i] };
         
         ASSERT_EQ(token, expected_token);
         ASSERT_EQ(lexeme, expected_lexeme);
+        ASSERT_EQ(value, expected_value);
     }
 
     ASSERT_FALSE(mTokenizer.HasError());
@@ -113,11 +118,12 @@ TEST_F(TokenizerTest, TokenizeComplexExpression)
 
     for (std::size_t i{}; i < std::size(expected_tokens); ++i)
     {
-        const auto& [token, lexeme]{ tokens[i] };
-        const auto& [expected_token, expected_lexeme]{ expected_tokens[i] };
+        const auto& [token, lexeme, value]{ tokens[i] };
+        const auto& [expected_token, expected_lexeme, expected_value]{ expected_tokens[i] };
         
         ASSERT_EQ(token, expected_token);
         ASSERT_EQ(lexeme, expected_lexeme);
+        ASSERT_EQ(value, expected_value);
     }
     
     ASSERT_FALSE(mTokenizer.HasError());
@@ -182,11 +188,12 @@ TEST_F(TokenizerTest, TokenizeNestedExpression)
 
     for (std::size_t i{}; i < std::size(expected_tokens); ++i)
     {
-        const auto& [token, lexeme]{ tokens[i] };
-        const auto& [expected_token, expected_lexeme]{ expected_tokens[i] };
+        const auto& [token, lexeme, value]{ tokens[i] };
+        const auto& [expected_token, expected_lexeme, expected_value]{ expected_tokens[i] };
 
         ASSERT_EQ(token, expected_token);
         ASSERT_EQ(lexeme, expected_lexeme);
+        ASSERT_EQ(value, expected_value);
     }
 
     ASSERT_FALSE(mTokenizer.HasError());
@@ -273,7 +280,7 @@ TEST_F(TokenizerTest, TokenizeExpressionWithInvalidFloat)
 
 TEST_F(TokenizerTest, TokenizeExpressionWithLetter)
 {
-    mTokenizer.Init("5+a");
+    mTokenizer.Init("5+2a");
     mTokenizer.Run();
 
     UT_CC_DEFAULT_LOGGER_COLOR_INFO(Tc::black,Tc::green, Emp::bold,
@@ -283,3 +290,246 @@ TEST_F(TokenizerTest, TokenizeExpressionWithLetter)
     ASSERT_TRUE(mTokenizer.HasError());
     ASSERT_FALSE(mTokenizer.GetErrorMessage().isEmpty());
 }
+
+
+TEST_F(TokenizerTest, TokenizeOnSeparateThreads)
+{
+    std::size_t first_count{};
+    std::size_t second_count{};
+
+    std::thread first_thread{ [&first_count]()
+    {
+        Tokenizer tokenizer{};
+        for (std::size_t i{}; i < 100; ++i)
+        {
+            tokenizer.Init(QStringLiteral("1+2*3"));
+            tokenizer.Run();
+        }
+
+        first_count = std::size(tokenizer.GetTokens());
+    } };
+
+    std::thread second_thread{ [&second_count]()
+    {
+        Tokenizer tokenizer{};
+        for (std::size_t i{}; i < 100; ++i)
+        {
+            tokenizer.Init(QStringLiteral("(-2.5)^2"));
+            tokenizer.Run();
+        }
+
+        second_count = std::size(tokenizer.GetTokens());
+    } };
+
+    first_thread.join();
+    second_thread.join();
+
+    ASSERT_EQ(first_count, 5);
+    ASSERT_EQ(second_count, 6);
+}
+
+TEST_F(TokenizerTest, IncrementalUpdateMatchesFullRun)
+{
+    mTokenizer.SetIncremental(true);
+    Tokenizer full_tokenizer{};
+
+    const std::array<QString, 6> inputs
+    {
+        QStringLiteral("12"),
+        QStringLiteral("123+4"),
+        QStringLiteral("123+4.5*(-6"),
+        QStringLiteral("123+4.5*(-6)"),
+        QStringLiteral("123+4"),
+        QStringLiteral("1"),
+    };
+
+    for (const auto& input : inputs)
+    {
+        mTokenizer.Update(input);
+
+        full_tokenizer.Init(input);
+        full_tokenizer.Run();
+
+        ASSERT_EQ(mTokenizer.HasError(), full_tokenizer.HasError());
+        ASSERT_EQ(mTokenizer.GetTokens(), full_tokenizer.GetTokens());
+    }
+
+    ASSERT_EQ(mTokenizer.GetFirstChangedToken(), 0);
+}
+
+TEST_F(TokenizerTest, IncrementalUpdateAfterError)
+{
+    mTokenizer.SetIncremental(true);
+
+    mTokenizer.Update(QStringLiteral("2+3$"));
+    ASSERT_TRUE(mTokenizer.HasError());
+
+    mTokenizer.Update(QStringLiteral("2+3*4"));
+    ASSERT_FALSE(mTokenizer.HasError());
+    ASSERT_EQ(std::size(mTokenizer.GetTokens()), 5);
+    ASSERT_EQ(mTokenizer.GetFirstChangedToken(), 2);
+}
+
+TEST_F(TokenizerTest, UpdateResumesAtTokenBoundaries)
+{
+    // Without incremental mode every update starts over.
+    mTokenizer.Update(QStringLiteral("12+345"));
+    mTokenizer.Update(QStringLiteral("12+3456"));
+    ASSERT_EQ(mTokenizer.GetFirstChangedToken(), 0);
+
+    mTokenizer.SetIncremental(true);
+    mTokenizer.Update(QStringLiteral("12+345"));
+
+    // The number being typed is tokenized again from its first digit.
+    mTokenizer.Update(QStringLiteral("12+3456"));
+    ASSERT_FALSE(mTokenizer.HasError());
+    ASSERT_EQ(mTokenizer.GetFirstChangedToken(), 2);
+    ASSERT_EQ(mTokenizer.GetTokens().back().mLexeme, QStringLiteral("3456"));
+
+    mTokenizer.Update(QStringLiteral("12+3456*(7)"));
+    ASSERT_EQ(mTokenizer.GetFirstChangedToken(), 2);
+
+    mTokenizer.Update(QStringLiteral("12+3456*(7)-8"));
+    ASSERT_FALSE(mTokenizer.HasError());
+    ASSERT_EQ(mTokenizer.GetFirstChangedToken(), 7);
+    ASSERT_EQ(std::size(mTokenizer.GetTokens()), 9);
+}
+
+TEST_F(TokenizerTest, ReusesLexemeStorage)
+{
+    // Storage of every lexeme while warming up, the tokens themselves are not kept.
+    std::vector<const QChar*> storage{};
+
+    for (int i{}; i < 2; ++i)
+    {
+        mTokenizer.Init(QStringLiteral("1234*5678"));
+        mTokenizer.Run();
+
+        for (const auto& token_pair : mTokenizer.GetTokens())
+        {
+            storage.push_back(token_pair.mLexeme.constData());
+        }
+    }
+
+    mTokenizer.Init(QStringLiteral("8765*4321"));
+    mTokenizer.Run();
+    ASSERT_FALSE(mTokenizer.HasError());
+
+    for (const auto& token_pair : mTokenizer.GetTokens())
+    {
+        ASSERT_NE(std::find(std::cbegin(storage), std::cend(storage), token_pair.mLexeme.constData()), std::cend(storage)) 
+            << token_pair.mLexeme.toStdString();
+    }
+}
+
+TEST_F(TokenizerTest, LiteralValuesMatchToDouble)
+{
+    const std::array<QString, 10> literals
+    {
+        QStringLiteral("0"),
+        QStringLiteral("0.1"),
+        QStringLiteral("9007199254740993"),
+        QStringLiteral("123456789012345678"),
+        QStringLiteral("0.000000000000000000001"),
+        QStringLiteral("1.7976931348623157"),
+        QStringLiteral("2.2250738585072014"),
+        QStringLiteral("98765432109876543210987654321.123456789"),
+        QStringLiteral("00000000000000000000000000000000000000000000000000000000000000000000001.5"),
+        QStringLiteral("4.9406564584124654"),
+    };
+
+    for (const auto& literal : literals)
+    {
+        ASSERT_EQ(Tokenizer::ParseNumber(literal), literal.toDouble());
+    }
+
+    // Digit-heavy literals of every length around the fast path limit.
+    std::mt19937_64 generator{ 2025 };
+    std::uniform_int_distribution<int> digit{ 0, 9 };
+
+    for (std::size_t length{ 1 }; length <= 40; ++length)
+    {
+        for (std::size_t attempt{}; attempt < 50; ++attempt)
+        {
+            QString literal{};
+            for (std::size_t i{}; i < length; ++i)
+            {
+                literal.push_back(QChar(static_cast<char16_t>(u'0' + digit(generator))));
+            }
+
+            if (length > 1 && attempt % 2 == 0)
+            {
+                literal = literal.left(attempt % length + 1) + QStringLiteral(".") + literal.mid(attempt % length + 1) + QStringLiteral("1");
+            }
+
+            mTokenizer.Init(literal);
+            mTokenizer.Run();
+
+            ASSERT_FALSE(mTokenizer.HasError());
+            ASSERT_EQ(mTokenizer.GetTokens().front().mValue, literal.toDouble());
+        }
+    }
+}
+
+TEST_F(TokenizerTest, TokenizeVariables)
+{
+    std::array<Tokenizer::TokenPair, 7> expected_tokens
+    {
+        Tokenizer::TokenPair{ QStringLiteral("("), Tokenizer::Token::LeftParenthesis },
+        Tokenizer::TokenPair{ QStringLiteral("-"), Tokenizer::Token::UnaryOperator },
+        Tokenizer::TokenPair{ QStringLiteral("x1"), Tokenizer::Token::Identifier },
+        Tokenizer::TokenPair{ QStringLiteral(")"), Tokenizer::Token::RightParenthesis },
+        Tokenizer::TokenPair{ QStringLiteral("*"), Tokenizer::Token::Operator },
+        Tokenizer::TokenPair{ QStringLiteral("total_rate"), Tokenizer::Token::Identifier },
+        Tokenizer::TokenPair{ QStringLiteral("+"), Tokenizer::Token::Operator },
+    };
+
+    mTokenizer.Init(QStringLiteral("(-x1)*total_rate+2"));
+    mTokenizer.Run();
+
+    const auto& tokens = mTokenizer.GetTokens();
+    ASSERT_FALSE(mTokenizer.HasError());
+    ASSERT_EQ(std::size(tokens), std::size(expected_tokens) + 1);
+
+    for (std::size_t i{}; i < std::size(expected_tokens); ++i)
+    {
+        ASSERT_EQ(tokens[i], expected_tokens[i]);
+    }
+}
+
+TEST_F(TokenizerTest, TokenizeFunctionCalls)
+{
+    std::array<Tokenizer::TokenPair, 10> expected_tokens
+    {
+        Tokenizer::TokenPair{ QStringLiteral("-"), Tokenizer::Token::UnaryOperator },
+        Tokenizer::TokenPair{ QStringLiteral("max"), Tokenizer::Token::Function },
+        Tokenizer::TokenPair{ QStringLiteral("("), Tokenizer::Token::LeftParenthesis },
+        Tokenizer::TokenPair{ QStringLiteral("2.5"), Tokenizer::Token::FloatingPoint },
+        Tokenizer::TokenPair{ QStringLiteral(","), Tokenizer::Token::Separator },
+        Tokenizer::TokenPair{ QStringLiteral("sin"), Tokenizer::Token::Function },
+        Tokenizer::TokenPair{ QStringLiteral("("), Tokenizer::Token::LeftParenthesis },
+        Tokenizer::TokenPair{ QStringLiteral("x"), Tokenizer::Token::Identifier },
+        Tokenizer::TokenPair{ QStringLiteral(")"), Tokenizer::Token::RightParenthesis },
+        Tokenizer::TokenPair{ QStringLiteral(")"), Tokenizer::Token::RightParenthesis },
+    };
+
+    mTokenizer.Init(QStringLiteral("(-max(2.5,sin(x)))"));
+    mTokenizer.Run();
+
+    const auto& tokens = mTokenizer.GetTokens();
+    ASSERT_FALSE(mTokenizer.HasError());
+    ASSERT_EQ(std::size(tokens), std::size(expected_tokens) + 2);
+
+    for (std::size_t i{}; i < std::size(expected_tokens); ++i)
+    {
+        ASSERT_EQ(tokens[i + 1], expected_tokens[i]);
+    }
+
+    mTokenizer.Init(QStringLiteral("max(1,)"));
+    mTokenizer.Run();
+    ASSERT_TRUE(mTokenizer.HasError());
+
+    mTokenizer.Init(QStringLiteral("sin(1),2"));
+    mTokenizer.Run();
+    ASSERT_FALSE(mTokenizer.HasError());
+}
\ No newline at end of file
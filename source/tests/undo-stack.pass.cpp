@@ -0,0 +1,86 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <undo-stack.hpp>
+
+#include <string>
+#include <vector>
+
+class UndoStackTest : public ::testing::Test
+{
+protected:
+    [[nodiscard]] static std::vector<std::string> ToVector(const Utils::UndoStack<std::string>& stack)
+    {
+        return { std::begin(stack), std::end(stack) };
+    }
+
+protected:
+    Utils::UndoStack<std::string> mStack;
+};
+
+TEST_F(UndoStackTest, RewindRestoresEveryCheckpoint)
+{
+    mStack.SetLogging(true);
+    mStack.push_back("a");
+    mStack.push_back("b");
+
+    const auto first{ mStack.GetChangeCount() };
+    const auto first_values{ ToVector(mStack) };
+
+    mStack.pop_back();
+    mStack.ReplaceBack("c");
+    mStack.push_back("d");
+
+    const auto second{ mStack.GetChangeCount() };
+    const auto second_values{ ToVector(mStack) };
+
+    mStack.resize(0);
+    mStack.push_back("e");
+    ASSERT_EQ(ToVector(mStack), std::vector<std::string>{ "e" });
+
+    mStack.Rewind(second);
+    ASSERT_EQ(ToVector(mStack), second_values);
+
+    mStack.Rewind(first);
+    ASSERT_EQ(ToVector(mStack), first_values);
+
+    mStack.Rewind(0);
+    ASSERT_TRUE(mStack.empty());
+}
+
+TEST_F(UndoStackTest, LogsNothingUnlessEnabled)
+{
+    mStack.push_back("a");
+    mStack.ReplaceBack("b");
+    mStack.pop_back();
+
+    ASSERT_EQ(mStack.GetChangeCount(), 0);
+    ASSERT_TRUE(mStack.empty());
+
+    mStack.SetLogging(true);
+    mStack.push_back("a");
+    mStack.clear();
+
+    ASSERT_EQ(mStack.GetChangeCount(), 0);
+}
\ No newline at end of file
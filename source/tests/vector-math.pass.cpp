@@ -0,0 +1,224 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <vector-math.hpp>
+
+class VectorMathTest : public ::testing::Test
+{
+protected:
+    // Error in units of the last place of the reference, which is computed in long double.
+    static double UlpError(double value, long double reference)
+    {
+        const auto rounded{ static_cast<double>(reference) };
+        if (std::isnan(value) || std::isinf(value) || rounded == 0.0)
+        {
+            return value == rounded || (std::isnan(value) && std::isnan(rounded)) ? 0.0 : std::numeric_limits<double>::infinity();
+        }
+
+        int exponent{};
+        std::frexp(rounded, &exponent);
+
+        const auto ulp{ std::ldexp(1.0, std::max(exponent - 53, -1074)) };
+        return static_cast<double>(std::fabs(static_cast<long double>(value) - reference) / ulp);
+    }
+
+    template <typename Scalar, typename Batch, typename Reference>
+    static void ExpectMaxError(double low, double high, Scalar scalar, Batch batch, Reference reference, double max_ulp)
+    {
+        std::mt19937_64 generator{ 42 };
+        std::uniform_real_distribution<double> distribution{ low, high };
+
+        // An odd size leaves a scalar tail after the vector loop.
+        std::vector<double> input(20'001);
+        std::vector<double> output(std::size(input));
+
+        for (auto& x : input) { x = distribution(generator); }
+        batch(input, output);
+
+        for (std::size_t i{}; i < std::size(input); ++i)
+        {
+            const auto expected{ reference(static_cast<long double>(input[i])) };
+
+            ASSERT_LE(UlpError(scalar(input[i]), expected), max_ulp) << "x = " << input[i];
+            ASSERT_LE(UlpError(output[i], expected), max_ulp) << "x = " << input[i];
+        }
+    }
+};
+
+TEST_F(VectorMathTest, ExpWithinOneUlp)
+{
+    const auto scalar{ [](double x) { return Utils::VectorMath::Exp(x); } };
+    const auto batch{ [](const auto& input, auto& output) { Utils::VectorMath::Exp(input, output); } };
+    const auto reference{ [](long double x) { return std::exp(x); } };
+
+    ExpectMaxError(-1.0, 1.0, scalar, batch, reference, 1.0);
+    ExpectMaxError(-708.0, 709.0, scalar, batch, reference, 1.0);
+}
+
+TEST_F(VectorMathTest, LogWithinOneUlp)
+{
+    const auto scalar{ [](double x) { return Utils::VectorMath::Log(x); } };
+    const auto batch{ [](const auto& input, auto& output) { Utils::VectorMath::Log(input, output); } };
+    const auto reference{ [](long double x) { return std::log(x); } };
+
+    ExpectMaxError(0.5, 2.0, scalar, batch, reference, 1.0);
+    ExpectMaxError(1e-300, 1e300, scalar, batch, reference, 1.0);
+}
+
+TEST_F(VectorMathTest, SinCosWithinOneUlp)
+{
+    const auto sin_scalar{ [](double x) { return Utils::VectorMath::Sin(x); } };
+    const auto sin_batch{ [](const auto& input, auto& output) { Utils::VectorMath::Sin(input, output); } };
+    const auto sin_reference{ [](long double x) { return std::sin(x); } };
+
+    const auto cos_scalar{ [](double x) { return Utils::VectorMath::Cos(x); } };
+    const auto cos_batch{ [](const auto& input, auto& output) { Utils::VectorMath::Cos(input, output); } };
+    const auto cos_reference{ [](long double x) { return std::cos(x); } };
+
+    ExpectMaxError(-10.0, 10.0, sin_scalar, sin_batch, sin_reference, 1.0);
+    ExpectMaxError(-524288.0, 524288.0, sin_scalar, sin_batch, sin_reference, 1.0);
+
+    ExpectMaxError(-10.0, 10.0, cos_scalar, cos_batch, cos_reference, 1.0);
+    ExpectMaxError(-524288.0, 524288.0, cos_scalar, cos_batch, cos_reference, 1.0);
+}
+
+TEST_F(VectorMathTest, SpecialValues)
+{
+    constexpr auto kInfinity{ std::numeric_limits<double>::infinity() };
+    constexpr auto kNaN{ std::numeric_limits<double>::quiet_NaN() };
+
+    ASSERT_EQ(Utils::VectorMath::Exp(0.0), 1.0);
+    ASSERT_EQ(Utils::VectorMath::Exp(710.0), kInfinity);
+    ASSERT_EQ(Utils::VectorMath::Exp(-kInfinity), 0.0);
+    ASSERT_EQ(Utils::VectorMath::Exp(-746.0), 0.0);
+    ASSERT_GT(Utils::VectorMath::Exp(-745.0), 0.0);
+
+    ASSERT_EQ(Utils::VectorMath::Log(1.0), 0.0);
+    ASSERT_EQ(Utils::VectorMath::Log(0.0), -kInfinity);
+    ASSERT_EQ(Utils::VectorMath::Log(kInfinity), kInfinity);
+    ASSERT_TRUE(std::isnan(Utils::VectorMath::Log(-1.0)));
+    ASSERT_NEAR(Utils::VectorMath::Log(5e-324), -744.44007192138126, 1e-12);
+
+    ASSERT_EQ(Utils::VectorMath::Sin(0.0), 0.0);
+    ASSERT_TRUE(std::signbit(Utils::VectorMath::Sin(-0.0)));
+    ASSERT_TRUE(std::isnan(Utils::VectorMath::Sin(kInfinity)));
+    ASSERT_EQ(Utils::VectorMath::Sin(1e300), std::sin(1e300));
+    ASSERT_EQ(Utils::VectorMath::Cos(0.0), 1.0);
+
+    ASSERT_TRUE(std::isnan(Utils::VectorMath::Exp(kNaN)));
+    ASSERT_TRUE(std::isnan(Utils::VectorMath::Log(kNaN)));
+    ASSERT_TRUE(std::isnan(Utils::VectorMath::Cos(kNaN)));
+
+    ASSERT_EQ(Utils::VectorMath::Min(kNaN, 2.0), 2.0);
+    ASSERT_EQ(Utils::VectorMath::Max(3.0, kNaN), 3.0);
+}
+
+TEST_F(VectorMathTest, BatchMatchesScalarInPlace)
+{
+    // Large arguments in the middle of a vector go to the C library lane by lane.
+    std::vector<double> values{ 0.5, 1e7, -3.0, 2.5, -1e9, 100.0, 0.25 };
+    std::vector<double> expected(std::size(values));
+
+    for (std::size_t i{}; i < std::size(values); ++i)
+    {
+        expected[i] = Utils::VectorMath::Sin(values[i]);
+    }
+
+    Utils::VectorMath::Sin(values, values);
+
+    for (std::size_t i{}; i < std::size(values); ++i)
+    {
+        ASSERT_NEAR(values[i], expected[i], 1e-15);
+    }
+
+    const std::vector<double> first{ 1.0, 5.0, -2.0, 7.0, 0.0 };
+    const std::vector<double> second{ 2.0, 4.0, -3.0, 7.5, -0.5 };
+    std::vector<double> output(std::size(first));
+
+    Utils::VectorMath::Min(first, second, output);
+    ASSERT_EQ(output, (std::vector<double>{ 1.0, 4.0, -3.0, 7.0, -0.5 }));
+
+    Utils::VectorMath::Max(first, second, output);
+    ASSERT_EQ(output, (std::vector<double>{ 2.0, 5.0, -2.0, 7.5, 0.0 }));
+}
+
+TEST_F(VectorMathTest, PairwiseReductionIsIndependentOfThreads)
+{
+    // Level by level reference, an odd last value is carried to the next level.
+    auto Reference = [](std::vector<double> values, bool product)
+    {
+        while (std::size(values) > 1)
+        {
+            std::vector<double> next{};
+            for (std::size_t i{}; i + 1 < std::size(values); i += 2)
+            {
+                next.push_back(product ? values[i] * values[i + 1] : values[i] + values[i + 1]);
+            }
+
+            if (std::size(values) % 2 != 0)
+            {
+                next.push_back(values.back());
+            }
+
+            values = std::move(next);
+        }
+
+        return values.front();
+    };
+
+    std::mt19937_64 generator{ 42 };
+    std::uniform_real_distribution<double> terms{ -1e3, 1e3 };
+    std::uniform_real_distribution<double> factors{ 0.999, 1.001 };
+
+    // Large enough to be split over several threads, with a partial last chunk.
+    std::vector<double> sum_values(300'007);
+    std::vector<double> product_values(std::size(sum_values));
+
+    for (auto& x : sum_values) { x = terms(generator); }
+    for (auto& x : product_values) { x = factors(generator); }
+
+    const auto expected_sum{ Reference(sum_values, false) };
+    const auto expected_product{ Reference(product_values, true) };
+
+    for (const std::size_t max_threads : { 1, 2, 4, 7 })
+    {
+        auto values{ sum_values };
+        ASSERT_EQ(Utils::VectorMath::PairwiseSum(values, max_threads), expected_sum) << max_threads << " threads";
+
+        values = product_values;
+        ASSERT_EQ(Utils::VectorMath::PairwiseProduct(values, max_threads), expected_product) << max_threads << " threads";
+    }
+
+    std::vector<double> small{ 1.0, 2.0, 3.0, 4.0, 5.0 };
+    ASSERT_EQ(Utils::VectorMath::PairwiseSum(small), 15.0);
+
+    ASSERT_EQ(Utils::VectorMath::PairwiseSum({}), 0.0);
+    ASSERT_EQ(Utils::VectorMath::PairwiseProduct({}), 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,412 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "parallel-tokenizer.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+
+namespace
+{
+    using State = Tokenizer::State;
+    using Token = Tokenizer::Token;
+
+    enum class CharacterClass : std::uint8_t
+    {
+        LeftParenthesis,
+        RightParenthesis,
+        Minus,
+        Operator,
+        Digit,
+        Point,
+        Letter,
+        Separator,
+        Other,
+        Count
+    };
+
+    enum class Action : std::uint8_t
+    {
+        None,
+        BeginLexeme,
+        EmitSymbol,
+        EndLexemeAndEmitSymbol,
+        EndFunctionAndEmitSymbol
+    };
+
+    struct Transition
+    {
+        State mNext;
+        Action mAction;
+        Token mToken;
+    };
+
+    constexpr auto kStateCount{ static_cast<std::size_t>(State::End) + 1 };
+    constexpr auto kClassCount{ static_cast<std::size_t>(CharacterClass::Count) };
+
+    // No lexeme is open, or the open one began in an earlier chunk.
+    constexpr qsizetype kNoLexeme{ -1 };
+    constexpr qsizetype kOpenLexeme{ -2 };
+
+    // Same transitions and emitted tokens as the coroutine states of Tokenizer, everything else is an error.
+    constexpr auto kTransitions = []()
+    {
+        std::array<std::array<Transition, kClassCount>, kStateCount> table{};
+        for (auto& row : table)
+        {
+            row.fill({ State::Error, Action::None, Token::Integer });
+        }
+
+        auto Set = [&table](State state, CharacterClass character_class, State next, Action action, Token token = Token::Integer)
+        {
+            table[static_cast<std::size_t>(state)][static_cast<std::size_t>(character_class)] = { next, action, token };
+        };
+
+        // Where an operand may start.
+        for (const auto state : { State::Init, State::LeftParenthesis, State::Unary, State::Operator, State::Separator })
+        {
+            Set(state, CharacterClass::Digit, State::Digit, Action::BeginLexeme);
+            Set(state, CharacterClass::Letter, State::Identifier, Action::BeginLexeme);
+
+            if (state != State::Unary)
+            {
+                Set(state, CharacterClass::LeftParenthesis, State::LeftParenthesis, Action::EmitSymbol, Token::LeftParenthesis);
+            }
+        }
+
+        for (const auto state : { State::LeftParenthesis, State::Separator })
+        {
+            Set(state, CharacterClass::Minus, State::Unary, Action::EmitSymbol, Token::UnaryOperator);
+        }
+
+        // Where an operand may end.
+        for (const auto state : { State::RightParenthesis, State::Digit, State::FloatingPoint, State::Identifier })
+        {
+            const auto action{ state == State::RightParenthesis ? Action::EmitSymbol : Action::EndLexemeAndEmitSymbol };
+
+            Set(state, CharacterClass::Minus, State::Operator, action, Token::Operator);
+            Set(state, CharacterClass::Operator, State::Operator, action, Token::Operator);
+            Set(state, CharacterClass::RightParenthesis, State::RightParenthesis, action, Token::RightParenthesis);
+            Set(state, CharacterClass::Separator, State::Separator, action, Token::Separator);
+        }
+
+        Set(State::Digit, CharacterClass::Digit, State::Digit, Action::None);
+        Set(State::Digit, CharacterClass::Point, State::Point, Action::None);
+        Set(State::Point, CharacterClass::Digit, State::FloatingPoint, Action::None);
+        Set(State::FloatingPoint, CharacterClass::Digit, State::FloatingPoint, Action::None);
+
+        Set(State::Identifier, CharacterClass::Digit, State::Identifier, Action::None);
+        Set(State::Identifier, CharacterClass::Letter, State::Identifier, Action::None);
+        Set(State::Identifier, CharacterClass::LeftParenthesis, State::LeftParenthesis, Action::EndFunctionAndEmitSymbol, Token::LeftParenthesis);
+
+        return table;
+    }();
+
+    // Tokenizer classifies the Latin-1 byte with the C character functions, which reject everything outside ASCII.
+    constexpr auto kCharacterClasses = []()
+    {
+        std::array<CharacterClass, 128> classes{};
+        classes.fill(CharacterClass::Other);
+
+        for (char ch{ '0' }; ch <= '9'; ++ch)
+        {
+            classes[static_cast<std::size_t>(ch)] = CharacterClass::Digit;
+        }
+
+        for (char ch{ 'a' }; ch <= 'z'; ++ch)
+        {
+            classes[static_cast<std::size_t>(ch)] = CharacterClass::Letter;
+            classes[static_cast<std::size_t>(ch - 'a' + 'A')] = CharacterClass::Letter;
+        }
+
+        classes['_'] = CharacterClass::Letter;
+        classes['('] = CharacterClass::LeftParenthesis;
+        classes[')'] = CharacterClass::RightParenthesis;
+        classes['-'] = CharacterClass::Minus;
+        classes['+'] = CharacterClass::Operator;
+        classes['*'] = CharacterClass::Operator;
+        classes['/'] = CharacterClass::Operator;
+        classes['^'] = CharacterClass::Operator;
+        classes['.'] = CharacterClass::Point;
+        classes[','] = CharacterClass::Separator;
+
+        return classes;
+    }();
+
+    const Transition& Step(State state, QChar ch) noexcept
+    {
+        const auto unicode{ ch.unicode() };
+        const auto character_class{ unicode < std::size(kCharacterClasses) ? kCharacterClasses[unicode] : CharacterClass::Other };
+
+        return kTransitions[static_cast<std::size_t>(state)][static_cast<std::size_t>(character_class)];
+    }
+
+    [[nodiscard]] bool IsLexemeState(State state) noexcept
+    {
+        return state == State::Digit || state == State::Point || state == State::FloatingPoint || state == State::Identifier;
+    }
+
+    [[nodiscard]] Token GetLexemeToken(State state) noexcept
+    {
+        switch (state)
+        {
+        case State::Digit:
+            return Token::Integer;
+        case State::Identifier:
+            return Token::Identifier;
+        default:
+            return Token::FloatingPoint;
+        }
+    }
+}
+
+ParallelTokenizer::ParallelTokenizer(std::size_t thread_count, qsizetype chunk_size) :
+    mTaskScheduler{ thread_count }, mChunkSize{ std::max(chunk_size, qsizetype{ 1 }) }, 
+    mInput{}, mChunks{}, mTokens{}, mErrorMessage{}, mErrorFlag{}, mTokenizer{}
+{ }
+
+void ParallelTokenizer::Init(const QString& input)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+
+    mInput = input;
+    mTokens.clear();
+
+    mErrorFlag = false;
+    mErrorMessage.clear();
+}
+
+void ParallelTokenizer::Run()
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+
+    const auto chunk_count{ static_cast<std::size_t>((mInput.size() + mChunkSize - 1) / mChunkSize) };
+    mChunks.resize(chunk_count);
+
+    for (std::size_t i{}; i < chunk_count; ++i)
+    {
+        mChunks[i].mBegin = static_cast<qsizetype>(i) * mChunkSize;
+        mChunks[i].mEnd = std::min(mChunks[i].mBegin + mChunkSize, mInput.size());
+    }
+
+    ForEachChunk([this](Chunk& chunk) { MapStates(chunk); });
+
+    if (!ScanStates())
+    {
+        RunSequentially();
+        return;
+    }
+
+    ForEachChunk([this](Chunk& chunk) { Scan(chunk); });
+    Stitch();
+    ForEachChunk([this](Chunk& chunk) { Materialize(chunk); });
+
+    std::size_t token_count{};
+    for (const auto& chunk : mChunks)
+    {
+        token_count += std::size(chunk.mTokens);
+    }
+
+    mTokens.reserve(token_count);
+    for (auto& chunk : mChunks)
+    {
+        std::move(std::begin(chunk.mTokens), std::end(chunk.mTokens), std::back_inserter(mTokens));
+        chunk.mTokens.clear();
+    }
+}
+
+const std::vector<Tokenizer::TokenPair>& ParallelTokenizer::GetTokens() const noexcept { return mTokens; }
+
+bool ParallelTokenizer::HasError() const noexcept { return mErrorFlag; }
+const QString& ParallelTokenizer::GetErrorMessage() const noexcept { return mErrorMessage; }
+
+void ParallelTokenizer::MapStates(Chunk& chunk) const
+{
+    // One run per state, Error and End included to keep the indexing trivial, they fail right away.
+    for (std::size_t i{}; i < kStateCount; ++i)
+    {
+        chunk.mEndStates[i] = static_cast<State>(i) == State::End ? State::Error : static_cast<State>(i);
+    }
+
+    auto position{ chunk.mBegin };
+    auto survivor{ State::Error };
+    bool is_converged{ false };
+
+    while (position < chunk.mEnd && !is_converged)
+    {
+        const auto ch{ mInput[position++] };
+
+        is_converged = true;
+        survivor = State::Error;
+
+        for (auto& state : chunk.mEndStates)
+        {
+            state = Step(state, ch).mNext;
+
+            if (state != State::Error)
+            {
+                is_converged = is_converged && (survivor == State::Error || survivor == state);
+                survivor = state;
+            }
+        }
+    }
+
+    // The chunk ended before the runs met, the states are already final.
+    if (!is_converged)
+    {
+        return;
+    }
+
+    // Every surviving run is in the same state now, one of them stands for all.
+    for (; position < chunk.mEnd && survivor != State::Error; ++position)
+    {
+        survivor = Step(survivor, mInput[position]).mNext;
+    }
+
+    for (auto& state : chunk.mEndStates)
+    {
+        state = state == State::Error ? State::Error : survivor;
+    }
+}
+
+bool ParallelTokenizer::ScanStates()
+{
+    auto state{ State::Init };
+
+    for (auto& chunk : mChunks)
+    {
+        chunk.mStartState = state;
+        state = chunk.mEndStates[static_cast<std::size_t>(state)];
+
+        if (state == State::Error)
+        {
+            return false;
+        }
+    }
+
+    // The same condition as the End state of Tokenizer.
+    return state == State::Digit || state == State::FloatingPoint || state == State::Identifier || state == State::RightParenthesis;
+}
+
+void ParallelTokenizer::Scan(Chunk& chunk) const
+{
+    auto state{ chunk.mStartState };
+    auto lexeme_begin{ IsLexemeState(state) ? kOpenLexeme : kNoLexeme };
+
+    chunk.mRawTokens.clear();
+
+    for (auto position{ chunk.mBegin }; position < chunk.mEnd; ++position)
+    {
+        const auto& [next, action, token]{ Step(state, mInput[position]) };
+
+        switch (action)
+        {
+        case Action::None:
+            break;
+
+        case Action::BeginLexeme:
+            lexeme_begin = position;
+            break;
+
+        case Action::EmitSymbol:
+            chunk.mRawTokens.push_back({ position, position + 1, token });
+            break;
+
+        case Action::EndLexemeAndEmitSymbol:
+        case Action::EndFunctionAndEmitSymbol:
+            chunk.mRawTokens.push_back({ lexeme_begin, position, action == Action::EndFunctionAndEmitSymbol ? Token::Function : GetLexemeToken(state) });
+            chunk.mRawTokens.push_back({ position, position + 1, token });
+
+            lexeme_begin = kNoLexeme;
+            break;
+        }
+
+        state = next;
+    }
+
+    // The last chunk ends the input, where Tokenizer emits the lexeme still open.
+    if (chunk.mEnd == mInput.size() && IsLexemeState(state))
+    {
+        chunk.mRawTokens.push_back({ lexeme_begin, chunk.mEnd, GetLexemeToken(state) });
+    }
+
+    chunk.mOpenLexemeBegin = lexeme_begin;
+}
+
+void ParallelTokenizer::Stitch()
+{
+    // Only the first token of a chunk can complete a lexeme begun before it, possibly several chunks back.
+    auto open_lexeme_begin{ kNoLexeme };
+
+    for (auto& chunk : mChunks)
+    {
+        if (!std::empty(chunk.mRawTokens) && chunk.mRawTokens.front().mBegin == kOpenLexeme)
+        {
+            chunk.mRawTokens.front().mBegin = open_lexeme_begin;
+        }
+
+        if (chunk.mOpenLexemeBegin != kOpenLexeme)
+        {
+            open_lexeme_begin = chunk.mOpenLexemeBegin;
+        }
+    }
+}
+
+void ParallelTokenizer::Materialize(Chunk& chunk) const
+{
+    chunk.mTokens.clear();
+    chunk.mTokens.reserve(std::size(chunk.mRawTokens));
+
+    for (const auto& [begin, end, token] : chunk.mRawTokens)
+    {
+        chunk.mTokens.emplace_back(mInput.mid(begin, end - begin), token);
+    }
+}
+
+template <typename Function>
+void ParallelTokenizer::ForEachChunk(Function function)
+{
+    Utils::TaskScheduler::TaskGroup group{};
+
+    for (std::size_t i{ 1 }; i < std::size(mChunks); ++i)
+    {
+        mTaskScheduler.Spawn(group, [&function, &chunk = mChunks[i]]() { function(chunk); });
+    }
+
+    if (!std::empty(mChunks))
+    {
+        function(mChunks.front());
+    }
+
+    mTaskScheduler.Wait(group);
+}
+
+void ParallelTokenizer::RunSequentially()
+{
+    mTokenizer.Init(mInput);
+    mTokenizer.Run();
+
+    mTokens = mTokenizer.GetTokens();
+    mErrorFlag = mTokenizer.HasError();
+    mErrorMessage = mTokenizer.GetErrorMessage();
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Tokenizes very large inputs on several threads, producing exactly the tokens of Tokenizer.
+
+    The input is split into chunks. The state a chunk starts in depends on everything before it, 
+    so every chunk is first run from each state the FSM can be in between two characters 
+    (speculative enumeration). The runs converge after a few characters, from there on only one 
+    of them is stepped. A prefix scan over the chunks' state maps gives every chunk its true start 
+    state, then the chunks are tokenized in parallel and their token lists stitched together: 
+    a lexeme crossing a chunk boundary is completed by the chunk in which it ends.
+
+    The transitions are a table mirroring the coroutine states of Tokenizer. Inputs with an error 
+    are handed to Tokenizer itself, so the message and the tokens before the error are its own.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <QString>
+
+#include <tokenizer.hpp>
+#include <task-scheduler.hpp>
+
+class ParallelTokenizer
+{
+public:
+    // Large enough for the enumeration before the runs converge to be negligible.
+    static constexpr qsizetype kDefaultChunkSize{ qsizetype{ 1 } << 20 };
+
+public:
+    // thread_count counts the calling thread, 0 means one thread per hardware thread.
+    explicit ParallelTokenizer(std::size_t thread_count = 0, qsizetype chunk_size = kDefaultChunkSize);
+    ~ParallelTokenizer() noexcept = default;
+
+    void Init(const QString& input);
+    void Run();
+
+    [[nodiscard]] const std::vector<Tokenizer::TokenPair>& GetTokens() const noexcept;
+
+    [[nodiscard]] bool HasError() const noexcept;
+    [[nodiscard]] const QString& GetErrorMessage() const noexcept;
+
+private:
+    static constexpr std::size_t kStateCount{ static_cast<std::size_t>(Tokenizer::State::End) + 1 };
+
+    // Token as a range of the input, the lexeme is copied out once the ranges are final.
+    struct RawToken
+    {
+        qsizetype mBegin;
+        qsizetype mEnd;
+        Tokenizer::Token mToken;
+    };
+
+    struct Chunk
+    {
+        qsizetype mBegin;
+        qsizetype mEnd;
+
+        // State after the chunk for every state it may start in, Error when the run fails.
+        std::array<Tokenizer::State, kStateCount> mEndStates;
+        Tokenizer::State mStartState;
+
+        std::vector<RawToken> mRawTokens;
+        qsizetype mOpenLexemeBegin;
+
+        std::vector<Tokenizer::TokenPair> mTokens;
+    };
+
+private:
+    void MapStates(Chunk& chunk) const;
+    void Scan(Chunk& chunk) const;
+    void Materialize(Chunk& chunk) const;
+
+    // Resolves the start states, false when the input has an error.
+    [[nodiscard]] bool ScanStates();
+    void Stitch();
+
+    template <typename Function>
+    void ForEachChunk(Function function);
+
+    void RunSequentially();
+
+private:
+    Utils::TaskScheduler mTaskScheduler;
+    qsizetype mChunkSize;
+
+    QString mInput;
+    std::vector<Chunk> mChunks;
+    std::vector<Tokenizer::TokenPair> mTokens;
+
+    QString mErrorMessage;
+    bool mErrorFlag;
+
+    Tokenizer mTokenizer;
+};
\ No newline at end of file
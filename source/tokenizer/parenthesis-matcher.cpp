@@ -0,0 +1,245 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "parenthesis-matcher.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+#include <logger.hpp>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+#ifdef __SSE2__
+    constexpr qsizetype kBlockWidth{ 8 };
+
+    // Horizontal minimum and maximum of eight signed 16 bit lanes.
+    [[nodiscard]] std::int16_t MinLane(__m128i values) noexcept
+    {
+        values = _mm_min_epi16(values, _mm_shuffle_epi32(values, 0b01'00'11'10));
+        values = _mm_min_epi16(values, _mm_shuffle_epi32(values, 0b10'11'00'01));
+        values = _mm_min_epi16(values, _mm_shufflelo_epi16(values, 0b10'11'00'01));
+
+        return static_cast<std::int16_t>(_mm_cvtsi128_si32(values));
+    }
+
+    [[nodiscard]] std::int16_t MaxLane(__m128i values) noexcept
+    {
+        values = _mm_max_epi16(values, _mm_shuffle_epi32(values, 0b01'00'11'10));
+        values = _mm_max_epi16(values, _mm_shuffle_epi32(values, 0b10'11'00'01));
+        values = _mm_max_epi16(values, _mm_shufflelo_epi16(values, 0b10'11'00'01));
+
+        return static_cast<std::int16_t>(_mm_cvtsi128_si32(values));
+    }
+#endif
+}
+
+ParenthesisMatcher::ParenthesisMatcher() :
+    mPairs{}, mOpenPairs{}, mMaxDepth{}, mErrorOffset{ -1 }, mErrorMessage{}
+{ }
+
+bool ParenthesisMatcher::Check(QStringView input)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+    return Run<false>(input);
+}
+
+bool ParenthesisMatcher::Match(QStringView input)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+    return Run<true>(input);
+}
+
+const std::vector<ParenthesisMatcher::Pair>& ParenthesisMatcher::GetPairs() const noexcept
+{
+    return mPairs;
+}
+
+qsizetype ParenthesisMatcher::FindMatch(qsizetype left) const noexcept
+{
+    const auto pair{ std::lower_bound(std::cbegin(mPairs), std::cend(mPairs), left, [](const Pair& pair, qsizetype offset) { return pair.mLeft < offset; }) };
+    return pair != std::cend(mPairs) && pair->mLeft == left ? pair->mRight : -1;
+}
+
+qsizetype ParenthesisMatcher::GetMaxDepth() const noexcept { return mMaxDepth; }
+qsizetype ParenthesisMatcher::GetErrorOffset() const noexcept { return mErrorOffset; }
+
+bool ParenthesisMatcher::HasError() const noexcept { return mErrorOffset >= 0; }
+const QString& ParenthesisMatcher::GetErrorMessage() const noexcept { return mErrorMessage; }
+
+template <bool CollectPairs>
+bool ParenthesisMatcher::Run(QStringView input)
+{
+    mPairs.clear();
+    mOpenPairs.clear();
+
+    mMaxDepth = 0;
+    mErrorOffset = -1;
+    mErrorMessage.clear();
+
+    qsizetype depth{};
+
+    // One character, false on an extra ')'.
+    auto Step = [this, &depth](qsizetype offset, char16_t ch)
+    {
+        if (ch == u'(')
+        {
+            if constexpr (CollectPairs)
+            {
+                mOpenPairs.push_back(std::size(mPairs));
+                mPairs.push_back({ offset, -1 });
+            }
+
+            mMaxDepth = std::max(mMaxDepth, ++depth);
+        }
+        else if (ch == u')')
+        {
+            if (depth == 0)
+            {
+                ReportExtraRight(offset);
+                return false;
+            }
+
+            if constexpr (CollectPairs)
+            {
+                mPairs[mOpenPairs.back()].mRight = offset;
+                mOpenPairs.pop_back();
+            }
+
+            --depth;
+        }
+
+        return true;
+    };
+
+    qsizetype i{};
+
+#ifdef __SSE2__
+    const auto* const data{ input.data() };
+
+    const auto left_parentheses{ _mm_set1_epi16(static_cast<short>(u'(')) };
+    const auto right_parentheses{ _mm_set1_epi16(static_cast<short>(u')')) };
+
+    for (; i + kBlockWidth <= input.size(); i += kBlockWidth)
+    {
+        const auto characters{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)) };
+
+        // All ones in the lanes holding a parenthesis.
+        const auto lefts{ _mm_cmpeq_epi16(characters, left_parentheses) };
+        const auto rights{ _mm_cmpeq_epi16(characters, right_parentheses) };
+
+        auto mask{ static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(lefts, rights))) };
+        if (mask == 0)
+        {
+            continue;
+        }
+
+        if constexpr (CollectPairs)
+        {
+            // Every pair needs its own bookkeeping, only the parentheses themselves are visited.
+            while (mask != 0)
+            {
+                // movemask yields two bits per 16 bit lane.
+                const auto lane{ std::countr_zero(mask) / 2 };
+                mask &= ~(0b11U << (lane * 2));
+
+                if (!Step(i + lane, data[i + lane].unicode()))
+                {
+                    return false;
+                }
+            }
+        }
+        else
+        {
+            // 0 - (-1) for '(' and -1 - 0 for ')', then the inclusive prefix sum of the eight lanes.
+            auto depths{ _mm_sub_epi16(rights, lefts) };
+            depths = _mm_add_epi16(depths, _mm_slli_si128(depths, 2));
+            depths = _mm_add_epi16(depths, _mm_slli_si128(depths, 4));
+            depths = _mm_add_epi16(depths, _mm_slli_si128(depths, 8));
+
+            if (depth + MinLane(depths) < 0)
+            {
+                // The extra ')' is in this block.
+                auto offset{ i };
+                while (Step(offset, data[offset].unicode()))
+                {
+                    ++offset;
+                }
+
+                return false;
+            }
+
+            mMaxDepth = std::max(mMaxDepth, depth + MaxLane(depths));
+            depth += static_cast<std::int16_t>(_mm_extract_epi16(depths, 7));
+        }
+    }
+#endif
+
+    for (; i < input.size(); ++i)
+    {
+        if (!Step(i, input[i].unicode()))
+        {
+            return false;
+        }
+    }
+
+    if (depth != 0)
+    {
+        ReportMissingRight(input, depth);
+        return false;
+    }
+
+    return true;
+}
+
+void ParenthesisMatcher::ReportExtraRight(qsizetype offset)
+{
+    mErrorOffset = offset;
+    mErrorMessage = QStringLiteral("extra right parenthesis at %1").arg(static_cast<long long>(offset));
+}
+
+void ParenthesisMatcher::ReportMissingRight(QStringView input, qsizetype depth)
+{
+    // Walking back from the end, the first '(' entered from depth 0 is the outermost one never closed.
+    auto offset{ input.size() };
+    while (depth != 0 || input[offset].unicode() != u'(')
+    {
+        --offset;
+
+        if (input[offset].unicode() == u'(')
+        {
+            --depth;
+        }
+        else if (input[offset].unicode() == u')')
+        {
+            ++depth;
+        }
+    }
+
+    mErrorOffset = offset;
+    mErrorMessage = QStringLiteral("right parenthesis missing for the left one at %1").arg(static_cast<long long>(offset));
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Checks the nesting of parentheses before anything is parsed, so a malformed multi-megabyte 
+    expression is rejected up front, with the offset of the offending parenthesis, instead of 
+    after tokenizing and converting everything before it.
+
+    The depth is the prefix sum of +1 for '(' and -1 for ')'. With SSE2, eight UTF-16 characters 
+    are classified per step and summed by three shifted additions; the minimum of the block tells 
+    whether the depth went below zero inside it, only then is the block looked at character by character.
+
+    Match also records every matching pair, so code splitting an expression into independent 
+    parts can jump from a '(' to its ')' without parsing what lies between them.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include <QString>
+#include <QStringView>
+
+class ParenthesisMatcher
+{
+public:
+    struct Pair
+    {
+        qsizetype mLeft;
+        qsizetype mRight;
+    };
+
+public:
+    ParenthesisMatcher();
+    ~ParenthesisMatcher() noexcept = default;
+
+    // Nesting depth only.
+    [[nodiscard]] bool Check(QStringView input);
+
+    // Nesting depth and the offsets of the matching pairs.
+    [[nodiscard]] bool Match(QStringView input);
+
+    // Pairs found by the last Match, ordered by the offset of the left parenthesis.
+    [[nodiscard]] const std::vector<Pair>& GetPairs() const noexcept;
+
+    // Offset of the ')' matching the '(' at left, -1 when there is no '(' at left.
+    [[nodiscard]] qsizetype FindMatch(qsizetype left) const noexcept;
+
+    [[nodiscard]] qsizetype GetMaxDepth() const noexcept;
+
+    // Offset of an extra ')' or of the outermost '(' which is never closed, -1 without an error.
+    [[nodiscard]] qsizetype GetErrorOffset() const noexcept;
+
+    [[nodiscard]] bool HasError() const noexcept;
+    [[nodiscard]] const QString& GetErrorMessage() const noexcept;
+
+private:
+    template <bool CollectPairs>
+    [[nodiscard]] bool Run(QStringView input);
+
+    void ReportExtraRight(qsizetype offset);
+    void ReportMissingRight(QStringView input, qsizetype depth);
+
+private:
+    std::vector<Pair> mPairs;
+
+    // Indices in mPairs of the parentheses still open.
+    std::vector<std::size_t> mOpenPairs;
+
+    qsizetype mMaxDepth;
+    qsizetype mErrorOffset;
+    QString mErrorMessage;
+};
\ No newline at end of file
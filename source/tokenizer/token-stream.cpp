@@ -0,0 +1,183 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "token-stream.hpp"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <string_view>
+
+TokenStream::TokenStream() :
+    mKinds{}, mValues{}, mOffsets{}, mNames{}, mErrorMessage{}
+{ }
+
+bool TokenStream::Assign(const std::vector<Tokenizer::TokenPair>& tokens)
+{
+    Clear();
+    Reserve(std::size(tokens));
+
+    // The tokenizer accepts no white space, every token starts where the previous one ends.
+    std::uint32_t offset{};
+
+    for (const auto& [lexeme, token, value] : tokens)
+    {
+        switch (token)
+        {
+        case Tokenizer::Token::Integer:
+        case Tokenizer::Token::FloatingPoint:
+            Push(Kind::Number, value, offset);
+            break;
+
+        case Tokenizer::Token::Identifier:
+        {
+            // An expression names few variables, a linear scan finds them faster than hashing the lexeme.
+            const auto index{ static_cast<std::size_t>(std::distance(std::cbegin(mNames), std::find(std::cbegin(mNames), std::cend(mNames), lexeme))) };
+            if (index == std::size(mNames))
+            {
+                mNames.push_back(lexeme);
+            }
+
+            Push(Kind::Identifier, static_cast<double>(index), offset);
+            break;
+        }
+
+        case Tokenizer::Token::Function:
+        {
+            const auto* descriptor{ MathFunctions::Find(lexeme) };
+            if (descriptor == nullptr)
+            {
+                Clear();
+                mErrorMessage = QStringLiteral("unknown function: %1").arg(lexeme);
+                return false;
+            }
+
+            Push(Kind::Function, static_cast<double>(descriptor->mId), offset);
+            break;
+        }
+
+        case Tokenizer::Token::UnaryOperator:
+            Push(Kind::Negate, 0.0, offset);
+            break;
+
+        case Tokenizer::Token::Operator:
+        {
+            static constexpr std::array kOperators{ Kind::Add, Kind::Subtract, Kind::Multiply, Kind::Divide, Kind::Power };
+            constexpr std::u16string_view kSymbols{ u"+-*/^" };
+
+            Push(kOperators[kSymbols.find(lexeme[0].unicode())], 0.0, offset);
+            break;
+        }
+
+        case Tokenizer::Token::LeftParenthesis:
+            Push(Kind::LeftParenthesis, 0.0, offset);
+            break;
+
+        case Tokenizer::Token::RightParenthesis:
+            Push(Kind::RightParenthesis, 0.0, offset);
+            break;
+
+        case Tokenizer::Token::Separator:
+            Push(Kind::Separator, 0.0, offset);
+            break;
+        }
+
+        offset += static_cast<std::uint32_t>(lexeme.size());
+    }
+
+    return true;
+}
+
+void TokenStream::Clear() noexcept
+{
+    mKinds.clear();
+    mValues.clear();
+    mOffsets.clear();
+    mNames.clear();
+    mErrorMessage.clear();
+}
+
+void TokenStream::Reserve(std::size_t size)
+{
+    mKinds.reserve(size);
+    mValues.reserve(size);
+    mOffsets.reserve(size);
+}
+
+void TokenStream::Push(Kind kind, double value, std::uint32_t offset)
+{
+    mKinds.push_back(kind);
+    mValues.push_back(value);
+    mOffsets.push_back(offset);
+}
+
+void TokenStream::ShareNames(const TokenStream& other)
+{
+    // QString copies share the text.
+    mNames.assign(std::cbegin(other.mNames), std::cend(other.mNames));
+}
+
+std::size_t TokenStream::GetSize() const noexcept
+{
+    return std::size(mKinds);
+}
+
+bool TokenStream::IsEmpty() const noexcept
+{
+    return std::empty(mKinds);
+}
+
+std::span<const TokenStream::Kind> TokenStream::GetKinds() const noexcept { return mKinds; }
+std::span<const double> TokenStream::GetValues() const noexcept { return mValues; }
+std::span<const std::uint32_t> TokenStream::GetOffsets() const noexcept { return mOffsets; }
+const std::vector<QString>& TokenStream::GetNames() const noexcept { return mNames; }
+
+std::int32_t TokenStream::GetPriority(Kind kind) noexcept
+{
+    // Same priorities as RPNConverter::GetOperatorPriority.
+    switch (kind)
+    {
+    case Kind::Add:
+    case Kind::Subtract:
+        return 1;
+
+    case Kind::Multiply:
+    case Kind::Divide:
+        return 2;
+
+    case Kind::Power:
+        return 3;
+
+    default:
+        return -1;
+    }
+}
+
+bool TokenStream::HasError() const noexcept
+{
+    return !mErrorMessage.isEmpty();
+}
+
+const QString& TokenStream::GetErrorMessage() const noexcept
+{
+    return mErrorMessage;
+}
\ No newline at end of file
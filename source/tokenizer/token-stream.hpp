@@ -0,0 +1,101 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Tokens as a structure of arrays: one byte of kind per token, the numeric values in an array 
+    of doubles of their own and the source offsets, only needed for error messages, apart from both. 
+    A std::vector<Tokenizer::TokenPair> spends 40 bytes per token, mostly on the QString handle 
+    and padding; a pass over a TokenStream reads 1 byte per token for the kinds plus 8 for the 
+    values it actually uses, so far more tokens fit in every cache line it loads.
+
+    The value of a Number is the literal, of a Function the MathFunctions::Id and of an 
+    Identifier the index of its name in GetNames(), the same for every occurrence of the name. 
+    The lexemes themselves are not kept, the source text and the offsets give them back when needed.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <QString>
+
+#include <tokenizer.hpp>
+#include <math-functions.hpp>
+
+class TokenStream
+{
+public:
+    enum class Kind : std::uint8_t
+    {
+        Number,
+        Identifier,
+        Negate,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Power,
+        Function,
+        LeftParenthesis,
+        RightParenthesis,
+        Separator,
+    };
+
+public:
+    TokenStream();
+    ~TokenStream() noexcept = default;
+
+    // Replaces the content, the arrays keep their capacity. Fails on an unknown function.
+    [[nodiscard]] bool Assign(const std::vector<Tokenizer::TokenPair>& tokens);
+
+    void Clear() noexcept;
+    void Reserve(std::size_t size);
+
+    void Push(Kind kind, double value, std::uint32_t offset);
+
+    // The names of another stream, the values of identifiers copied from it stay valid.
+    void ShareNames(const TokenStream& other);
+
+    [[nodiscard]] std::size_t GetSize() const noexcept;
+    [[nodiscard]] bool IsEmpty() const noexcept;
+
+    [[nodiscard]] std::span<const Kind> GetKinds() const noexcept;
+    [[nodiscard]] std::span<const double> GetValues() const noexcept;
+    [[nodiscard]] std::span<const std::uint32_t> GetOffsets() const noexcept;
+    [[nodiscard]] const std::vector<QString>& GetNames() const noexcept;
+
+    // Binding power of an operator kind, -1 for every other kind.
+    [[nodiscard]] static std::int32_t GetPriority(Kind kind) noexcept;
+
+    [[nodiscard]] bool HasError() const noexcept;
+    [[nodiscard]] const QString& GetErrorMessage() const noexcept;
+
+private:
+    std::vector<Kind> mKinds;
+    std::vector<double> mValues;
+    std::vector<std::uint32_t> mOffsets;
+    std::vector<QString> mNames;
+
+    QString mErrorMessage;
+};
\ No newline at end of file
@@ -22,15 +22,48 @@
 
 #include "tokenizer.hpp"
 
-QString Tokenizer::mIntermediateBuffer{};
-Tokenizer::Token Tokenizer::mIntermediateToken{};
+#include <array>
+#include <charconv>
+#include <string>
+#include <string_view>
 
-std::vector<Tokenizer::TokenPair> Tokenizer::mTokens{};
+namespace
+{
+    // Every power of ten up to 10^22 is exactly representable in a double.
+    constexpr auto kExactPowersOfTen = []()
+    {
+        std::array<double, 23> powers{};
+        powers[0] = 1.0;
+
+        for (std::size_t i{ 1 }; i < std::size(powers); ++i)
+        {
+            powers[i] = powers[i - 1] * 10.0;
+        }
+
+        return powers;
+    }();
+
+    constexpr std::uint64_t kMaxExactMantissa{ std::uint64_t{ 1 } << 53 };
+    constexpr qsizetype kMaxFastPathLength{ 19 };
+}
 
-QString Tokenizer::mErrorMessage{};
-bool Tokenizer::mErrorFlag{};
+Tokenizer::TokenPair::TokenPair(QString lexeme, Token token) :
+    mLexeme{ std::move(lexeme) }, mToken{ token }, mValue{}
+{
+    if (mToken == Tokenizer::Token::Integer || mToken == Tokenizer::Token::FloatingPoint)
+    {
+        mValue = Tokenizer::ParseNumber(mLexeme);
+    }
+}
+
+bool Tokenizer::TokenPair::operator==(const TokenPair& other) const noexcept
+{
+    return mToken == other.mToken && mLexeme == other.mLexeme;
+}
 
 Tokenizer::Tokenizer() : 
+    mIntermediateBuffer{}, mIntermediateToken{}, mTokens{}, mFirstChangedToken{}, mSpareLexemes{}, 
+    mErrorMessage{}, mErrorFlag{}, mInput{}, mCheckpoints{}, mIsIncremental{}, mLimits{}, mLimitViolation{}, mDeadlineCountdown{}, mFrameCache{}, 
     mFiniteStateMachine{ nullptr }
 { }
 
@@ -38,56 +71,300 @@ void Tokenizer::Init(const QString& input)
 {
     UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
 
-    auto input_generator{ Tokenizer::InputSequence(input) };
-    mFiniteStateMachine.SetInputGenerator(std::move(input_generator));
-
-    mFiniteStateMachine.AddState(Tokenizer::State::Init, Tokenizer::InitState);
-    mFiniteStateMachine.AddState(Tokenizer::State::LeftParenthesis, Tokenizer::LeftParenthesis);
-    mFiniteStateMachine.AddState(Tokenizer::State::RightParenthesis, Tokenizer::RightParenthesis);
-    mFiniteStateMachine.AddState(Tokenizer::State::Unary, Tokenizer::Unary);
-    mFiniteStateMachine.AddState(Tokenizer::State::Digit, Tokenizer::Digit);
-    mFiniteStateMachine.AddState(Tokenizer::State::FloatingPoint, Tokenizer::FloatingPoint);
-    mFiniteStateMachine.AddState(Tokenizer::State::Point, Tokenizer::Point);
-    mFiniteStateMachine.AddState(Tokenizer::State::Operator, Tokenizer::Operator);
-    mFiniteStateMachine.AddState(Tokenizer::State::Error, Tokenizer::Error);
-    mFiniteStateMachine.AddState(Tokenizer::State::End, Tokenizer::End);
+    // The input generator iterates over the stored copy, not over the caller's string.
+    mInput = input;
+    mCheckpoints.clear();
 
-    Clear();
+    ResetLimitViolation();
+    Start(Tokenizer::InputSequence(0));
 }
 
 void Tokenizer::Run()
 {
     UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
     mFiniteStateMachine.Run(Tokenizer::State::Init);
+
+    ReportLimitViolation(std::size(mTokens));
 }   
 
+void Tokenizer::Run(Utils::InputGenerator<Symbol> input_generator, TokenSink sink, std::size_t batch_size)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+
+    // Nothing of the input is kept, so there is nothing for Update to resume from either.
+    mInput.clear();
+    mCheckpoints.clear();
+
+    bool is_stopped{};
+    std::size_t streamed_token_count{};
+
+    ResetLimitViolation();
+    Start(Tokenizer::StreamSequence(std::move(input_generator), sink, std::max<std::size_t>(batch_size, 1), is_stopped, streamed_token_count));
+
+    mFiniteStateMachine.Run(Tokenizer::State::Init);
+
+    // The sequence refers to the sink, and its source may hold a buffer or a device.
+    mFiniteStateMachine.SetInputGenerator(Utils::InputGenerator<Symbol>{ nullptr });
+
+    ReportLimitViolation(streamed_token_count + std::size(mTokens));
+
+    if (!mErrorFlag && !is_stopped && !std::empty(mTokens))
+    {
+        is_stopped = !sink(mTokens);
+        DropTokens(0);
+    }
+
+    if (is_stopped)
+    {
+        mErrorFlag = true;
+        mErrorMessage = QStringLiteral("Tokenization stopped by the token consumer");
+    }
+}
+
+void Tokenizer::Start(Utils::InputGenerator<Symbol> input_generator)
+{
+    mFiniteStateMachine.SetInputGenerator(std::move(input_generator));
+
+    mFiniteStateMachine.AddState(Tokenizer::State::Init, std::bind_front(&Tokenizer::InitState, this));
+    mFiniteStateMachine.AddState(Tokenizer::State::LeftParenthesis, std::bind_front(&Tokenizer::LeftParenthesis, this));
+    mFiniteStateMachine.AddState(Tokenizer::State::RightParenthesis, std::bind_front(&Tokenizer::RightParenthesis, this));
+    mFiniteStateMachine.AddState(Tokenizer::State::Unary, std::bind_front(&Tokenizer::Unary, this));
+    mFiniteStateMachine.AddState(Tokenizer::State::Digit, std::bind_front(&Tokenizer::Digit, this));
+    mFiniteStateMachine.AddState(Tokenizer::State::FloatingPoint, std::bind_front(&Tokenizer::FloatingPoint, this));
+    mFiniteStateMachine.AddState(Tokenizer::State::Point, std::bind_front(&Tokenizer::Point, this));
+    mFiniteStateMachine.AddState(Tokenizer::State::Operator, std::bind_front(&Tokenizer::Operator, this));
+    mFiniteStateMachine.AddState(Tokenizer::State::Identifier, std::bind_front(&Tokenizer::Identifier, this));
+    mFiniteStateMachine.AddState(Tokenizer::State::Separator, std::bind_front(&Tokenizer::Separator, this));
+    mFiniteStateMachine.AddState(Tokenizer::State::Error, std::bind_front(&Tokenizer::Error, this));
+    mFiniteStateMachine.AddState(Tokenizer::State::End, std::bind_front(&Tokenizer::End, this));
+
+    Clear();
+}
+
+void Tokenizer::Update(const QString& input)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+
+    if (!mIsIncremental || std::empty(mCheckpoints))
+    {
+        Init(input);
+        Run();
+        return;
+    }
+
+    const auto common_prefix_end{ std::mismatch(mInput.cbegin(), mInput.cend(), input.cbegin(), input.cend()).first };
+    const auto common_prefix{ common_prefix_end - mInput.cbegin() };
+
+    // Checkpoints stop at the character which caused an error, if there was one, and the first one is at 0.
+    const auto resumed{ std::upper_bound(std::cbegin(mCheckpoints), std::cend(mCheckpoints), common_prefix, 
+        [](qsizetype position, const Checkpoint& checkpoint) { return position < checkpoint.mPosition; }) - 1 };
+    const auto checkpoint{ *resumed };
+
+    mInput = input;
+    mCheckpoints.erase(resumed, std::cend(mCheckpoints));
+
+    DropTokens(checkpoint.mTokenCount);
+    mFirstChangedToken = checkpoint.mTokenCount;
+
+    mIntermediateBuffer.resize(0);
+
+    mErrorFlag = false;
+    mErrorMessage.clear();
+    ResetLimitViolation();
+
+    auto input_generator{ Tokenizer::InputSequence(checkpoint.mPosition) };
+    mFiniteStateMachine.SetInputGenerator(std::move(input_generator));
+
+    // Only these two states run to completion, every other one is suspended inside its loop and can be resumed.
+    mFiniteStateMachine.AddState(Tokenizer::State::Error, std::bind_front(&Tokenizer::Error, this));
+    mFiniteStateMachine.AddState(Tokenizer::State::End, std::bind_front(&Tokenizer::End, this));
+
+    mFiniteStateMachine.Run(checkpoint.mState);
+
+    ReportLimitViolation(std::size(mTokens));
+}
+
 const std::vector<Tokenizer::TokenPair>& Tokenizer::GetTokens() const noexcept { return mTokens; }
+std::size_t Tokenizer::GetFirstChangedToken() const noexcept { return mFirstChangedToken; }
 
 bool Tokenizer::HasError() const noexcept { return mErrorFlag; }
 const QString& Tokenizer::GetErrorMessage() const noexcept { return mErrorMessage; }
 
-Utils::InputGenerator<Tokenizer::Symbol> Tokenizer::InputSequence(const QString& input)
+void Tokenizer::SetLimits(const Utils::ResourceLimits& limits) noexcept { mLimits = limits; }
+const Utils::ResourceLimits& Tokenizer::GetLimits() const noexcept { return mLimits; }
+
+void Tokenizer::SetIncremental(bool is_enabled) noexcept { mIsIncremental = is_enabled; }
+bool Tokenizer::IsIncremental() const noexcept { return mIsIncremental; }
+Utils::LimitViolation Tokenizer::GetLimitViolation() const noexcept { return mLimitViolation; }
+
+double Tokenizer::ParseNumber(QStringView lexeme) noexcept
+{
+    // Clinger's fast path: an integer mantissa below 2^53 and an exact power of ten 
+    // give the correctly rounded result with a single division.
+    if (lexeme.size() <= kMaxFastPathLength)
+    {
+        std::uint64_t mantissa{};
+        std::size_t fraction_digits{};
+        bool is_fraction{ false };
+
+        for (const auto ch : lexeme)
+        {
+            if (ch == QLatin1Char('.'))
+            {
+                is_fraction = true;
+                continue;
+            }
+
+            mantissa = mantissa * 10 + static_cast<std::uint64_t>(ch.unicode() - u'0');
+            fraction_digits += is_fraction ? 1 : 0;
+        }
+
+        if (mantissa <= kMaxExactMantissa)
+        {
+            return static_cast<double>(mantissa) / kExactPowersOfTen[fraction_digits];
+        }
+    }
+
+    // Long literals go through std::from_chars (Eisel-Lemire with an exact fallback), the digits are plain ASCII.
+    auto from_chars = [&lexeme](char* narrow) -> double
+    {
+        std::transform(lexeme.begin(), lexeme.end(), narrow, [](const QChar ch) { return static_cast<char>(ch.unicode()); });
+
+        double value{};
+        std::from_chars(narrow, narrow + lexeme.size(), value);
+
+        return value;
+    };
+
+    if (std::array<char, 64> buffer{}; lexeme.size() <= std::ssize(buffer))
+    {
+        return from_chars(std::data(buffer));
+    }
+
+    std::string buffer(static_cast<std::size_t>(lexeme.size()), '\0');
+    return from_chars(std::data(buffer));
+}
+
+Utils::InputGenerator<Tokenizer::Symbol> Tokenizer::InputSequence(qsizetype begin)
+{
+    if (static_cast<std::size_t>(mInput.size()) > mLimits.mMaxInputLength)
+    {
+        mLimitViolation = Utils::LimitViolation::InputLength;
+        co_return;
+    }
+
+    // In incremental mode a checkpoint is taken before each character which starts a token, 
+    // when the previous one has been fully processed and no lexeme is pending.
+    for (auto i{ begin }; i < mInput.size(); ++i)
+    {
+        if (IsOverLimit(std::size(mTokens)))
+        {
+            co_return;
+        }
+
+        if (mIsIncremental && mIntermediateBuffer.isEmpty())
+        {
+            mCheckpoints.push_back({ mFiniteStateMachine.GetCurrentState(), std::size(mTokens), i });
+        }
+        
+        co_yield mInput.at(i);
+    }
+
+    if (mIsIncremental && mIntermediateBuffer.isEmpty())
+    {
+        mCheckpoints.push_back({ mFiniteStateMachine.GetCurrentState(), std::size(mTokens), mInput.size() });
+    }
+}
+
+Utils::InputGenerator<Tokenizer::Symbol> Tokenizer::StreamSequence(Utils::InputGenerator<Symbol> input_generator, const TokenSink& sink, std::size_t batch_size, 
+    bool& is_stopped, std::size_t& streamed_token_count)
+{
+    std::size_t symbol_count{};
+
+    // Tokens are handed over before a symbol, when the previous one has been fully processed.
+    while (input_generator.Next())
+    {
+        if (++symbol_count > mLimits.mMaxInputLength)
+        {
+            mLimitViolation = Utils::LimitViolation::InputLength;
+            co_return;
+        }
+
+        if (IsOverLimit(streamed_token_count + std::size(mTokens)))
+        {
+            co_return;
+        }
+
+        if (std::size(mTokens) >= batch_size)
+        {
+            if (!sink(mTokens))
+            {
+                is_stopped = true;
+                co_return;
+            }
+
+            streamed_token_count += std::size(mTokens);
+            DropTokens(0);
+        }
+
+        co_yield input_generator.GetValue();
+    }
+}
+
+bool Tokenizer::IsOverLimit(std::size_t token_count) noexcept
 {
-    for (const auto& ch : input)
+    if (token_count > mLimits.mMaxTokenCount)
+    {
+        mLimitViolation = Utils::LimitViolation::TokenCount;
+    }
+    else if (mLimits.IsPastDeadline(mDeadlineCountdown))
     {
-        co_yield ch;
+        mLimitViolation = Utils::LimitViolation::Deadline;
     }
+
+    return mLimitViolation != Utils::LimitViolation::None;
+}
+
+void Tokenizer::ResetLimitViolation() noexcept
+{
+    mLimitViolation = Utils::LimitViolation::None;
+    mDeadlineCountdown = mLimits.GetDeadlineCheckInterval();
+}
+
+void Tokenizer::ReportLimitViolation(std::size_t token_count)
+{
+    // The last tokens are only added by the End state, after the input.
+    if (mLimitViolation == Utils::LimitViolation::None && token_count > mLimits.mMaxTokenCount)
+    {
+        mLimitViolation = Utils::LimitViolation::TokenCount;
+    }
+
+    if (mLimitViolation == Utils::LimitViolation::None)
+    {
+        return;
+    }
+
+    // Whatever the FSM made of the cut input, the limit is the error. Update must not resume from a cut input either.
+    mErrorFlag = true;
+    mErrorMessage = Utils::DescribeLimitViolation(mLimitViolation, mLimits);
+    mCheckpoints.clear();
 }
 
 Utils::ResumableNoEncapsulation Tokenizer::InitState(FiniteStateMachine& finite_state_machine)
 {
     UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
 
-    auto transition_function = [](const auto& data) -> Tokenizer::State
+    auto transition_function = [this](const auto& data) -> Tokenizer::State
     {
         const auto ch_1b{ data.toLatin1() };
 
         const bool is_left_parenthesis{ Utils::EqualsAnyOf(ch_1b, '(') };
         const bool is_digit{ static_cast<bool>(std::isdigit(ch_1b)) };
+        const bool is_letter{ static_cast<bool>(std::isalpha(ch_1b)) || ch_1b == '_' };
 
         if (is_left_parenthesis)
         {
-            mTokens.emplace_back(data, Tokenizer::Token::LeftParenthesis);
+            PushSymbol(data, Tokenizer::Token::LeftParenthesis);
             return Tokenizer::State::LeftParenthesis;
         }
         else if (is_digit)
@@ -97,8 +374,15 @@ Utils::ResumableNoEncapsulation Tokenizer::InitState(FiniteStateMachine& finite_
 
             return Tokenizer::State::Digit;
         }
+        else if (is_letter)
+        {
+            mIntermediateToken = Tokenizer::Token::Identifier;
+            mIntermediateBuffer.push_back(data);
+
+            return Tokenizer::State::Identifier;
+        }
 
-        mErrorMessage = QStringLiteral("Expression must starts from left parenthesis or digit !!!");
+        mErrorMessage = QStringLiteral("Expression must starts from left parenthesis, digit or variable !!!");
         return Tokenizer::State::Error;
     };
 
@@ -112,17 +396,18 @@ Utils::ResumableNoEncapsulation Tokenizer::LeftParenthesis(FiniteStateMachine& f
 {
     UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
 
-    auto transition_function = [](const auto& data) -> Tokenizer::State
+    auto transition_function = [this](const auto& data) -> Tokenizer::State
     {
         const auto ch_1b{ data.toLatin1() };
 
         const bool is_unary_operator{ Utils::EqualsAnyOf(ch_1b, '-') };
         const bool is_digit{ static_cast<bool>(std::isdigit(ch_1b)) };
+        const bool is_letter{ static_cast<bool>(std::isalpha(ch_1b)) || ch_1b == '_' };
         const bool is_left_parenthesis{ Utils::EqualsAnyOf(ch_1b, '(') };
 
         if (is_unary_operator)
         {
-            mTokens.emplace_back(data, Tokenizer::Token::UnaryOperator);
+            PushSymbol(data, Tokenizer::Token::UnaryOperator);
             return Tokenizer::State::Unary;
         }
         else if (is_digit)
@@ -132,13 +417,20 @@ Utils::ResumableNoEncapsulation Tokenizer::LeftParenthesis(FiniteStateMachine& f
 
             return Tokenizer::State::Digit;
         }
+        else if (is_letter)
+        {
+            mIntermediateToken = Tokenizer::Token::Identifier;
+            mIntermediateBuffer.push_back(data);
+
+            return Tokenizer::State::Identifier;
+        }
         else if (is_left_parenthesis)
         {
-            mTokens.emplace_back(data, Tokenizer::Token::LeftParenthesis);
+            PushSymbol(data, Tokenizer::Token::LeftParenthesis);
             return Tokenizer::State::LeftParenthesis;
         }
 
-        mErrorMessage = QStringLiteral("After left parenthesis can be only unary operator or a digit !!!");
+        mErrorMessage = QStringLiteral("After left parenthesis can be only unary operator, digit or variable !!!");
         return Tokenizer::State::Error;
     };
 
@@ -152,25 +444,31 @@ Utils::ResumableNoEncapsulation Tokenizer::RightParenthesis(FiniteStateMachine&
 {
     UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
 
-    auto transition_function = [](const auto& data) -> Tokenizer::State
+    auto transition_function = [this](const auto& data) -> Tokenizer::State
     {
         const auto ch_1b{ data.toLatin1() };
         
         const bool is_operator{ Utils::EqualsAnyOf(ch_1b, '+', '-', '/', '*', '^') };
         const bool is_right_parenthesis{ Utils::EqualsAnyOf(ch_1b, ')') };
+        const bool is_separator{ Utils::EqualsAnyOf(ch_1b, ',') };
 
         if (is_operator)
         {
-            mTokens.emplace_back(data, Tokenizer::Token::Operator);
+            PushSymbol(data, Tokenizer::Token::Operator);
             return Tokenizer::State::Operator;
         }
         else if (is_right_parenthesis)
         {
-            mTokens.emplace_back(data, Tokenizer::Token::RightParenthesis);
+            PushSymbol(data, Tokenizer::Token::RightParenthesis);
             return Tokenizer::State::RightParenthesis;
         }
+        else if (is_separator)
+        {
+            PushSymbol(data, Tokenizer::Token::Separator);
+            return Tokenizer::State::Separator;
+        }
 
-        mErrorMessage = QStringLiteral("After right parenthesis can be only operator !!!");
+        mErrorMessage = QStringLiteral("After right parenthesis can be only operator or separator !!!");
         return Tokenizer::State::Error;
     };
 
@@ -184,10 +482,11 @@ Utils::ResumableNoEncapsulation Tokenizer::Unary(FiniteStateMachine& finite_stat
 {
     UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
 
-    auto transition_function = [](const auto& data) -> Tokenizer::State
+    auto transition_function = [this](const auto& data) -> Tokenizer::State
     {
         const auto ch_1b{ data.toLatin1() };
         const bool is_digit{ static_cast<bool>(std::isdigit(ch_1b)) };
+        const bool is_letter{ static_cast<bool>(std::isalpha(ch_1b)) || ch_1b == '_' };
         
         if (is_digit)
         {
@@ -196,8 +495,15 @@ Utils::ResumableNoEncapsulation Tokenizer::Unary(FiniteStateMachine& finite_stat
 
             return Tokenizer::State::Digit;
         }
+        else if (is_letter)
+        {
+            mIntermediateToken = Tokenizer::Token::Identifier;
+            mIntermediateBuffer.push_back(data);
+
+            return Tokenizer::State::Identifier;
+        }
 
-        mErrorMessage = QStringLiteral("After unary operator can be only digit !!!");
+        mErrorMessage = QStringLiteral("After unary operator can be only digit or variable !!!");
         return Tokenizer::State::Error;
     };
 
@@ -211,7 +517,7 @@ Utils::ResumableNoEncapsulation Tokenizer::Digit(FiniteStateMachine& finite_stat
 {
     UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
 
-    auto transition_function = [](const auto& data) -> Tokenizer::State 
+    auto transition_function = [this](const auto& data) -> Tokenizer::State 
     {
         const auto ch_1b{ data.toLatin1() };
 
@@ -219,6 +525,7 @@ Utils::ResumableNoEncapsulation Tokenizer::Digit(FiniteStateMachine& finite_stat
         const bool is_point{ Utils::EqualsAnyOf(ch_1b, '.') };
         const bool is_operator{ Utils::EqualsAnyOf(ch_1b, '+', '-', '/', '*', '^') };
         const bool is_right_parenthesis{ Utils::EqualsAnyOf(ch_1b, ')') };
+        const bool is_separator{ Utils::EqualsAnyOf(ch_1b, ',') };
 
         if (is_digit)
         {
@@ -234,22 +541,24 @@ Utils::ResumableNoEncapsulation Tokenizer::Digit(FiniteStateMachine& finite_stat
         }
         else if (is_operator)
         {
-            mTokens.emplace_back(mIntermediateBuffer, mIntermediateToken);
-            mIntermediateBuffer.clear();
-            
-            mTokens.emplace_back(data, Tokenizer::Token::Operator);
+            PushIntermediate(mIntermediateToken);
+            PushSymbol(data, Tokenizer::Token::Operator);
             return Tokenizer::State::Operator;
         }
         else if (is_right_parenthesis)
         {
-            mTokens.emplace_back(mIntermediateBuffer, mIntermediateToken);
-            mIntermediateBuffer.clear();
-
-            mTokens.emplace_back(data, Tokenizer::Token::RightParenthesis);
+            PushIntermediate(mIntermediateToken);
+            PushSymbol(data, Tokenizer::Token::RightParenthesis);
             return Tokenizer::State::RightParenthesis;
         }
+        else if (is_separator)
+        {
+            PushIntermediate(mIntermediateToken);
+            PushSymbol(data, Tokenizer::Token::Separator);
+            return Tokenizer::State::Separator;
+        }
 
-        mErrorMessage = QStringLiteral("After digit can be only point or operator !!!");
+        mErrorMessage = QStringLiteral("After digit can be only point, operator, separator or right parenthesis !!!");
         return Tokenizer::State::Error;
     };
 
@@ -263,13 +572,14 @@ Utils::ResumableNoEncapsulation Tokenizer::FloatingPoint(FiniteStateMachine& fin
 {
     UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
 
-    auto transition_function = [](const auto& data) -> Tokenizer::State
+    auto transition_function = [this](const auto& data) -> Tokenizer::State
     {
         const auto ch_1b{ data.toLatin1() };
         
         const bool is_digit{ static_cast<bool>(std::isdigit(ch_1b)) };
         const bool is_right_parenthesis{ Utils::EqualsAnyOf(ch_1b, ')') };
         const bool is_operator{ Utils::EqualsAnyOf(ch_1b, '+', '-', '/', '*', '^') };
+        const bool is_separator{ Utils::EqualsAnyOf(ch_1b, ',') };
     
         if (is_digit)
         {
@@ -278,22 +588,24 @@ Utils::ResumableNoEncapsulation Tokenizer::FloatingPoint(FiniteStateMachine& fin
         }
         else if (is_right_parenthesis)
         {
-            mTokens.emplace_back(mIntermediateBuffer, mIntermediateToken);
-            mIntermediateBuffer.clear();
-        
-            mTokens.emplace_back(data, Tokenizer::Token::RightParenthesis);
+            PushIntermediate(mIntermediateToken);
+            PushSymbol(data, Tokenizer::Token::RightParenthesis);
             return Tokenizer::State::RightParenthesis;
         }
         else if (is_operator)
         {
-            mTokens.emplace_back(mIntermediateBuffer, mIntermediateToken);
-            mIntermediateBuffer.clear();
-        
-            mTokens.emplace_back(data, Tokenizer::Token::Operator);
+            PushIntermediate(mIntermediateToken);
+            PushSymbol(data, Tokenizer::Token::Operator);
             return Tokenizer::State::Operator;            
         }
+        else if (is_separator)
+        {
+            PushIntermediate(mIntermediateToken);
+            PushSymbol(data, Tokenizer::Token::Separator);
+            return Tokenizer::State::Separator;
+        }
 
-        mErrorMessage = QStringLiteral("After floating point can be only digit, right parenthesis or operator !!!");
+        mErrorMessage = QStringLiteral("After floating point can be only digit, right parenthesis, separator or operator !!!");
         return Tokenizer::State::Error;
     };
 
@@ -307,7 +619,7 @@ Utils::ResumableNoEncapsulation Tokenizer::Point(FiniteStateMachine& finite_stat
 {
     UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
 
-    auto transition_function = [](const auto& data) -> Tokenizer::State
+    auto transition_function = [this](const auto& data) -> Tokenizer::State
     {
         const auto ch_1b{ data.toLatin1() };
         const bool is_digit{ static_cast<bool>(std::isdigit(ch_1b)) };
@@ -332,16 +644,17 @@ Utils::ResumableNoEncapsulation Tokenizer::Operator(FiniteStateMachine& finite_s
 {
     UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
 
-    auto transition_function = [](const auto& data) -> Tokenizer::State
+    auto transition_function = [this](const auto& data) -> Tokenizer::State
     {
         const auto ch_1b{ data.toLatin1() };
 
         const bool is_left_parenthesis{ Utils::EqualsAnyOf(ch_1b, '(') };
         const bool is_digit{ static_cast<bool>(std::isdigit(ch_1b)) };
+        const bool is_letter{ static_cast<bool>(std::isalpha(ch_1b)) || ch_1b == '_' };
 
         if (is_left_parenthesis)
         {
-            mTokens.emplace_back(data, Tokenizer::Token::LeftParenthesis);
+            PushSymbol(data, Tokenizer::Token::LeftParenthesis);
             return Tokenizer::State::LeftParenthesis;
         }
         else if (is_digit)
@@ -351,8 +664,118 @@ Utils::ResumableNoEncapsulation Tokenizer::Operator(FiniteStateMachine& finite_s
 
             return Tokenizer::State::Digit;
         }
+        else if (is_letter)
+        {
+            mIntermediateToken = Tokenizer::Token::Identifier;
+            mIntermediateBuffer.push_back(data);
+
+            return Tokenizer::State::Identifier;
+        }
 
-        mErrorMessage = QStringLiteral("After operator can be only digit or left parenthesis");
+        mErrorMessage = QStringLiteral("After operator can be only digit, variable or left parenthesis");
+        return Tokenizer::State::Error;
+    };
+
+    for (;;)
+    {
+        co_await finite_state_machine.GetConditionalAwaiter(std::move(transition_function));
+    }
+}
+
+Utils::ResumableNoEncapsulation Tokenizer::Identifier(FiniteStateMachine& finite_state_machine)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+
+    auto transition_function = [this](const auto& data) -> Tokenizer::State
+    {
+        const auto ch_1b{ data.toLatin1() };
+
+        const bool is_name_character{ static_cast<bool>(std::isalnum(ch_1b)) || ch_1b == '_' };
+        const bool is_operator{ Utils::EqualsAnyOf(ch_1b, '+', '-', '/', '*', '^') };
+        const bool is_right_parenthesis{ Utils::EqualsAnyOf(ch_1b, ')') };
+        const bool is_left_parenthesis{ Utils::EqualsAnyOf(ch_1b, '(') };
+        const bool is_separator{ Utils::EqualsAnyOf(ch_1b, ',') };
+
+        if (is_name_character)
+        {
+            mIntermediateBuffer.push_back(data);
+            return Tokenizer::State::Identifier;
+        }
+        else if (is_operator)
+        {
+            PushIntermediate(mIntermediateToken);
+            PushSymbol(data, Tokenizer::Token::Operator);
+            return Tokenizer::State::Operator;
+        }
+        else if (is_right_parenthesis)
+        {
+            PushIntermediate(mIntermediateToken);
+            PushSymbol(data, Tokenizer::Token::RightParenthesis);
+            return Tokenizer::State::RightParenthesis;
+        }
+        else if (is_left_parenthesis)
+        {
+            // A name followed by a parenthesis is a function call, the arguments are tokenized as usual.
+            PushIntermediate(Tokenizer::Token::Function);
+            PushSymbol(data, Tokenizer::Token::LeftParenthesis);
+            return Tokenizer::State::LeftParenthesis;
+        }
+        else if (is_separator)
+        {
+            PushIntermediate(mIntermediateToken);
+            PushSymbol(data, Tokenizer::Token::Separator);
+            return Tokenizer::State::Separator;
+        }
+
+        mErrorMessage = QStringLiteral("After variable can be only operator, separator or parenthesis");
+        return Tokenizer::State::Error;
+    };
+
+    for (;;)
+    {
+        co_await finite_state_machine.GetConditionalAwaiter(std::move(transition_function));
+    }
+}
+
+Utils::ResumableNoEncapsulation Tokenizer::Separator(FiniteStateMachine& finite_state_machine)
+{
+    UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
+
+    auto transition_function = [this](const auto& data) -> Tokenizer::State
+    {
+        const auto ch_1b{ data.toLatin1() };
+
+        const bool is_unary_operator{ Utils::EqualsAnyOf(ch_1b, '-') };
+        const bool is_digit{ static_cast<bool>(std::isdigit(ch_1b)) };
+        const bool is_letter{ static_cast<bool>(std::isalpha(ch_1b)) || ch_1b == '_' };
+        const bool is_left_parenthesis{ Utils::EqualsAnyOf(ch_1b, '(') };
+
+        if (is_unary_operator)
+        {
+            PushSymbol(data, Tokenizer::Token::UnaryOperator);
+            return Tokenizer::State::Unary;
+        }
+        else if (is_digit)
+        {
+            mIntermediateToken = Tokenizer::Token::Integer;
+            mIntermediateBuffer.push_back(data);
+
+            return Tokenizer::State::Digit;
+        }
+        else if (is_letter)
+        {
+            mIntermediateToken = Tokenizer::Token::Identifier;
+            mIntermediateBuffer.push_back(data);
+
+            return Tokenizer::State::Identifier;
+        }
+        else if (is_left_parenthesis)
+        {
+            PushSymbol(data, Tokenizer::Token::LeftParenthesis);
+            return Tokenizer::State::LeftParenthesis;
+        }
+
+        mErrorMessage = QStringLiteral("After separator can be only unary operator, digit, variable or left parenthesis !!!");
         return Tokenizer::State::Error;
     };
 
@@ -378,11 +801,11 @@ Utils::ResumableNoEncapsulation Tokenizer::End(FiniteStateMachine& finite_state_
     UT_CC_DEFAULT_LOGGER_INFO(__PRETTY_FUNCTION__);
 
     const auto previous_state{ finite_state_machine.GetPreviousState() };
-    if (!Utils::EqualsAnyOf(previous_state, Tokenizer::State::Digit, Tokenizer::State::FloatingPoint, Tokenizer::State::RightParenthesis))
+    if (!Utils::EqualsAnyOf(previous_state, Tokenizer::State::Digit, Tokenizer::State::FloatingPoint, Tokenizer::State::Identifier, Tokenizer::State::RightParenthesis))
     {
-        auto error_func = []() -> Tokenizer::State 
+        auto error_func = [this]() -> Tokenizer::State 
         {
-            mErrorMessage = QStringLiteral("Expression should ends only on digit or right parenthesis");
+            mErrorMessage = QStringLiteral("Expression should ends only on digit, variable or right parenthesis");
             return Tokenizer::State::Error;
         };
         
@@ -391,19 +814,63 @@ Utils::ResumableNoEncapsulation Tokenizer::End(FiniteStateMachine& finite_state_
 
     if (!mIntermediateBuffer.isEmpty())
     {
-        mTokens.emplace_back(mIntermediateBuffer, mIntermediateToken);
+        PushIntermediate(mIntermediateToken);
     }
 
     co_return;
 }
 
+void Tokenizer::PushSymbol(Symbol symbol, Token token)
+{
+    // Copies of a literal share its static data, so symbol tokens never allocate.
+    static const std::array kLexemes{ 
+        QStringLiteral("("), QStringLiteral(")"), QStringLiteral("+"), QStringLiteral("-"), 
+        QStringLiteral("*"), QStringLiteral("/"), QStringLiteral("^"), QStringLiteral(",")
+    };
+    constexpr std::u16string_view kSymbols{ u"()+-*/^," };
+
+    const auto index{ kSymbols.find(symbol.unicode()) };
+    mTokens.emplace_back(index != std::u16string_view::npos ? kLexemes[index] : QString{ symbol }, token);
+}
+
+void Tokenizer::PushIntermediate(Token token)
+{
+    mTokens.emplace_back(std::move(mIntermediateBuffer), token);
+    mIntermediateBuffer = QString{};
+
+    // The next lexeme is collected in the storage of a dropped one, which still has its capacity.
+    if (!std::empty(mSpareLexemes))
+    {
+        mIntermediateBuffer = std::move(mSpareLexemes.back());
+        mIntermediateBuffer.resize(0);
+
+        mSpareLexemes.pop_back();
+    }
+}
+
+void Tokenizer::DropTokens(std::size_t token_count)
+{
+    for (auto& token_pair : std::span{ mTokens }.subspan(token_count))
+    {
+        if (!Utils::EqualsAnyOf(token_pair.mToken, Tokenizer::Token::Integer, Tokenizer::Token::FloatingPoint, Tokenizer::Token::Identifier, Tokenizer::Token::Function))
+        {
+            continue;
+        }
+
+        mSpareLexemes.push_back(std::move(token_pair.mLexeme));
+    }
+
+    mTokens.erase(std::begin(mTokens) + static_cast<std::ptrdiff_t>(token_count), std::end(mTokens));
+}
+
 inline void Tokenizer::Clear()
 {
     mErrorFlag = false;
     mErrorMessage.clear();
 
-    mIntermediateBuffer.clear();
+    mIntermediateBuffer.resize(0);
     mIntermediateToken = Tokenizer::Token::Integer;
 
-    mTokens.clear();
+    DropTokens(0);
+    mFirstChangedToken = 0;
 }
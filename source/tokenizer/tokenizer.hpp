@@ -23,15 +23,21 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <vector>
+#include <algorithm>
+#include <functional>
 
 #include <QString>
+#include <QStringView>
 
+#include <frame-cache.hpp>
 #include <finite-state-machine.hpp>
 #include <resumable-no-encapsulation.hpp>
 
 #include <logger.hpp>
 #include <custom-predicates.hpp>
+#include <resource-limits.hpp>
 
 class Tokenizer
 {
@@ -49,6 +55,8 @@ public:
         FloatingPoint,
         Point, 
         Operator,
+        Identifier,
+        Separator,
         Error,
         End
     };
@@ -61,48 +69,149 @@ public:
         RightParenthesis,
         UnaryOperator,
         Operator,
+        Identifier,
+        Function,
+        Separator,
     };
     
     using Symbol = QChar;
-    using TokenPair = std::pair<QString, Token>;
+
+    // Numeric literals are parsed once, when the token is created, so evaluators never convert the lexeme.
+    struct TokenPair
+    {
+        TokenPair(QString lexeme, Token token);
+
+        // The value is derived from the lexeme, so it takes no part in the comparison.
+        [[nodiscard]] bool operator==(const TokenPair& other) const noexcept;
+
+        QString mLexeme;
+        Token mToken;
+        double mValue;
+    };
+
     using FiniteStateMachine = Utils::FiniteStateMachine<State, Symbol>;
 
+    // Receives the tokens of the streaming Run, false stops the input.
+    using TokenSink = std::function<bool(std::span<const TokenPair> tokens)>;
+
+    static constexpr std::size_t kDefaultStreamBatchSize{ 4096 };
+
 public:
     Tokenizer();
     ~Tokenizer() noexcept = default;
 
+    // State coroutines keep a pointer to the tokenizer, so it must stay in place.
+    Tokenizer(const Tokenizer&) = delete;
+    Tokenizer& operator=(const Tokenizer&) = delete;
+
     void Init(const QString& input);
     void Run();
 
+    // Streaming mode: tokenizes the symbols of input_generator, e.g. one of Utils::InputSources, without keeping 
+    // the input. Tokens go to sink in order, in batches of batch_size, and are dropped from GetTokens afterwards, 
+    // so memory is bounded by the batch and the longest lexeme whatever the length of the input. Batches before an 
+    // error may have been handed over already. A sink returning false ends tokenization with an error.
+    void Run(Utils::InputGenerator<Symbol> input_generator, TokenSink sink, std::size_t batch_size = kDefaultStreamBatchSize);
+
+    // Re-tokenizes only the part of the input which differs from the previous one, in incremental mode.
+    // Tokens and the FSM state are restored from the last token boundary within the common prefix, 
+    // so appending or deleting at the tail costs O(edit) instead of O(expression). Otherwise the same as Init and Run.
+    void Update(const QString& input);
+
+    // Off by default, then no checkpoints are recorded. Used from the next Init, Update or Run on.
+    void SetIncremental(bool is_enabled) noexcept;
+    [[nodiscard]] bool IsIncremental() const noexcept;
+
     [[nodiscard]] const std::vector<TokenPair>& GetTokens() const noexcept;
+
+    // Tokens before this index are unchanged since the previous Run/Update.
+    [[nodiscard]] std::size_t GetFirstChangedToken() const noexcept;
     
     [[nodiscard]] bool HasError() const noexcept;
     [[nodiscard]] const QString& GetErrorMessage() const noexcept;
 
+    // Input length, token count and deadline, unlimited by default. Used from the next Init, Update or Run on.
+    void SetLimits(const Utils::ResourceLimits& limits) noexcept;
+    [[nodiscard]] const Utils::ResourceLimits& GetLimits() const noexcept;
+
+    // The limit which ended the last tokenization with an error, if any.
+    [[nodiscard]] Utils::LimitViolation GetLimitViolation() const noexcept;
+
+    // Expects digits with an optional fractional part, as accepted by the FSM. Exact, locale independent.
+    [[nodiscard]] static double ParseNumber(QStringView lexeme) noexcept;
+
+private:
+    // Tokenizer state at a token boundary, right before the character at mPosition is consumed.
+    // No lexeme is pending there, so the state and the tokens are all there is to restore.
+    struct Checkpoint
+    {
+        State mState;
+        std::size_t mTokenCount;
+        qsizetype mPosition;
+    };
+
 private:
-    static Utils::InputGenerator<Symbol> InputSequence(const QString& input);
+    Utils::InputGenerator<Symbol> InputSequence(qsizetype begin);
+    Utils::InputGenerator<Symbol> StreamSequence(Utils::InputGenerator<Symbol> input_generator, const TokenSink& sink, std::size_t batch_size, 
+        bool& is_stopped, std::size_t& streamed_token_count);
+
+    // Checked before every symbol, true ends the input.
+    [[nodiscard]] bool IsOverLimit(std::size_t token_count) noexcept;
+
+    void ResetLimitViolation() noexcept;
+    void ReportLimitViolation(std::size_t token_count);
+
+    // Fresh state coroutines reading from input_generator.
+    void Start(Utils::InputGenerator<Symbol> input_generator);
 
-    static Utils::ResumableNoEncapsulation InitState(FiniteStateMachine& finite_state_machine);
-    static Utils::ResumableNoEncapsulation LeftParenthesis(FiniteStateMachine& finite_state_machine);
-    static Utils::ResumableNoEncapsulation RightParenthesis(FiniteStateMachine& finite_state_machine);
-    static Utils::ResumableNoEncapsulation Unary(FiniteStateMachine& finite_state_machine);
-    static Utils::ResumableNoEncapsulation Digit(FiniteStateMachine& finite_state_machine);
-    static Utils::ResumableNoEncapsulation FloatingPoint(FiniteStateMachine& finite_state_machine);
-    static Utils::ResumableNoEncapsulation Point(FiniteStateMachine& finite_state_machine);
-    static Utils::ResumableNoEncapsulation Operator(FiniteStateMachine& finite_state_machine);
-    static Utils::ResumableNoEncapsulation Error(FiniteStateMachine& finite_state_machine);
-    static Utils::ResumableNoEncapsulation End(FiniteStateMachine& finite_state_machine);
+    Utils::ResumableNoEncapsulation InitState(FiniteStateMachine& finite_state_machine);
+    Utils::ResumableNoEncapsulation LeftParenthesis(FiniteStateMachine& finite_state_machine);
+    Utils::ResumableNoEncapsulation RightParenthesis(FiniteStateMachine& finite_state_machine);
+    Utils::ResumableNoEncapsulation Unary(FiniteStateMachine& finite_state_machine);
+    Utils::ResumableNoEncapsulation Digit(FiniteStateMachine& finite_state_machine);
+    Utils::ResumableNoEncapsulation FloatingPoint(FiniteStateMachine& finite_state_machine);
+    Utils::ResumableNoEncapsulation Point(FiniteStateMachine& finite_state_machine);
+    Utils::ResumableNoEncapsulation Operator(FiniteStateMachine& finite_state_machine);
+    Utils::ResumableNoEncapsulation Identifier(FiniteStateMachine& finite_state_machine);
+    Utils::ResumableNoEncapsulation Separator(FiniteStateMachine& finite_state_machine);
+    Utils::ResumableNoEncapsulation Error(FiniteStateMachine& finite_state_machine);
+    Utils::ResumableNoEncapsulation End(FiniteStateMachine& finite_state_machine);
 
-    static inline void Clear();
+    void PushSymbol(Symbol symbol, Token token);
+
+    // Moves the intermediate buffer into a token of this type and starts the next lexeme.
+    void PushIntermediate(Token token);
+
+    // Drops the tokens from token_count on, keeping the storage of their lexemes for the next ones.
+    void DropTokens(std::size_t token_count);
+
+    inline void Clear();
+
+    // State coroutines and input sequences are created anew on every Init, their frames come from mFrameCache.
+    friend Utils::FrameCache* GetFrameCache(Tokenizer& tokenizer) noexcept { return &tokenizer.mFrameCache; }
 
 private:
-    static QString mIntermediateBuffer;
-    static Token mIntermediateToken;
+    QString mIntermediateBuffer;
+    Token mIntermediateToken;
     
-    static std::vector<TokenPair> mTokens;
+    std::vector<TokenPair> mTokens;
+    std::size_t mFirstChangedToken;
 
-    static QString mErrorMessage;
-    static bool mErrorFlag; 
+    // Lexemes of dropped numbers and identifiers. One a caller still holds a copy of is detached when reused.
+    std::vector<QString> mSpareLexemes;
+
+    QString mErrorMessage;
+    bool mErrorFlag; 
     
+    QString mInput;
+    std::vector<Checkpoint> mCheckpoints;
+    bool mIsIncremental;
+
+    Utils::ResourceLimits mLimits;
+    Utils::LimitViolation mLimitViolation;
+    std::uint32_t mDeadlineCountdown;
+
+    // Declared before the machine, which owns the coroutines, so it outlives them.
+    Utils::FrameCache mFrameCache;
     FiniteStateMachine mFiniteStateMachine;
 };
\ No newline at end of file
@@ -0,0 +1,792 @@
+// MIT License
+//
+// Copyright (c) 2025 @Who
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "decimal.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+namespace Utils
+{
+    namespace
+    {
+        using Limb = Decimal::Limb;
+        using Limbs = Decimal::Limbs;
+
+        constexpr std::uint64_t kBase{ Decimal::kLimbBase };
+
+        // After a carry pass every column is below kBase, so 16 more rows of products fit in 64 bits.
+        constexpr std::size_t kCarryInterval{ 16 };
+
+        constexpr auto kPowersOfTen = []()
+        {
+            std::array<std::uint64_t, 20> powers{};
+            powers[0] = 1;
+
+            for (std::size_t i{ 1 }; i < std::size(powers); ++i)
+            {
+                powers[i] = powers[i - 1] * 10;
+            }
+
+            return powers;
+        }();
+
+        [[nodiscard]] std::uint64_t UnsignedAbs(std::int64_t value) noexcept
+        {
+            return value < 0 ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+        }
+
+        // Multiplies by 10^digits, false on overflow.
+        [[nodiscard]] bool ScaleSmall(std::int64_t& coefficient, std::int32_t digits) noexcept
+        {
+            if (digits == 0 || coefficient == 0)
+            {
+                return true;
+            }
+
+            if (digits >= std::ssize(kPowersOfTen))
+            {
+                return false;
+            }
+
+            std::int64_t scaled{};
+            if (__builtin_mul_overflow(coefficient, kPowersOfTen[static_cast<std::size_t>(digits)], &scaled))
+            {
+                return false;
+            }
+
+            coefficient = scaled;
+            return true;
+        }
+
+        void Trim(Limbs& limbs)
+        {
+            while (!std::empty(limbs) && limbs.back() == 0)
+            {
+                limbs.pop_back();
+            }
+        }
+
+        [[nodiscard]] Limbs ToLimbs(std::uint64_t value)
+        {
+            Limbs limbs{};
+            while (value != 0)
+            {
+                limbs.push_back(static_cast<Limb>(value % kBase));
+                value /= kBase;
+            }
+
+            return limbs;
+        }
+
+        [[nodiscard]] std::int32_t CompareMagnitude(const Limbs& lhs, const Limbs& rhs) noexcept
+        {
+            if (std::size(lhs) != std::size(rhs))
+            {
+                return std::size(lhs) < std::size(rhs) ? -1 : 1;
+            }
+
+            for (auto i{ std::size(lhs) }; i-- > 0;)
+            {
+                if (lhs[i] != rhs[i])
+                {
+                    return lhs[i] < rhs[i] ? -1 : 1;
+                }
+            }
+
+            return 0;
+        }
+
+        [[nodiscard]] Limbs AddMagnitude(const Limbs& lhs, const Limbs& rhs)
+        {
+            const auto& longer{ std::size(lhs) >= std::size(rhs) ? lhs : rhs };
+            const auto& shorter{ std::size(lhs) >= std::size(rhs) ? rhs : lhs };
+
+            Limbs sum(std::size(longer) + 1, 0);
+
+            // Lane-wise sums stay below 2 * 10^9 and still fit in a limb.
+            for (std::size_t i{}; i < std::size(shorter); ++i)
+            {
+                sum[i] = longer[i] + shorter[i];
+            }
+
+            std::copy(std::begin(longer) + std::ssize(shorter), std::end(longer), std::begin(sum) + std::ssize(shorter));
+
+            Limb carry{};
+            for (auto& limb : sum)
+            {
+                const auto value{ limb + carry };
+                carry = value >= kBase ? 1 : 0;
+                limb = carry != 0 ? value - static_cast<Limb>(kBase) : value;
+            }
+
+            Trim(sum);
+            return sum;
+        }
+
+        // Requires lhs >= rhs.
+        [[nodiscard]] Limbs SubtractMagnitude(const Limbs& lhs, const Limbs& rhs)
+        {
+            Limbs difference(std::size(lhs), 0);
+
+            // Every lane is biased by kBase so it never goes negative, the borrow pass removes the bias.
+            for (std::size_t i{}; i < std::size(rhs); ++i)
+            {
+                difference[i] = lhs[i] + static_cast<Limb>(kBase) - rhs[i];
+            }
+
+            for (auto i{ std::size(rhs) }; i < std::size(lhs); ++i)
+            {
+                difference[i] = lhs[i] + static_cast<Limb>(kBase);
+            }
+
+            Limb borrow{};
+            for (auto& limb : difference)
+            {
+                const auto value{ limb - borrow };
+                borrow = value >= kBase ? 0 : 1;
+                limb = borrow == 0 ? value - static_cast<Limb>(kBase) : value;
+            }
+
+            Trim(difference);
+            return difference;
+        }
+
+        void PropagateCarries(std::vector<std::uint64_t>& columns)
+        {
+            std::uint64_t carry{};
+            for (auto& column : columns)
+            {
+                const auto value{ column + carry };
+                column = value % kBase;
+                carry = value / kBase;
+            }
+        }
+
+        [[nodiscard]] Limbs MultiplyMagnitude(const Limbs& lhs, const Limbs& rhs)
+        {
+            if (std::empty(lhs) || std::empty(rhs))
+            {
+                return {};
+            }
+
+            std::vector<std::uint64_t> columns(std::size(lhs) + std::size(rhs), 0);
+
+            for (std::size_t i{}; i < std::size(lhs); ++i)
+            {
+                const std::uint64_t multiplier{ lhs[i] };
+                auto* row{ std::data(columns) + i };
+
+                // No carries in the inner loop, it is a plain multiply-accumulate over lanes.
+                for (std::size_t j{}; j < std::size(rhs); ++j)
+                {
+                    row[j] += multiplier * rhs[j];
+                }
+
+                if ((i + 1) % kCarryInterval == 0)
+                {
+                    PropagateCarries(columns);
+                }
+            }
+
+            PropagateCarries(columns);
+
+            Limbs product(std::begin(columns), std::end(columns));
+            Trim(product);
+
+            return product;
+        }
+
+        void MultiplySmall(Limbs& limbs, Limb factor)
+        {
+            std::uint64_t carry{};
+            for (auto& limb : limbs)
+            {
+                const auto value{ static_cast<std::uint64_t>(limb) * factor + carry };
+                limb = static_cast<Limb>(value % kBase);
+                carry = value / kBase;
+            }
+
+            if (carry != 0)
+            {
+                limbs.push_back(static_cast<Limb>(carry));
+            }
+        }
+
+        // Returns the remainder.
+        Limb DivideSmall(Limbs& limbs, Limb divisor)
+        {
+            std::uint64_t remainder{};
+            for (auto i{ std::size(limbs) }; i-- > 0;)
+            {
+                const auto value{ remainder * kBase + limbs[i] };
+                limbs[i] = static_cast<Limb>(value / divisor);
+                remainder = value % divisor;
+            }
+
+            Trim(limbs);
+            return static_cast<Limb>(remainder);
+        }
+
+        void ScaleUp(Limbs& limbs, std::int32_t digits)
+        {
+            if (std::empty(limbs) || digits <= 0)
+            {
+                return;
+            }
+
+            // Whole limbs are a plain shift in base 10^9.
+            limbs.insert(std::begin(limbs), static_cast<std::size_t>(digits / Decimal::kLimbDigits), 0);
+            MultiplySmall(limbs, static_cast<Limb>(kPowersOfTen[static_cast<std::size_t>(digits % Decimal::kLimbDigits)]));
+        }
+
+        // Knuth's algorithm D in base 10^9, returns quotient and remainder.
+        [[nodiscard]] std::pair<Limbs, Limbs> DivideMagnitude(const Limbs& dividend, const Limbs& divisor)
+        {
+            if (CompareMagnitude(dividend, divisor) < 0)
+            {
+                return { Limbs{}, dividend };
+            }
+
+            if (std::size(divisor) == 1)
+            {
+                auto quotient{ dividend };
+                const auto remainder{ DivideSmall(quotient, divisor[0]) };
+
+                return { std::move(quotient), ToLimbs(remainder) };
+            }
+
+            // Normalization makes the top divisor limb at least kBase / 2, so the quotient estimate is off by at most 2.
+            const auto normalizer{ static_cast<Limb>(kBase / (divisor.back() + 1ULL)) };
+
+            auto u{ dividend };
+            MultiplySmall(u, normalizer);
+            u.resize(std::size(dividend) + 1, 0);
+
+            auto v{ divisor };
+            MultiplySmall(v, normalizer);
+
+            const auto n{ std::size(v) };
+            const auto m{ std::size(u) - n - 1 };
+
+            Limbs quotient(m + 1, 0);
+
+            for (auto j{ m + 1 }; j-- > 0;)
+            {
+                const auto numerator{ static_cast<std::uint64_t>(u[j + n]) * kBase + u[j + n - 1] };
+                auto estimate{ numerator / v[n - 1] };
+                auto estimate_remainder{ numerator % v[n - 1] };
+
+                while (estimate >= kBase || estimate * v[n - 2] > estimate_remainder * kBase + u[j + n - 2])
+                {
+                    --estimate;
+                    estimate_remainder += v[n - 1];
+
+                    if (estimate_remainder >= kBase) { break; }
+                }
+
+                std::int64_t borrow{};
+                for (std::size_t i{}; i < n; ++i)
+                {
+                    const auto product{ estimate * v[i] };
+                    const auto value{ static_cast<std::int64_t>(u[i + j]) - borrow - static_cast<std::int64_t>(product % kBase) };
+
+                    const auto floor_quotient{ value >= 0 ? 0 : -((-value + static_cast<std::int64_t>(kBase) - 1) / static_cast<std::int64_t>(kBase)) };
+
+                    u[i + j] = static_cast<Limb>(value - floor_quotient * static_cast<std::int64_t>(kBase));
+                    borrow = static_cast<std::int64_t>(product / kBase) - floor_quotient;
+                }
+
+                const auto top{ static_cast<std::int64_t>(u[j + n]) - borrow };
+                u[j + n] = 0;
+
+                if (top < 0)
+                {
+                    // The estimate was one too large, add the divisor back.
+                    --estimate;
+
+                    Limb carry{};
+                    for (std::size_t i{}; i < n; ++i)
+                    {
+                        const auto value{ u[i + j] + v[i] + carry };
+                        carry = value >= kBase ? 1 : 0;
+                        u[i + j] = carry != 0 ? value - static_cast<Limb>(kBase) : value;
+                    }
+                }
+
+                quotient[j] = static_cast<Limb>(estimate);
+            }
+
+            Trim(quotient);
+
+            u.resize(n);
+            Trim(u);
+            DivideSmall(u, normalizer);
+
+            return { std::move(quotient), std::move(u) };
+        }
+    }
+
+    Decimal::Decimal() noexcept :
+        mSmall{}, mScale{}, mNegative{}, mLimbs{}
+    { }
+
+    Decimal::Decimal(std::int64_t coefficient, std::int32_t scale) noexcept :
+        mSmall{ coefficient }, mScale{ scale }, mNegative{}, mLimbs{}
+    { }
+
+    Decimal Decimal::FromString(std::string_view text)
+    {
+        return Parse(text);
+    }
+
+    Decimal Decimal::FromString(std::u16string_view text)
+    {
+        return Parse(text);
+    }
+
+    template <typename TChar>
+    Decimal Decimal::Parse(std::basic_string_view<TChar> text)
+    {
+        constexpr TChar kPoint{ '.' };
+        constexpr TChar kZero{ '0' };
+
+        const auto point{ text.find(kPoint) };
+        const auto has_point{ point != std::basic_string_view<TChar>::npos };
+
+        const auto digit_count{ std::size(text) - (has_point ? 1 : 0) };
+        const auto scale{ has_point ? static_cast<std::int32_t>(std::size(text) - point - 1) : 0 };
+
+        // Up to 18 digits always fit the inline coefficient.
+        if (digit_count <= 18)
+        {
+            std::int64_t coefficient{};
+            for (const auto ch : text)
+            {
+                if (ch != kPoint)
+                {
+                    coefficient = coefficient * 10 + (ch - kZero);
+                }
+            }
+
+            return Decimal{ coefficient, scale };
+        }
+
+        Wide wide{ false, {}, scale };
+        wide.mMagnitude.reserve(digit_count / kLimbDigits + 1);
+
+        // From the least significant digit on, kLimbDigits digits per limb.
+        Limb limb{};
+        Limb power{ 1 };
+
+        for (auto i{ std::size(text) }; i-- > 0;)
+        {
+            if (text[i] == kPoint)
+            {
+                continue;
+            }
+
+            limb += static_cast<Limb>(text[i] - kZero) * power;
+            power *= 10;
+
+            if (power == kLimbBase)
+            {
+                wide.mMagnitude.push_back(limb);
+                limb = 0;
+                power = 1;
+            }
+        }
+
+        if (power != 1)
+        {
+            wide.mMagnitude.push_back(limb);
+        }
+
+        return FromWide(std::move(wide));
+    }
+
+    std::string Decimal::ToString() const
+    {
+        const auto wide{ ToWide() };
+
+        std::string digits{};
+        if (std::empty(wide.mMagnitude))
+        {
+            digits = "0";
+        }
+        else
+        {
+            digits = std::to_string(wide.mMagnitude.back());
+
+            for (auto i{ std::size(wide.mMagnitude) - 1 }; i-- > 0;)
+            {
+                const auto limb{ std::to_string(wide.mMagnitude[i]) };
+
+                digits.append(static_cast<std::size_t>(kLimbDigits) - std::size(limb), '0');
+                digits.append(limb);
+            }
+        }
+
+        if (wide.mScale > 0)
+        {
+            const auto scale{ static_cast<std::size_t>(wide.mScale) };
+            if (std::size(digits) <= scale)
+            {
+                digits.insert(0, scale - std::size(digits) + 1, '0');
+            }
+
+            digits.insert(std::size(digits) - scale, 1, '.');
+
+            while (digits.back() == '0') { digits.pop_back(); }
+            if (digits.back() == '.') { digits.pop_back(); }
+        }
+
+        if (wide.mNegative && digits != "0")
+        {
+            digits.insert(0, 1, '-');
+        }
+
+        return digits;
+    }
+
+    double Decimal::ToDouble() const
+    {
+        return std::strtod(ToString().c_str(), nullptr);
+    }
+
+    bool Decimal::IsSmall() const noexcept { return std::empty(mLimbs); }
+    bool Decimal::IsZero() const noexcept { return IsSmall() && mSmall == 0; }
+    std::int32_t Decimal::GetScale() const noexcept { return mScale; }
+
+    bool Decimal::IsInteger() const
+    {
+        return StripTrailingZeros(Decimal{ *this }).GetScale() == 0;
+    }
+
+    Decimal Decimal::operator-() const
+    {
+        if (IsSmall() && mSmall != std::numeric_limits<std::int64_t>::min())
+        {
+            return Decimal{ -mSmall, mScale };
+        }
+
+        auto wide{ ToWide() };
+        wide.mNegative = !wide.mNegative;
+
+        return FromWide(std::move(wide));
+    }
+
+    Decimal operator+(const Decimal& lhs, const Decimal& rhs)
+    {
+        if (lhs.IsSmall() && rhs.IsSmall())
+        {
+            const auto scale{ std::max(lhs.mScale, rhs.mScale) };
+
+            auto first{ lhs.mSmall };
+            auto second{ rhs.mSmall };
+            std::int64_t sum{};
+
+            if (ScaleSmall(first, scale - lhs.mScale) && ScaleSmall(second, scale - rhs.mScale) &&
+                !__builtin_add_overflow(first, second, &sum))
+            {
+                return Decimal{ sum, scale };
+            }
+        }
+
+        return Decimal::AddWide(lhs.ToWide(), rhs.ToWide());
+    }
+
+    Decimal operator-(const Decimal& lhs, const Decimal& rhs)
+    {
+        if (lhs.IsSmall() && rhs.IsSmall())
+        {
+            const auto scale{ std::max(lhs.mScale, rhs.mScale) };
+
+            auto first{ lhs.mSmall };
+            auto second{ rhs.mSmall };
+            std::int64_t difference{};
+
+            if (ScaleSmall(first, scale - lhs.mScale) && ScaleSmall(second, scale - rhs.mScale) &&
+                !__builtin_sub_overflow(first, second, &difference))
+            {
+                return Decimal{ difference, scale };
+            }
+        }
+
+        auto negated{ rhs.ToWide() };
+        negated.mNegative = !negated.mNegative;
+
+        return Decimal::AddWide(lhs.ToWide(), std::move(negated));
+    }
+
+    Decimal operator*(const Decimal& lhs, const Decimal& rhs)
+    {
+        if (lhs.IsSmall() && rhs.IsSmall())
+        {
+            std::int64_t product{};
+            if (!__builtin_mul_overflow(lhs.mSmall, rhs.mSmall, &product))
+            {
+                return Decimal{ product, lhs.mScale + rhs.mScale };
+            }
+        }
+
+        const auto first{ lhs.ToWide() };
+        const auto second{ rhs.ToWide() };
+
+        return Decimal::FromWide({
+            first.mNegative != second.mNegative,
+            MultiplyMagnitude(first.mMagnitude, second.mMagnitude),
+            first.mScale + second.mScale
+        });
+    }
+
+    std::optional<Decimal> Decimal::Divide(const Decimal& dividend, const Decimal& divisor)
+    {
+        if (divisor.IsZero())
+        {
+            return std::nullopt;
+        }
+
+        // Quotient coefficient: round(|dividend coefficient| * 10^exponent / |divisor coefficient|).
+        const auto scale{ std::max(kDivisionScale, dividend.mScale) };
+        const auto exponent{ scale - dividend.mScale + divisor.mScale };
+
+        const bool is_negative{ (dividend.IsSmall() ? dividend.mSmall < 0 : dividend.mNegative) !=
+                                (divisor.IsSmall() ? divisor.mSmall < 0 : divisor.mNegative) };
+
+        if (dividend.IsSmall() && divisor.IsSmall() && exponent < std::ssize(kPowersOfTen))
+        {
+            using Uint128 = unsigned __int128;
+
+            const Uint128 numerator{ static_cast<Uint128>(UnsignedAbs(dividend.mSmall)) * kPowersOfTen[static_cast<std::size_t>(exponent)] };
+            const Uint128 denominator{ UnsignedAbs(divisor.mSmall) };
+
+            auto quotient{ numerator / denominator };
+            const auto remainder{ numerator % denominator };
+
+            if (remainder * 2 > denominator || (remainder * 2 == denominator && (quotient & 1) != 0))
+            {
+                ++quotient;
+            }
+
+            if (quotient <= static_cast<Uint128>(std::numeric_limits<std::int64_t>::max()))
+            {
+                const auto coefficient{ static_cast<std::int64_t>(quotient) };
+                return StripTrailingZeros(Decimal{ is_negative ? -coefficient : coefficient, scale });
+            }
+        }
+
+        auto numerator{ dividend.ToWide() };
+        const auto denominator{ divisor.ToWide() };
+
+        ScaleUp(numerator.mMagnitude, exponent);
+
+        auto [quotient, remainder]{ DivideMagnitude(numerator.mMagnitude, denominator.mMagnitude) };
+
+        const auto twice_remainder{ AddMagnitude(remainder, remainder) };
+        const auto comparison{ CompareMagnitude(twice_remainder, denominator.mMagnitude) };
+
+        if (comparison > 0 || (comparison == 0 && !std::empty(quotient) && quotient[0] % 2 != 0))
+        {
+            quotient = AddMagnitude(quotient, Limbs{ 1 });
+        }
+
+        return StripTrailingZeros(FromWide({ is_negative, std::move(quotient), scale }));
+    }
+
+    std::optional<Decimal> Decimal::Pow(const Decimal& base, const Decimal& exponent)
+    {
+        const auto integer_exponent{ ToPowerExponent(exponent) };
+        if (!integer_exponent || IsPowerTooLong(base, exponent))
+        {
+            return std::nullopt;
+        }
+
+        auto remaining{ UnsignedAbs(*integer_exponent) };
+
+        Decimal result{ 1 };
+        Decimal factor{ base };
+
+        // Exponentiation by squaring.
+        while (remaining != 0)
+        {
+            if ((remaining & 1) != 0)
+            {
+                result = result * factor;
+            }
+
+            remaining >>= 1;
+            if (remaining != 0)
+            {
+                factor = factor * factor;
+            }
+        }
+
+        if (*integer_exponent < 0)
+        {
+            return Divide(Decimal{ 1 }, result);
+        }
+
+        return result;
+    }
+
+    bool Decimal::IsPowerTooLong(const Decimal& base, const Decimal& exponent)
+    {
+        // An exponent Pow rejects anyway builds nothing.
+        const auto integer_exponent{ ToPowerExponent(exponent) };
+        if (!integer_exponent)
+        {
+            return false;
+        }
+
+        return static_cast<std::int64_t>(UnsignedAbs(*integer_exponent)) * base.CountDigits() > kMaxPowerDigits;
+    }
+
+    std::optional<std::int64_t> Decimal::ToPowerExponent(const Decimal& exponent)
+    {
+        const auto integer_exponent{ StripTrailingZeros(Decimal{ exponent }) };
+
+        if (integer_exponent.GetScale() != 0 || !integer_exponent.IsSmall() ||
+            integer_exponent.mSmall > kMaxExponent || integer_exponent.mSmall < -kMaxExponent)
+        {
+            return std::nullopt;
+        }
+
+        return integer_exponent.mSmall;
+    }
+
+    std::int64_t Decimal::CountDigits() const noexcept
+    {
+        const auto count_digits = [](std::uint64_t value) noexcept
+        {
+            std::int64_t digits{ 1 };
+            while (digits < std::ssize(kPowersOfTen) && value >= kPowersOfTen[static_cast<std::size_t>(digits)])
+            {
+                ++digits;
+            }
+
+            return digits;
+        };
+
+        if (IsSmall())
+        {
+            return count_digits(UnsignedAbs(mSmall));
+        }
+
+        return static_cast<std::int64_t>(std::size(mLimbs) - 1) * kLimbDigits + count_digits(mLimbs.back());
+    }
+
+    Decimal::Wide Decimal::ToWide() const
+    {
+        if (IsSmall())
+        {
+            return { mSmall < 0, ToLimbs(UnsignedAbs(mSmall)), mScale };
+        }
+
+        return { mNegative, mLimbs, mScale };
+    }
+
+    Decimal Decimal::FromWide(Wide&& wide)
+    {
+        Trim(wide.mMagnitude);
+
+        // At most three limbs can still fit the inline coefficient.
+        if (std::size(wide.mMagnitude) <= 3)
+        {
+            using Uint128 = unsigned __int128;
+
+            Uint128 value{};
+            for (auto i{ std::size(wide.mMagnitude) }; i-- > 0;)
+            {
+                value = value * kBase + wide.mMagnitude[i];
+            }
+
+            if (value <= static_cast<Uint128>(std::numeric_limits<std::int64_t>::max()))
+            {
+                const auto coefficient{ static_cast<std::int64_t>(value) };
+                return Decimal{ wide.mNegative ? -coefficient : coefficient, wide.mScale };
+            }
+        }
+
+        Decimal decimal{ 0, wide.mScale };
+        decimal.mNegative = wide.mNegative;
+        decimal.mLimbs = std::move(wide.mMagnitude);
+
+        return decimal;
+    }
+
+    Decimal Decimal::AddWide(Wide&& lhs, Wide&& rhs)
+    {
+        const auto scale{ std::max(lhs.mScale, rhs.mScale) };
+
+        ScaleUp(lhs.mMagnitude, scale - lhs.mScale);
+        ScaleUp(rhs.mMagnitude, scale - rhs.mScale);
+
+        if (lhs.mNegative == rhs.mNegative)
+        {
+            return FromWide({ lhs.mNegative, AddMagnitude(lhs.mMagnitude, rhs.mMagnitude), scale });
+        }
+
+        if (CompareMagnitude(lhs.mMagnitude, rhs.mMagnitude) >= 0)
+        {
+            return FromWide({ lhs.mNegative, SubtractMagnitude(lhs.mMagnitude, rhs.mMagnitude), scale });
+        }
+
+        return FromWide({ rhs.mNegative, SubtractMagnitude(rhs.mMagnitude, lhs.mMagnitude), scale });
+    }
+
+    Decimal Decimal::StripTrailingZeros(Decimal&& value)
+    {
+        if (value.IsSmall())
+        {
+            while (value.mScale > 0 && value.mSmall % 10 == 0)
+            {
+                value.mSmall /= 10;
+                --value.mScale;
+            }
+
+            return std::move(value);
+        }
+
+        auto wide{ value.ToWide() };
+
+        auto zero_limbs{ std::size_t{} };
+        while (wide.mScale >= kLimbDigits && wide.mMagnitude[zero_limbs] == 0)
+        {
+            ++zero_limbs;
+            wide.mScale -= kLimbDigits;
+        }
+
+        wide.mMagnitude.erase(std::begin(wide.mMagnitude), std::begin(wide.mMagnitude) + static_cast<std::ptrdiff_t>(zero_limbs));
+
+        while (wide.mScale > 0 && wide.mMagnitude[0] % 10 == 0)
+        {
+            DivideSmall(wide.mMagnitude, 10);
+            --wide.mScale;
+        }
+
+        return FromWide(std::move(wide));
+    }
+}
\ No newline at end of file
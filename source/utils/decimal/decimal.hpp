@@ -0,0 +1,125 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Exact decimal number: coefficient * 10^(-scale).
+
+    Values whose coefficient fits in std::int64_t stay inline (no allocation) and use 
+    overflow-checked integer arithmetic. On overflow the value is promoted to a heap 
+    magnitude of base 10^9 limbs, and demoted back as soon as the result fits again.
+
+    The limb loops are written lane-wise (no carry inside the inner loop), carries are 
+    propagated in a separate pass, so the compiler can vectorize them.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Utils
+{
+    class Decimal
+    {
+    public:
+        using Limb = std::uint32_t;
+        using Limbs = std::vector<Limb>;
+
+        static constexpr Limb kLimbBase{ 1'000'000'000 };
+        static constexpr std::int32_t kLimbDigits{ 9 };
+
+        // Fractional digits kept by a division which does not terminate, e.g. 1/3.
+        static constexpr std::int32_t kDivisionScale{ 18 };
+
+        // Larger integer exponents are rejected instead of building huge numbers.
+        static constexpr std::int64_t kMaxExponent{ 4096 };
+
+        // The exponent alone does not bound the result, so powers are also rejected when the 
+        // digits of the base times the exponent, an upper bound of the result's digits, exceed this.
+        static constexpr std::int64_t kMaxPowerDigits{ 32'768 };
+
+        Decimal() noexcept;
+        explicit Decimal(std::int64_t coefficient, std::int32_t scale = 0) noexcept;
+
+        // Expects the lexeme of a numeric token: digits with an optional fractional part. 
+        // Parsed in place, only a number too long for the inline coefficient allocates.
+        [[nodiscard]] static Decimal FromString(std::string_view text);
+        [[nodiscard]] static Decimal FromString(std::u16string_view text);
+
+        [[nodiscard]] std::string ToString() const;
+        [[nodiscard]] double ToDouble() const;
+
+        [[nodiscard]] bool IsSmall() const noexcept;
+        [[nodiscard]] bool IsZero() const noexcept;
+        [[nodiscard]] bool IsInteger() const;
+        [[nodiscard]] std::int32_t GetScale() const noexcept;
+
+        [[nodiscard]] Decimal operator-() const;
+
+        friend Decimal operator+(const Decimal& lhs, const Decimal& rhs);
+        friend Decimal operator-(const Decimal& lhs, const Decimal& rhs);
+        friend Decimal operator*(const Decimal& lhs, const Decimal& rhs);
+
+        // Rounded half to even at max(kDivisionScale, dividend scale), empty on division by zero.
+        [[nodiscard]] static std::optional<Decimal> Divide(const Decimal& dividend, const Decimal& divisor);
+
+        // Integer exponents only, empty for fractional or too large exponents, for 0^-n and for too long results.
+        [[nodiscard]] static std::optional<Decimal> Pow(const Decimal& base, const Decimal& exponent);
+
+        // Whether Pow rejects the power for its estimated length, see kMaxPowerDigits.
+        [[nodiscard]] static bool IsPowerTooLong(const Decimal& base, const Decimal& exponent);
+
+    private:
+        // Sign-magnitude form used by the slow path.
+        struct Wide
+        {
+            bool mNegative;
+            Limbs mMagnitude;
+            std::int32_t mScale;
+        };
+
+    private:
+        template <typename TChar>
+        [[nodiscard]] static Decimal Parse(std::basic_string_view<TChar> text);
+
+        // The exponent as an integer within kMaxExponent, empty otherwise.
+        [[nodiscard]] static std::optional<std::int64_t> ToPowerExponent(const Decimal& exponent);
+
+        // Digits of the coefficient, the scale included.
+        [[nodiscard]] std::int64_t CountDigits() const noexcept;
+
+        [[nodiscard]] Wide ToWide() const;
+        [[nodiscard]] static Decimal FromWide(Wide&& wide);
+
+        [[nodiscard]] static Decimal AddWide(Wide&& lhs, Wide&& rhs);
+        [[nodiscard]] static Decimal StripTrailingZeros(Decimal&& value);
+
+    private:
+        std::int64_t mSmall;
+        std::int32_t mScale;
+        bool mNegative;
+        Limbs mLimbs;
+    };
+}
\ No newline at end of file
@@ -45,7 +45,19 @@ namespace Utils
             mInputGenerator{ std::move(input_generator) }
         { }
 
-        ~FiniteStateMachine() noexcept = default;
+        ~FiniteStateMachine() noexcept
+        {
+            for (auto& [state, handle] : mStates)
+            {
+                if (handle) { handle.destroy(); }
+            }
+        }
+
+        FiniteStateMachine(const FiniteStateMachine&) = delete;
+        FiniteStateMachine& operator=(const FiniteStateMachine&) = delete;
+
+        FiniteStateMachine(FiniteStateMachine&&) = delete;
+        FiniteStateMachine& operator=(FiniteStateMachine&&) = delete;
 
         void SetInputGenerator(InputGenerator&& input_generator)
         {
@@ -58,10 +70,14 @@ namespace Utils
             mStates[initial_state].resume();
         }
 
+        // The machine owns the state coroutines, re-adding a state destroys the previous one.
         template <typename TStateGenerator>
         void AddState(TState state, TStateGenerator state_handler)
         {
-            mStates[state] = state_handler(*this).GetInternalHandle();
+            auto& handle{ mStates[state] };
+            if (handle) { handle.destroy(); }
+
+            handle = state_handler(*this).GetInternalHandle();
         }
 
         [[nodiscard]] CoroutineHandle operator[](TState state) 
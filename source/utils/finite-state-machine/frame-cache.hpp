@@ -0,0 +1,137 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Memory for coroutine frames, kept for reuse once a coroutine is destroyed.
+
+    An object which creates the same few coroutines over and over, like the tokenizer with
+    its states and input sequence on every Init, owns a FrameCache and names it through a
+    GetFrameCache(owner) overload found by argument dependent lookup. Frames of its member
+    coroutines then come from the cache and go back to it, so only the first frames reach
+    the global allocator. Other coroutines allocate as usual.
+
+    The cache has to outlive every coroutine allocated from it.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace Utils
+{
+    class FrameCache
+    {
+    public:
+        FrameCache() noexcept = default;
+
+        ~FrameCache() noexcept
+        {
+            while (mFreeBlocks != nullptr)
+            {
+                auto* block{ mFreeBlocks };
+                mFreeBlocks = block->mNext;
+
+                ::operator delete(block, block->mSize);
+            }
+        }
+
+        FrameCache(const FrameCache&) = delete;
+        FrameCache& operator=(const FrameCache&) = delete;
+
+        FrameCache(FrameCache&&) = delete;
+        FrameCache& operator=(FrameCache&&) = delete;
+
+        // Without a cache the frame comes straight from the global allocator.
+        [[nodiscard]] static void* Allocate(FrameCache* cache, std::size_t size)
+        {
+            const std::size_t block_size{ sizeof(Header) + size };
+
+            Header* block{ cache != nullptr ? cache->Take(block_size) : nullptr };
+            if (block == nullptr)
+            {
+                block = ::new (::operator new(block_size)) Header{ cache, block_size, nullptr };
+            }
+
+            return block + 1;
+        }
+
+        static void Deallocate(void* frame) noexcept
+        {
+            auto* block{ static_cast<Header*>(frame) - 1 };
+            if (block->mCache == nullptr)
+            {
+                ::operator delete(block, block->mSize);
+                return;
+            }
+
+            block->mNext = block->mCache->mFreeBlocks;
+            block->mCache->mFreeBlocks = block;
+        }
+
+    private:
+        // Sits in front of every frame, aligned so the frame keeps the alignment of operator new.
+        struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) Header
+        {
+            FrameCache* mCache;
+            std::size_t mSize;
+            Header* mNext;
+        };
+
+        // The first free block large enough, a handful of frame sizes at most.
+        [[nodiscard]] Header* Take(std::size_t size) noexcept
+        {
+            for (Header** link{ &mFreeBlocks }; *link != nullptr; link = &(*link)->mNext)
+            {
+                if ((*link)->mSize >= size)
+                {
+                    auto* block{ *link };
+                    *link = block->mNext;
+
+                    return block;
+                }
+            }
+
+            return nullptr;
+        }
+
+        Header* mFreeBlocks{ nullptr };
+    };
+
+    // Owners with a cache declare their own overload, everything else has none.
+    [[nodiscard]] constexpr FrameCache* GetFrameCache(const auto&) noexcept { return nullptr; }
+
+    // The promise types of this library allocate their frames through this, the arguments being
+    // those of the coroutine, with the object first for a member coroutine.
+    struct CachedFrameAllocation
+    {
+        template <typename TOwner, typename... TArgs>
+        [[nodiscard]] static void* operator new(std::size_t size, TOwner& owner, TArgs&...)
+        {
+            return FrameCache::Allocate(GetFrameCache(owner), size);
+        }
+
+        [[nodiscard]] static void* operator new(std::size_t size) { return FrameCache::Allocate(nullptr, size); }
+
+        static void operator delete(void* frame) noexcept { FrameCache::Deallocate(frame); }
+    };
+}
\ No newline at end of file
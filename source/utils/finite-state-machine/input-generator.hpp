@@ -27,16 +27,20 @@
     "2+2*3/3"
 */
 
+#pragma once
+
 #include <coroutine>
 #include <exception>
 
+#include "frame-cache.hpp"
+
 namespace Utils
 {
     template <typename T>
     class InputGenerator
     {
     public: 
-        struct promise_type
+        struct promise_type : CachedFrameAllocation
         {
             using CoroutineHandle = std::coroutine_handle<promise_type>;
             T mData{};
@@ -83,6 +87,8 @@ namespace Utils
         {
             if (this != &other)
             {
+                if (mHandle) { mHandle.destroy(); }
+
                 mHandle = other.mHandle;
                 other.mHandle = nullptr;
             }
@@ -30,12 +30,14 @@
 #include <coroutine>
 #include <exception>
 
+#include "frame-cache.hpp"
+
 namespace Utils
 {
     class ResumableNoEncapsulation
     {
     public: 
-        struct promise_type
+        struct promise_type : CachedFrameAllocation
         {
             using CoroutineHandle = std::coroutine_handle<promise_type>;
 
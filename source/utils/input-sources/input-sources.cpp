@@ -0,0 +1,99 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "input-sources.hpp"
+
+#include <vector>
+#include <algorithm>
+
+#if __has_include(<unistd.h>)
+#include <cerrno>
+#include <unistd.h>
+#define INPUT_SOURCES_HAS_POSIX_READ
+#endif
+
+namespace Utils::InputSources
+{
+    InputGenerator<Symbol> FromChunks(ChunkReader reader, bool& has_read_error, std::size_t buffer_size)
+    {
+        // Allocated once, in the coroutine frame.
+        std::vector<char> buffer(std::max<std::size_t>(buffer_size, 1));
+        has_read_error = false;
+
+        for (;;)
+        {
+            const auto size{ reader(buffer) };
+            if (size <= 0)
+            {
+                has_read_error = size < 0;
+                co_return;
+            }
+
+            for (qsizetype i{}; i < size; ++i)
+            {
+                co_yield QLatin1Char{ buffer[static_cast<std::size_t>(i)] };
+            }
+        }
+    }
+
+    InputGenerator<Symbol> FromFileDescriptor(int descriptor, bool& has_read_error, std::size_t buffer_size)
+    {
+        auto reader = [descriptor](std::span<char> buffer) -> qsizetype
+        {
+#ifdef INPUT_SOURCES_HAS_POSIX_READ
+            for (;;)
+            {
+                const auto size{ ::read(descriptor, std::data(buffer), std::size(buffer)) };
+                if (size >= 0 || errno != EINTR)
+                {
+                    return static_cast<qsizetype>(size);
+                }
+            }
+#else
+            static_cast<void>(descriptor);
+            static_cast<void>(buffer);
+            return -1;
+#endif
+        };
+
+        return FromChunks(std::move(reader), has_read_error, buffer_size);
+    }
+
+    InputGenerator<Symbol> FromIODevice(QIODevice& device, bool& has_read_error, std::size_t buffer_size)
+    {
+        auto reader = [&device](std::span<char> buffer) -> qsizetype
+        {
+            for (;;)
+            {
+                const auto size{ device.read(std::data(buffer), static_cast<qint64>(std::size(buffer))) };
+
+                // A file is at its end, a pipe or socket may just have nothing buffered yet.
+                if (size != 0 || !device.isSequential() || !device.waitForReadyRead(-1))
+                {
+                    return static_cast<qsizetype>(size);
+                }
+            }
+        };
+
+        return FromChunks(std::move(reader), has_read_error, buffer_size);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Input generators over sources read in chunks, for the streaming Tokenizer::Run.
+
+    Every source reads into one buffer of fixed size and yields its bytes one by one as Latin-1 
+    symbols, so memory does not grow with the input. A lexeme split between two reads, such as a 
+    number, needs no care here: the tokenizer keeps an unfinished lexeme between symbols anyway.
+
+    A failed read ends the input and sets has_read_error, which must outlive the generator.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <span>
+
+#include <QChar>
+#include <QIODevice>
+
+#include <input-generator.hpp>
+
+namespace Utils::InputSources
+{
+    using Symbol = QChar;
+
+    // Fills the buffer and returns the number of bytes written, 0 at the end of the input, a negative value on a read error.
+    using ChunkReader = std::function<qsizetype(std::span<char> buffer)>;
+
+    inline constexpr std::size_t kDefaultBufferSize{ std::size_t{ 64 } << 10 };
+
+    [[nodiscard]] InputGenerator<Symbol> FromChunks(ChunkReader reader, bool& has_read_error, std::size_t buffer_size = kDefaultBufferSize);
+
+    // Reads with read(2), retrying when interrupted. The descriptor is not closed.
+    [[nodiscard]] InputGenerator<Symbol> FromFileDescriptor(int descriptor, bool& has_read_error, std::size_t buffer_size = kDefaultBufferSize);
+
+    // The device must be open for reading. A sequential device with no data yet is waited for, 
+    // its input ends when it is closed.
+    [[nodiscard]] InputGenerator<Symbol> FromIODevice(QIODevice& device, bool& has_read_error, std::size_t buffer_size = kDefaultBufferSize);
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "number-formatter.hpp"
+
+#include <charconv>
+
+namespace Utils
+{
+    NumberFormatter::NumberFormatter(Notation notation, int precision) noexcept :
+        mNotation{ notation }, mPrecision{ precision >= 0 && precision <= kMaxPrecision ? precision : kShortestPrecision }
+    { }
+
+    std::size_t NumberFormatter::Format(double value, std::span<char> buffer) const noexcept
+    {
+        auto* const first{ std::data(buffer) };
+        auto* const last{ first + std::size(buffer) };
+
+        std::to_chars_result result{};
+
+        if (mPrecision == kShortestPrecision)
+        {
+            switch (mNotation)
+            {
+            case Notation::Shortest:   result = std::to_chars(first, last, value); break;
+            case Notation::Fixed:      result = std::to_chars(first, last, value, std::chars_format::fixed); break;
+            case Notation::Scientific: result = std::to_chars(first, last, value, std::chars_format::scientific); break;
+            }
+        }
+        else
+        {
+            switch (mNotation)
+            {
+            case Notation::Shortest:   result = std::to_chars(first, last, value, std::chars_format::general, mPrecision); break;
+            case Notation::Fixed:      result = std::to_chars(first, last, value, std::chars_format::fixed, mPrecision); break;
+            case Notation::Scientific: result = std::to_chars(first, last, value, std::chars_format::scientific, mPrecision); break;
+            }
+        }
+
+        return result.ec == std::errc{} ? static_cast<std::size_t>(result.ptr - first) : 0;
+    }
+
+    std::size_t NumberFormatter::Format(std::span<const double> values, char separator, std::span<char> buffer, std::size_t& value_count) const noexcept
+    {
+        std::size_t length{};
+        value_count = 0;
+
+        for (const auto value : values)
+        {
+            const auto separator_length{ std::size_t{ value_count != 0 } };
+            if (length + separator_length >= std::size(buffer))
+            {
+                break;
+            }
+
+            const auto value_length{ Format(value, buffer.subspan(length + separator_length)) };
+            if (value_length == 0)
+            {
+                break;
+            }
+
+            if (separator_length != 0)
+            {
+                buffer[length] = separator;
+            }
+
+            length += separator_length + value_length;
+            ++value_count;
+        }
+
+        return length;
+    }
+
+    NumberFormatter::Notation NumberFormatter::GetNotation() const noexcept
+    {
+        return mNotation;
+    }
+
+    int NumberFormatter::GetPrecision() const noexcept
+    {
+        return mPrecision;
+    }
+}
@@ -0,0 +1,75 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+/*
+    Formats doubles into caller buffers with std::to_chars, without allocating.
+
+    Without a precision the output is the shortest text which parses back to the same double 
+    (Ryu-style shortest round trip): in Shortest notation whichever of fixed and scientific is 
+    shorter, otherwise the notation asked for. With a precision, Fixed and Scientific write 
+    that many digits after the decimal point and Shortest that many significant digits, as %g.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Utils
+{
+    class NumberFormatter
+    {
+    public:
+        enum class Notation : std::uint8_t
+        {
+            Shortest,
+            Fixed,
+            Scientific
+        };
+
+        static constexpr int kShortestPrecision{ -1 };
+        static constexpr int kMaxPrecision{ 64 };
+
+        // Fits any double in any notation and precision: 309 integer digits of DBL_MAX in 
+        // Fixed, a sign, a point and kMaxPrecision digits.
+        static constexpr std::size_t kMaxLength{ 1 + 309 + 1 + kMaxPrecision };
+
+        // A precision outside [0, kMaxPrecision] means the shortest round trip.
+        explicit NumberFormatter(Notation notation = Notation::Shortest, int precision = kShortestPrecision) noexcept;
+
+        // Returns the number of characters written, nothing is written and 0 is returned if they do not fit.
+        [[nodiscard]] std::size_t Format(double value, std::span<char> buffer) const noexcept;
+
+        // Writes the values one after the other, separated by separator, as many as fit. 
+        // Returns the number of characters written, value_count is set to the number of values written.
+        [[nodiscard]] std::size_t Format(std::span<const double> values, char separator, std::span<char> buffer, std::size_t& value_count) const noexcept;
+
+        [[nodiscard]] Notation GetNotation() const noexcept;
+        [[nodiscard]] int GetPrecision() const noexcept;
+
+    private:
+        Notation mNotation;
+        int mPrecision;
+    };
+}
@@ -0,0 +1,189 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Fixed set of reusable objects handed out through a lock-free free list (Treiber stack).
+
+    The head packs a slot index with a version tag, so a slot which is popped and pushed back 
+    between another thread's load and compare-exchange does not corrupt the list (ABA).
+    When every slot is checked out, Acquire falls back to a temporary heap object instead of blocking.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace Utils
+{
+    template <typename T>
+    class ObjectPool
+    {
+    public:
+        // Returns the object to the pool when destroyed.
+        class Handle
+        {
+        public:
+            Handle(Handle&& other) noexcept :
+                mPool{ std::exchange(other.mPool, nullptr) }, mIndex{ other.mIndex }, mOverflow{ std::move(other.mOverflow) }
+            { }
+
+            Handle& operator=(Handle&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    Reset();
+
+                    mPool = std::exchange(other.mPool, nullptr);
+                    mIndex = other.mIndex;
+                    mOverflow = std::move(other.mOverflow);
+                }
+
+                return *this;
+            }
+
+            Handle(const Handle&) = delete;
+            Handle& operator=(const Handle&) = delete;
+
+            ~Handle() noexcept
+            {
+                Reset();
+            }
+
+            [[nodiscard]] T& operator*() const noexcept { return *Get(); }
+            [[nodiscard]] T* operator->() const noexcept { return Get(); }
+
+            [[nodiscard]] bool IsPooled() const noexcept { return mPool != nullptr; }
+
+        private:
+            friend class ObjectPool;
+
+            Handle(ObjectPool* pool, std::uint32_t index) noexcept :
+                mPool{ pool }, mIndex{ index }, mOverflow{}
+            { }
+
+            explicit Handle(std::unique_ptr<T> overflow) noexcept :
+                mPool{ nullptr }, mIndex{}, mOverflow{ std::move(overflow) }
+            { }
+
+            [[nodiscard]] T* Get() const noexcept
+            {
+                return mPool != nullptr ? &mPool->mSlots[mIndex].mObject : mOverflow.get();
+            }
+
+            void Reset() noexcept
+            {
+                if (mPool != nullptr)
+                {
+                    mPool->Release(mIndex);
+                    mPool = nullptr;
+                }
+
+                mOverflow.reset();
+            }
+
+        private:
+            ObjectPool* mPool;
+            std::uint32_t mIndex;
+            std::unique_ptr<T> mOverflow;
+        };
+
+    public:
+        explicit ObjectPool(std::uint32_t capacity) :
+            mSlots{ std::make_unique<Slot[]>(capacity) }, mCapacity{ capacity }, mHead{ Pack(0, kNil) }
+        {
+            for (std::uint32_t i{ capacity }; i-- > 0;)
+            {
+                Release(i);
+            }
+        }
+
+        ~ObjectPool() noexcept = default;
+
+        // Handles point into the slots, so the pool must stay in place.
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        [[nodiscard]] Handle Acquire()
+        {
+            auto head{ mHead.load(std::memory_order_acquire) };
+
+            for (;;)
+            {
+                const auto index{ GetIndex(head) };
+                if (index == kNil)
+                {
+                    return Handle{ std::make_unique<T>() };
+                }
+
+                const auto next{ mSlots[index].mNext.load(std::memory_order_relaxed) };
+                if (mHead.compare_exchange_weak(head, Pack(GetTag(head) + 1, next), std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    return Handle{ this, index };
+                }
+            }
+        }
+
+        [[nodiscard]] std::uint32_t GetCapacity() const noexcept
+        {
+            return mCapacity;
+        }
+
+    private:
+        struct Slot
+        {
+            T mObject{};
+            std::atomic<std::uint32_t> mNext{};
+        };
+
+    private:
+        static constexpr std::uint32_t kNil{ ~std::uint32_t{} };
+
+        [[nodiscard]] static constexpr std::uint64_t Pack(std::uint32_t tag, std::uint32_t index) noexcept
+        {
+            return (static_cast<std::uint64_t>(tag) << 32) | index;
+        }
+
+        [[nodiscard]] static constexpr std::uint32_t GetTag(std::uint64_t head) noexcept { return static_cast<std::uint32_t>(head >> 32); }
+        [[nodiscard]] static constexpr std::uint32_t GetIndex(std::uint64_t head) noexcept { return static_cast<std::uint32_t>(head); }
+
+        void Release(std::uint32_t index) noexcept
+        {
+            auto head{ mHead.load(std::memory_order_relaxed) };
+
+            do
+            {
+                mSlots[index].mNext.store(GetIndex(head), std::memory_order_relaxed);
+            } 
+            while (!mHead.compare_exchange_weak(head, Pack(GetTag(head) + 1, index), std::memory_order_release, std::memory_order_relaxed));
+        }
+
+    private:
+        std::unique_ptr<Slot[]> mSlots;
+        std::uint32_t mCapacity;
+
+        // Version tag in the upper half, index of the first free slot in the lower half.
+        std::atomic<std::uint64_t> mHead;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+/*
+    Per-evaluation budgets, so one pathological input cannot stall a worker. The tokenizer checks 
+    the input length and the token count, the converter the token count and the nesting depth, 
+    the evaluator the operand stack depth, and all of them the deadline. A stage which hits a 
+    limit stops right away and reports which one.
+
+    Every limit is a single comparison against a value which is already at hand, and the clock 
+    is only read once every mDeadlineCheckInterval steps, so the defaults (no limits) cost nothing 
+    measurable.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include <QString>
+
+namespace Utils
+{
+    enum class LimitViolation : std::uint8_t
+    {
+        None,
+        InputLength,
+        TokenCount,
+        NestingDepth,
+        OperandStackDepth,
+        Deadline
+    };
+
+    struct ResourceLimits
+    {
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::size_t kUnlimited{ std::numeric_limits<std::size_t>::max() };
+
+        std::size_t mMaxInputLength{ kUnlimited };
+        std::size_t mMaxTokenCount{ kUnlimited };
+        std::size_t mMaxNestingDepth{ kUnlimited };
+        std::size_t mMaxOperandStackDepth{ kUnlimited };
+
+        // Absolute, so it covers every stage of one evaluation. Set it again before the next one.
+        Clock::time_point mDeadline{ Clock::time_point::max() };
+        std::uint32_t mDeadlineCheckInterval{ 1024 };
+
+        // Counts down one step, the clock is read when it reaches zero.
+        [[nodiscard]] bool IsPastDeadline(std::uint32_t& countdown) const noexcept
+        {
+            if (--countdown != 0)
+            {
+                return false;
+            }
+
+            countdown = GetDeadlineCheckInterval();
+            return mDeadline != Clock::time_point::max() && Clock::now() >= mDeadline;
+        }
+
+        [[nodiscard]] std::uint32_t GetDeadlineCheckInterval() const noexcept
+        {
+            return mDeadlineCheckInterval != 0 ? mDeadlineCheckInterval : 1;
+        }
+    };
+
+    // Checks nothing, so an evaluation loop instantiated with it has no limit checks at all.
+    struct Unlimited
+    {
+        [[nodiscard]] constexpr bool IsExceeded(std::size_t) const noexcept { return false; }
+    };
+
+    // The evaluators' part of the limits: the operand stack depth and the deadline.
+    struct EvaluationGovernor
+    {
+        EvaluationGovernor(const ResourceLimits& limits, LimitViolation& violation) noexcept :
+            mLimits{ limits }, mViolation{ violation }, mDeadlineCountdown{ limits.GetDeadlineCheckInterval() }
+        {
+            mViolation = LimitViolation::None;
+        }
+
+        // Before every token and after the last one, with the current number of operands.
+        [[nodiscard]] bool IsExceeded(std::size_t operand_count) noexcept
+        {
+            if (operand_count > mLimits.mMaxOperandStackDepth)
+            {
+                mViolation = LimitViolation::OperandStackDepth;
+            }
+            else if (mLimits.IsPastDeadline(mDeadlineCountdown))
+            {
+                mViolation = LimitViolation::Deadline;
+            }
+
+            return mViolation != LimitViolation::None;
+        }
+
+        const ResourceLimits& mLimits;
+        LimitViolation& mViolation;
+        std::uint32_t mDeadlineCountdown;
+    };
+
+    [[nodiscard]] inline QString DescribeLimitViolation(LimitViolation violation, const ResourceLimits& limits)
+    {
+        switch (violation)
+        {
+        case LimitViolation::None:              return {};
+        case LimitViolation::InputLength:       return QStringLiteral("input longer than %1 characters").arg(limits.mMaxInputLength);
+        case LimitViolation::TokenCount:        return QStringLiteral("more than %1 tokens").arg(limits.mMaxTokenCount);
+        case LimitViolation::NestingDepth:      return QStringLiteral("nesting deeper than %1").arg(limits.mMaxNestingDepth);
+        case LimitViolation::OperandStackDepth: return QStringLiteral("operand stack deeper than %1").arg(limits.mMaxOperandStackDepth);
+        case LimitViolation::Deadline:          return QStringLiteral("deadline exceeded");
+        }
+
+        return {};
+    }
+}
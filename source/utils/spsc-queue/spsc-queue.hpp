@@ -0,0 +1,155 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Bounded lock-free queue for exactly one producer and one consumer thread.
+
+    The producer only writes the tail and the consumer only writes the head, each on its own 
+    cache line, and each side keeps a copy of the other side's index, so the shared line is 
+    read again only when the copy says the queue looks full (or empty). Push waits while the 
+    queue is full, which is the backpressure on a faster producer.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace Utils
+{
+    template <typename T>
+    class SPSCQueue
+    {
+    public:
+        // The capacity is rounded up to a power of two.
+        explicit SPSCQueue(std::size_t capacity) :
+            mSlots{ std::make_unique<T[]>(std::bit_ceil(std::max<std::size_t>(capacity, 1))) }, 
+            mMask{ std::bit_ceil(std::max<std::size_t>(capacity, 1)) - 1 }, 
+            mHead{}, mCachedTail{}, mTail{}, mCachedHead{}
+        { }
+
+        ~SPSCQueue() noexcept = default;
+
+        SPSCQueue(const SPSCQueue&) = delete;
+        SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+        // Producer side, moves from value only when there is room.
+        [[nodiscard]] bool TryPush(T& value)
+        {
+            const auto tail{ mTail.load(std::memory_order_relaxed) };
+
+            if (tail - mCachedHead > mMask)
+            {
+                mCachedHead = mHead.load(std::memory_order_acquire);
+
+                if (tail - mCachedHead > mMask)
+                {
+                    return false;
+                }
+            }
+
+            mSlots[tail & mMask] = std::move(value);
+            mTail.store(tail + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        // Consumer side.
+        [[nodiscard]] bool TryPop(T& value)
+        {
+            const auto head{ mHead.load(std::memory_order_relaxed) };
+
+            if (head == mCachedTail)
+            {
+                mCachedTail = mTail.load(std::memory_order_acquire);
+
+                if (head == mCachedTail)
+                {
+                    return false;
+                }
+            }
+
+            value = std::move(mSlots[head & mMask]);
+            mHead.store(head + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        void Push(T value)
+        {
+            for (std::size_t attempt{}; !TryPush(value); ++attempt)
+            {
+                Backoff(attempt);
+            }
+        }
+
+        [[nodiscard]] T Pop()
+        {
+            T value{};
+
+            for (std::size_t attempt{}; !TryPop(value); ++attempt)
+            {
+                Backoff(attempt);
+            }
+
+            return value;
+        }
+
+        [[nodiscard]] std::size_t GetCapacity() const noexcept
+        {
+            return mMask + 1;
+        }
+
+    private:
+        // Spins briefly for a peer running on another core, then gives the core away, 
+        // the peer may be waiting for it.
+        static void Backoff(std::size_t attempt) noexcept
+        {
+            if (attempt >= kSpinCount)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+    private:
+        static constexpr std::size_t kSpinCount{ 64 };
+        static constexpr std::size_t kCacheLineSize{ 64 };
+
+    private:
+        std::unique_ptr<T[]> mSlots;
+        std::size_t mMask;
+
+        // Written by the consumer.
+        alignas(kCacheLineSize) std::atomic<std::size_t> mHead;
+        std::size_t mCachedTail;
+
+        // Written by the producer.
+        alignas(kCacheLineSize) std::atomic<std::size_t> mTail;
+        std::size_t mCachedHead;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "task-scheduler.hpp"
+
+#include <algorithm>
+#include <system_error>
+#include <utility>
+
+namespace
+{
+    // Scheduler and queue of the worker running on this thread, if any.
+    thread_local const Utils::TaskScheduler* tCurrentScheduler{ nullptr };
+    thread_local std::size_t tCurrentQueueIndex{ 0 };
+}
+
+namespace Utils
+{
+    TaskScheduler::TaskScheduler(std::size_t thread_count) :
+        mQueues{}, mWorkers{}, mQueuedTasks{}, mIsStopping{}, mSleepMutex{}, mWakeUp{}
+    {
+        if (thread_count == 0)
+        {
+            thread_count = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+
+        const auto worker_count{ thread_count - 1 };
+
+        for (std::size_t i{}; i <= worker_count; ++i)
+        {
+            mQueues.push_back(std::make_unique<Queue>());
+        }
+
+        try
+        {
+            mWorkers.reserve(worker_count);
+            for (std::size_t i{}; i < worker_count; ++i)
+            {
+                mWorkers.emplace_back(&TaskScheduler::RunWorker, this, i);
+            }
+        }
+        catch (const std::system_error&)
+        {
+            // The queues of workers which were not started are only stolen from.
+        }
+    }
+
+    TaskScheduler::~TaskScheduler() noexcept
+    {
+        {
+            std::lock_guard lock{ mSleepMutex };
+            mIsStopping = true;
+        }
+
+        mWakeUp.notify_all();
+
+        for (auto& worker : mWorkers)
+        {
+            worker.join();
+        }
+    }
+
+    void TaskScheduler::Spawn(TaskGroup& group, Task task)
+    {
+        group.mPendingTasks.fetch_add(1, std::memory_order_relaxed);
+
+        {
+            auto& queue{ *mQueues[GetQueueIndex()] };
+            std::lock_guard lock{ queue.mMutex };
+
+            queue.mEntries.push_back({ std::move(task), &group });
+            mQueuedTasks.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Taking the mutex orders the increment before a sleeping worker rechecks it.
+        {
+            std::lock_guard lock{ mSleepMutex };
+        }
+
+        mWakeUp.notify_one();
+    }
+
+    void TaskScheduler::Wait(TaskGroup& group)
+    {
+        const auto queue_index{ GetQueueIndex() };
+
+        while (group.mPendingTasks.load(std::memory_order_acquire) != 0)
+        {
+            if (!RunQueuedTask(queue_index))
+            {
+                // The remaining tasks of the group are running on other threads.
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    std::size_t TaskScheduler::GetThreadCount() const noexcept
+    {
+        return std::size(mWorkers) + 1;
+    }
+
+    void TaskScheduler::RunWorker(std::size_t queue_index)
+    {
+        tCurrentScheduler = this;
+        tCurrentQueueIndex = queue_index;
+
+        while (true)
+        {
+            if (RunQueuedTask(queue_index))
+            {
+                continue;
+            }
+
+            std::unique_lock lock{ mSleepMutex };
+            mWakeUp.wait(lock, [this]() { return mIsStopping || mQueuedTasks.load(std::memory_order_relaxed) != 0; });
+
+            if (mIsStopping && mQueuedTasks.load(std::memory_order_relaxed) == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    std::size_t TaskScheduler::GetQueueIndex() const noexcept
+    {
+        return tCurrentScheduler == this ? tCurrentQueueIndex : std::size(mQueues) - 1;
+    }
+
+    bool TaskScheduler::RunQueuedTask(std::size_t queue_index)
+    {
+        auto entry{ Pop(queue_index) };
+        if (!entry)
+        {
+            entry = Steal(queue_index);
+        }
+
+        if (!entry)
+        {
+            return false;
+        }
+
+        entry->mTask();
+        entry->mGroup->mPendingTasks.fetch_sub(1, std::memory_order_release);
+
+        return true;
+    }
+
+    std::optional<TaskScheduler::Entry> TaskScheduler::Pop(std::size_t queue_index)
+    {
+        auto& queue{ *mQueues[queue_index] };
+        std::lock_guard lock{ queue.mMutex };
+
+        if (queue.mEntries.empty())
+        {
+            return std::nullopt;
+        }
+
+        auto entry{ std::move(queue.mEntries.back()) };
+        queue.mEntries.pop_back();
+        mQueuedTasks.fetch_sub(1, std::memory_order_relaxed);
+
+        return entry;
+    }
+
+    std::optional<TaskScheduler::Entry> TaskScheduler::Steal(std::size_t thief_index)
+    {
+        // Victims are visited starting after the thief, so thieves spread over different queues.
+        for (std::size_t offset{ 1 }; offset < std::size(mQueues); ++offset)
+        {
+            auto& queue{ *mQueues[(thief_index + offset) % std::size(mQueues)] };
+            std::lock_guard lock{ queue.mMutex };
+
+            if (queue.mEntries.empty())
+            {
+                continue;
+            }
+
+            auto entry{ std::move(queue.mEntries.front()) };
+            queue.mEntries.pop_front();
+            mQueuedTasks.fetch_sub(1, std::memory_order_relaxed);
+
+            return entry;
+        }
+
+        return std::nullopt;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Fixed set of worker threads running fork-join tasks by work stealing.
+
+    Every worker owns a deque: it pushes and pops its own tasks at the back (the most recently 
+    spawned, still warm in its cache) and, when it runs dry, steals from the front of the others 
+    (the oldest, usually the largest pieces of work). Threads outside the scheduler share one extra deque.
+    A thread waiting for a TaskGroup keeps running tasks instead of blocking, so nested fork-join 
+    does not deadlock and the waiting thread counts as one of the threads doing the work.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace Utils
+{
+    class TaskScheduler
+    {
+    public:
+        using Task = std::function<void()>;
+
+        // Counts the unfinished tasks spawned into it.
+        class TaskGroup
+        {
+        public:
+            TaskGroup() = default;
+            ~TaskGroup() noexcept = default;
+
+            TaskGroup(const TaskGroup&) = delete;
+            TaskGroup& operator=(const TaskGroup&) = delete;
+
+        private:
+            friend class TaskScheduler;
+
+            std::atomic<std::size_t> mPendingTasks{};
+        };
+
+    public:
+        // thread_count counts the thread calling Wait, 0 means one thread per hardware thread.
+        // Fewer workers are started when the system refuses to create more.
+        explicit TaskScheduler(std::size_t thread_count = 0);
+        ~TaskScheduler() noexcept;
+
+        TaskScheduler(const TaskScheduler&) = delete;
+        TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+        // The task must not throw.
+        void Spawn(TaskGroup& group, Task task);
+
+        // Runs queued tasks, the caller's own first, until every task of the group has finished.
+        void Wait(TaskGroup& group);
+
+        [[nodiscard]] std::size_t GetThreadCount() const noexcept;
+
+    private:
+        struct Entry
+        {
+            Task mTask;
+            TaskGroup* mGroup;
+        };
+
+        struct alignas(64) Queue
+        {
+            std::mutex mMutex;
+            std::deque<Entry> mEntries;
+        };
+
+        void RunWorker(std::size_t queue_index);
+
+        [[nodiscard]] std::size_t GetQueueIndex() const noexcept;
+        [[nodiscard]] bool RunQueuedTask(std::size_t queue_index);
+
+        [[nodiscard]] std::optional<Entry> Pop(std::size_t queue_index);
+        [[nodiscard]] std::optional<Entry> Steal(std::size_t thief_index);
+
+    private:
+        // One queue per worker, the last one is shared by the threads outside the scheduler.
+        std::vector<std::unique_ptr<Queue>> mQueues;
+        std::vector<std::thread> mWorkers;
+
+        std::atomic<std::size_t> mQueuedTasks;
+        bool mIsStopping;
+
+        std::mutex mSleepMutex;
+        std::condition_variable mWakeUp;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,180 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Stack which can log its changes together with the values they remove or overwrite, so they 
+    can be taken back: Rewind undoes the changes after a change count, newest first. A checkpoint 
+    is then a change count instead of a copy, and going back costs what was done since, whatever 
+    the size of the stack.
+
+    The members follow std::vector, so code templated on the stack takes either. Values are only 
+    changed through it, ReplaceBack is the in-place write. Without logging each change costs one 
+    predictable branch over the plain vector.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Utils
+{
+    template <typename T>
+    class UndoStack
+    {
+    public:
+        UndoStack() = default;
+        ~UndoStack() noexcept = default;
+
+        // Off by default. Switching it drops the log, the values stay.
+        void SetLogging(bool is_enabled) noexcept
+        {
+            mIsLogging = is_enabled;
+            ClearLog();
+        }
+
+        [[nodiscard]] bool IsLogging() const noexcept
+        {
+            return mIsLogging;
+        }
+
+        void push_back(T value)
+        {
+            mValues.push_back(std::move(value));
+
+            if (mIsLogging)
+            {
+                mChanges.push_back(Change::Push);
+            }
+        }
+
+        void pop_back()
+        {
+            if (mIsLogging)
+            {
+                mRemoved.push_back(std::move(mValues.back()));
+                mChanges.push_back(Change::Pop);
+            }
+
+            mValues.pop_back();
+        }
+
+        void ReplaceBack(T value)
+        {
+            if (mIsLogging)
+            {
+                mRemoved.push_back(std::move(mValues.back()));
+                mChanges.push_back(Change::Replace);
+            }
+
+            mValues.back() = std::move(value);
+        }
+
+        // Shrinks only, as that many pops.
+        void resize(std::size_t size)
+        {
+            if (!mIsLogging)
+            {
+                mValues.resize(size);
+                return;
+            }
+
+            while (std::size(mValues) > size)
+            {
+                pop_back();
+            }
+        }
+
+        // Drops the values and the log, the buffers keep their capacity.
+        void clear() noexcept
+        {
+            mValues.clear();
+            ClearLog();
+        }
+
+        [[nodiscard]] const T& back() const noexcept { return mValues.back(); }
+        [[nodiscard]] const T& operator[](std::size_t index) const noexcept { return mValues[index]; }
+
+        [[nodiscard]] std::size_t size() const noexcept { return std::size(mValues); }
+        [[nodiscard]] bool empty() const noexcept { return std::empty(mValues); }
+
+        [[nodiscard]] const T* data() const noexcept { return std::data(mValues); }
+        [[nodiscard]] const T* begin() const noexcept { return data(); }
+        [[nodiscard]] const T* end() const noexcept { return data() + size(); }
+
+        [[nodiscard]] std::size_t GetChangeCount() const noexcept
+        {
+            return std::size(mChanges);
+        }
+
+        // Undoes the changes from change_count on, newest first.
+        void Rewind(std::size_t change_count)
+        {
+            while (std::size(mChanges) > change_count)
+            {
+                switch (mChanges.back())
+                {
+                case Change::Push:
+                    mValues.pop_back();
+                    break;
+
+                case Change::Pop:
+                    mValues.push_back(std::move(mRemoved.back()));
+                    mRemoved.pop_back();
+                    break;
+
+                case Change::Replace:
+                    mValues.back() = std::move(mRemoved.back());
+                    mRemoved.pop_back();
+                    break;
+                }
+
+                mChanges.pop_back();
+            }
+        }
+
+    private:
+        enum class Change : std::uint8_t
+        {
+            Push,
+            Pop,
+            Replace
+        };
+
+    private:
+        void ClearLog() noexcept
+        {
+            mChanges.clear();
+            mRemoved.clear();
+        }
+
+    private:
+        std::vector<T> mValues;
+
+        std::vector<Change> mChanges;
+        std::vector<T> mRemoved;
+
+        bool mIsLogging{};
+    };
+}
\ No newline at end of file
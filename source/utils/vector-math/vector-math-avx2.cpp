@@ -0,0 +1,110 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "vector-math-dispatch.hpp"
+#include "vector-math-kernels.hpp"
+
+#include <immintrin.h>
+
+namespace Utils::VectorMath::Detail
+{
+namespace
+{
+    struct AVX2Ops
+    {
+        using Value = __m256d;
+        using Bits = __m256i;
+        using Mask = __m256d;
+
+        static constexpr std::size_t kWidth{ 4 };
+
+        static Value Load(const double* source) noexcept { return _mm256_loadu_pd(source); }
+        static void Store(double* destination, Value value) noexcept { _mm256_storeu_pd(destination, value); }
+        static Value Broadcast(double value) noexcept { return _mm256_set1_pd(value); }
+        static Bits BroadcastBits(std::uint64_t value) noexcept { return _mm256_set1_epi64x(static_cast<long long>(value)); }
+
+        static Value Add(Value a, Value b) noexcept { return _mm256_add_pd(a, b); }
+        static Value Sub(Value a, Value b) noexcept { return _mm256_sub_pd(a, b); }
+        static Value Mul(Value a, Value b) noexcept { return _mm256_mul_pd(a, b); }
+        static Value Div(Value a, Value b) noexcept { return _mm256_div_pd(a, b); }
+        static Value MulAdd(Value a, Value b, Value c) noexcept { return _mm256_fmadd_pd(a, b, c); }
+        static Value Sqrt(Value a) noexcept { return _mm256_sqrt_pd(a); }
+
+        static Bits AsBits(Value a) noexcept { return _mm256_castpd_si256(a); }
+        static Value FromBits(Bits a) noexcept { return _mm256_castsi256_pd(a); }
+        static Bits AddBits(Bits a, Bits b) noexcept { return _mm256_add_epi64(a, b); }
+        static Bits SubBits(Bits a, Bits b) noexcept { return _mm256_sub_epi64(a, b); }
+        static Bits AndBits(Bits a, Bits b) noexcept { return _mm256_and_si256(a, b); }
+        static Bits OrBits(Bits a, Bits b) noexcept { return _mm256_or_si256(a, b); }
+        static Bits XorBits(Bits a, Bits b) noexcept { return _mm256_xor_si256(a, b); }
+        template <int Shift> static Bits ShiftLeft(Bits a) noexcept { return _mm256_slli_epi64(a, Shift); }
+        template <int Shift> static Bits ShiftRight(Bits a) noexcept { return _mm256_srli_epi64(a, Shift); }
+
+        static Mask Less(Value a, Value b) noexcept { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+        static Mask Greater(Value a, Value b) noexcept { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+        static Mask Equal(Value a, Value b) noexcept { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+        static Mask IsNaN(Value a) noexcept { return _mm256_cmp_pd(a, a, _CMP_UNORD_Q); }
+        static Mask Or(Mask a, Mask b) noexcept { return _mm256_or_pd(a, b); }
+        static Mask And(Mask a, Mask b) noexcept { return _mm256_and_pd(a, b); }
+        static Mask LowBitSet(Bits a) noexcept { return _mm256_castsi256_pd(_mm256_sub_epi64(_mm256_setzero_si256(), _mm256_and_si256(a, _mm256_set1_epi64x(1)))); }
+        static Value Select(Mask mask, Value a, Value b) noexcept { return _mm256_blendv_pd(b, a, mask); }
+        static bool Any(Mask mask) noexcept { return _mm256_movemask_pd(mask) != 0; }
+
+        // The in-lane unpacks give (0, 4, 2, 6) and (1, 5, 3, 7), the permute restores the order.
+        static void Deinterleave(Value a, Value b, Value& even, Value& odd) noexcept
+        {
+            even = _mm256_permute4x64_pd(_mm256_unpacklo_pd(a, b), 0b11'01'10'00);
+            odd = _mm256_permute4x64_pd(_mm256_unpackhi_pd(a, b), 0b11'01'10'00);
+        }
+    };
+
+    template <typename Kernel>
+    void UnaryAVX2(const double* input, double* output, std::size_t count) noexcept
+    {
+        Map<AVX2Ops, Kernel>(input, output, count);
+    }
+
+    template <bool Minimum>
+    void BinaryAVX2(const double* first, const double* second, double* output, std::size_t count) noexcept
+    {
+        MapMinMax<AVX2Ops, Minimum>(first, second, output, count);
+    }
+}
+
+    const BatchTable& GetAVX2Table() noexcept
+    {
+        static constexpr BatchTable kTable{
+            .mName = "avx2",
+            .mSin = &UnaryAVX2<SinKernel>,
+            .mCos = &UnaryAVX2<CosKernel>,
+            .mExp = &UnaryAVX2<ExpKernel>,
+            .mLog = &UnaryAVX2<LogKernel>,
+            .mSqrt = &UnaryAVX2<SqrtKernel>,
+            .mMin = &BinaryAVX2<true>,
+            .mMax = &BinaryAVX2<false>,
+            .mSumPairs = &ReducePairs<AVX2Ops, false>,
+            .mMultiplyPairs = &ReducePairs<AVX2Ops, true>,
+        };
+
+        return kTable;
+    }
+}
\ No newline at end of file
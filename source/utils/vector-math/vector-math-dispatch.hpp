@@ -0,0 +1,51 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+
+namespace Utils::VectorMath::Detail
+{
+    using UnaryBatch = void (*)(const double*, double*, std::size_t) noexcept;
+    using BinaryBatch = void (*)(const double*, const double*, double*, std::size_t) noexcept;
+    using PairBatch = std::size_t (*)(double*, std::size_t) noexcept;
+
+    struct BatchTable
+    {
+        const char* mName;
+        UnaryBatch mSin;
+        UnaryBatch mCos;
+        UnaryBatch mExp;
+        UnaryBatch mLog;
+        UnaryBatch mSqrt;
+        BinaryBatch mMin;
+        BinaryBatch mMax;
+        PairBatch mSumPairs;
+        PairBatch mMultiplyPairs;
+    };
+
+#ifdef VECTOR_MATH_HAS_AVX2
+    // Defined in vector-math-avx2.cpp, only call after checking the CPU supports AVX2 and FMA.
+    [[nodiscard]] const BatchTable& GetAVX2Table() noexcept;
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,427 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Kernels are written once against an "Ops" policy (ScalarOps here, SSE2Ops / AVX2Ops 
+    in the translation units that are compiled for them). Everything lives in an anonymous 
+    namespace on purpose, each TU gets its own copy compiled with its own target flags.
+*/
+
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace Utils::VectorMath::Detail
+{
+namespace
+{
+    struct ScalarOps
+    {
+        using Value = double;
+        using Bits = std::uint64_t;
+        using Mask = bool;
+
+        static constexpr std::size_t kWidth{ 1 };
+
+        static Value Load(const double* source) noexcept { return *source; }
+        static void Store(double* destination, Value value) noexcept { *destination = value; }
+        static Value Broadcast(double value) noexcept { return value; }
+        static Bits BroadcastBits(std::uint64_t value) noexcept { return value; }
+
+        static Value Add(Value a, Value b) noexcept { return a + b; }
+        static Value Sub(Value a, Value b) noexcept { return a - b; }
+        static Value Mul(Value a, Value b) noexcept { return a * b; }
+        static Value Div(Value a, Value b) noexcept { return a / b; }
+        static Value MulAdd(Value a, Value b, Value c) noexcept { return a * b + c; }
+        static Value Sqrt(Value a) noexcept { return std::sqrt(a); }
+
+        static Bits AsBits(Value a) noexcept { return std::bit_cast<Bits>(a); }
+        static Value FromBits(Bits a) noexcept { return std::bit_cast<Value>(a); }
+        static Bits AddBits(Bits a, Bits b) noexcept { return a + b; }
+        static Bits SubBits(Bits a, Bits b) noexcept { return a - b; }
+        static Bits AndBits(Bits a, Bits b) noexcept { return a & b; }
+        static Bits OrBits(Bits a, Bits b) noexcept { return a | b; }
+        static Bits XorBits(Bits a, Bits b) noexcept { return a ^ b; }
+        template <int Shift> static Bits ShiftLeft(Bits a) noexcept { return a << Shift; }
+        template <int Shift> static Bits ShiftRight(Bits a) noexcept { return a >> Shift; }
+
+        static Mask Less(Value a, Value b) noexcept { return a < b; }
+        static Mask Greater(Value a, Value b) noexcept { return a > b; }
+        static Mask Equal(Value a, Value b) noexcept { return a == b; }
+        static Mask IsNaN(Value a) noexcept { return a != a; }
+        static Mask Or(Mask a, Mask b) noexcept { return a || b; }
+        static Mask And(Mask a, Mask b) noexcept { return a && b; }
+        static Mask LowBitSet(Bits a) noexcept { return (a & 1) != 0; }
+        static Value Select(Mask mask, Value a, Value b) noexcept { return mask ? a : b; }
+        static bool Any(Mask mask) noexcept { return mask; }
+
+        // a, b hold 2 * kWidth consecutive values, even gets those at even offsets and odd the rest, both in order.
+        static void Deinterleave(Value a, Value b, Value& even, Value& odd) noexcept { even = a; odd = b; }
+    };
+
+    inline constexpr double kRoundMagic{ 6755399441055744.0 }; // 1.5 * 2^52, x + kRoundMagic keeps round(x) in the low mantissa bits
+    inline constexpr std::uint64_t kSignBit{ 0x8000000000000000ull };
+    inline constexpr std::uint64_t kMantissaBits{ 0x000fffffffffffffull };
+    inline constexpr std::uint64_t kExponentOne{ 0x3ff0000000000000ull };
+    inline constexpr double kInfinity{ std::numeric_limits<double>::infinity() };
+    inline constexpr double kNaN{ std::numeric_limits<double>::quiet_NaN() };
+
+    template <typename Ops>
+    typename Ops::Value Abs(typename Ops::Value x) noexcept
+    {
+        return Ops::FromBits(Ops::AndBits(Ops::AsBits(x), Ops::BroadcastBits(~kSignBit)));
+    }
+
+    // 2^k for integral k in [-1022, 1023] given as a double.
+    template <typename Ops>
+    typename Ops::Value Pow2(typename Ops::Value k) noexcept
+    {
+        const auto magic{ Ops::Broadcast(kRoundMagic) };
+        const auto integer{ Ops::SubBits(Ops::AsBits(Ops::Add(k, magic)), Ops::AsBits(magic)) };
+
+        return Ops::FromBits(Ops::template ShiftLeft<52>(Ops::AddBits(integer, Ops::BroadcastBits(1023))));
+    }
+
+    struct ExpKernel
+    {
+        template <typename Ops>
+        static typename Ops::Value Apply(typename Ops::Value x) noexcept
+        {
+            using Ops_ = Ops;
+            const auto c{ [](double value) { return Ops_::Broadcast(value); } };
+
+            // exp(x) overflows above ln(DBL_MAX) and is below half the smallest subnormal under -745.13
+            constexpr double kOverflow{ 709.782712893383973096 };
+            constexpr double kUnderflow{ -745.133219101941108420 };
+
+            auto clamped{ Ops::Select(Ops::Greater(x, c(kOverflow)), c(kOverflow), x) };
+            clamped = Ops::Select(Ops::Less(clamped, c(kUnderflow)), c(kUnderflow), clamped);
+
+            // x = k ln2 + r, |r| <= ln2 / 2; ln2 is split so that k * kLn2High is exact
+            constexpr double kLog2E{ 1.44269504088896338700 };
+            constexpr double kLn2High{ 6.93147180369123816490e-01 };
+            constexpr double kLn2Low{ 1.90821492927058770002e-10 };
+
+            const auto k{ Ops::Sub(Ops::MulAdd(clamped, c(kLog2E), c(kRoundMagic)), c(kRoundMagic)) };
+            const auto high{ Ops::Sub(clamped, Ops::Mul(k, c(kLn2High))) };
+            const auto low{ Ops::Mul(k, c(kLn2Low)) };
+            const auto r{ Ops::Sub(high, low) };
+
+            // exp(r) = 1 + r + r^2 / 2 + ... + r^15 / 15!, the truncation error is below 2^-67 on |r| <= ln2 / 2
+            auto p{ c(1.0 / 1307674368000.0) };
+            p = Ops::MulAdd(p, r, c(1.0 / 87178291200.0));
+            p = Ops::MulAdd(p, r, c(1.0 / 6227020800.0));
+            p = Ops::MulAdd(p, r, c(1.0 / 479001600.0));
+            p = Ops::MulAdd(p, r, c(1.0 / 39916800.0));
+            p = Ops::MulAdd(p, r, c(1.0 / 3628800.0));
+            p = Ops::MulAdd(p, r, c(1.0 / 362880.0));
+            p = Ops::MulAdd(p, r, c(1.0 / 40320.0));
+            p = Ops::MulAdd(p, r, c(1.0 / 5040.0));
+            p = Ops::MulAdd(p, r, c(1.0 / 720.0));
+            p = Ops::MulAdd(p, r, c(1.0 / 120.0));
+            p = Ops::MulAdd(p, r, c(1.0 / 24.0));
+            p = Ops::MulAdd(p, r, c(1.0 / 6.0));
+            p = Ops::MulAdd(p, r, c(0.5));
+
+            // 1 + r + r^2 p with the low part of r added back separately
+            const auto r2{ Ops::Mul(r, r) };
+            const auto tail{ Ops::Sub(Ops::MulAdd(r2, p, Ops::Sub(high, r)), low) };
+            const auto expR{ Ops::Add(c(1.0), Ops::Add(r, tail)) };
+
+            // 2^k is applied in two halves so both stay normal over the whole range of k
+            const auto kHalf{ Ops::Sub(Ops::MulAdd(k, c(0.5), c(kRoundMagic)), c(kRoundMagic)) };
+            auto result{ Ops::Mul(Ops::Mul(expR, Pow2<Ops>(kHalf)), Pow2<Ops>(Ops::Sub(k, kHalf))) };
+
+            result = Ops::Select(Ops::Greater(x, c(kOverflow)), c(kInfinity), result);
+            result = Ops::Select(Ops::Less(x, c(kUnderflow)), c(0.0), result);
+
+            return Ops::Select(Ops::IsNaN(x), x, result);
+        }
+    };
+
+    struct LogKernel
+    {
+        template <typename Ops>
+        static typename Ops::Value Apply(typename Ops::Value x) noexcept
+        {
+            using Ops_ = Ops;
+            const auto c{ [](double value) { return Ops_::Broadcast(value); } };
+
+            constexpr double kMinNormal{ 2.2250738585072014e-308 };
+            constexpr double kTwo54{ 18014398509481984.0 };
+            constexpr double kSqrt2{ 1.41421356237309504880 };
+            constexpr double kLn2High{ 6.93147180369123816490e-01 };
+            constexpr double kLn2Low{ 1.90821492927058770002e-10 };
+
+            // Subnormals are scaled into the normal range first
+            const auto subnormal{ Ops::Less(x, c(kMinNormal)) };
+            const auto scaled{ Ops::Select(subnormal, Ops::Mul(x, c(kTwo54)), x) };
+            const auto bits{ Ops::AsBits(scaled) };
+
+            // x = 2^e m, m in [1, 2); the biased exponent is read back as a double through kRoundMagic
+            const auto magic{ Ops::Broadcast(kRoundMagic) };
+            auto exponent{ Ops::Sub(Ops::FromBits(Ops::AddBits(Ops::template ShiftRight<52>(bits), Ops::AsBits(magic))), magic) };
+            exponent = Ops::Sub(exponent, Ops::Select(subnormal, c(1023.0 + 54.0), c(1023.0)));
+
+            auto m{ Ops::FromBits(Ops::OrBits(Ops::AndBits(bits, Ops::BroadcastBits(kMantissaBits)), Ops::BroadcastBits(kExponentOne))) };
+
+            // Keep m in [sqrt(2) / 2, sqrt(2)) so that f = m - 1 is small on both sides of 1
+            const auto large{ Ops::Greater(m, c(kSqrt2)) };
+            m = Ops::Select(large, Ops::Mul(m, c(0.5)), m);
+            exponent = Ops::Select(large, Ops::Add(exponent, c(1.0)), exponent);
+
+            // log(1 + f) = f - f^2 / 2 + s (f^2 / 2 + R(s^2)), s = f / (2 + f), R from fdlibm's e_log.c
+            const auto f{ Ops::Sub(m, c(1.0)) };
+            const auto s{ Ops::Div(f, Ops::Add(c(2.0), f)) };
+            const auto z{ Ops::Mul(s, s) };
+
+            auto r{ c(1.479819860511658591e-01) };
+            r = Ops::MulAdd(r, z, c(1.531383769920937332e-01));
+            r = Ops::MulAdd(r, z, c(1.818357216161805012e-01));
+            r = Ops::MulAdd(r, z, c(2.222219843214978396e-01));
+            r = Ops::MulAdd(r, z, c(2.857142874366239149e-01));
+            r = Ops::MulAdd(r, z, c(3.999999999940941908e-01));
+            r = Ops::MulAdd(r, z, c(6.666666666666735130e-01));
+            r = Ops::Mul(r, z);
+
+            const auto halfSquare{ Ops::Mul(c(0.5), Ops::Mul(f, f)) };
+            const auto correction{ Ops::MulAdd(s, Ops::Add(halfSquare, r), Ops::Mul(exponent, c(kLn2Low))) };
+            auto result{ Ops::Sub(Ops::Mul(exponent, c(kLn2High)), Ops::Sub(Ops::Sub(halfSquare, correction), f)) };
+
+            result = Ops::Select(Ops::Equal(x, c(kInfinity)), x, result);
+            result = Ops::Select(Ops::Equal(x, c(0.0)), c(-kInfinity), result);
+            result = Ops::Select(Ops::Less(x, c(0.0)), c(kNaN), result);
+
+            return Ops::Select(Ops::IsNaN(x), x, result);
+        }
+    };
+
+    // Arguments above this go to the C library, below it n * kPiOver2Part1 is exact (n < 2^20).
+    inline constexpr double kMaxReducedArgument{ 524288.0 };
+
+    template <typename Ops, bool Cosine>
+    typename Ops::Value SinCos(typename Ops::Value x) noexcept
+    {
+        using Ops_ = Ops;
+        const auto c{ [](double value) { return Ops_::Broadcast(value); } };
+
+        // pi / 2 in three 33 bit parts and a tail (fdlibm's pio2_1, pio2_2, pio2_3, pio2_3t)
+        constexpr double kTwoOverPi{ 6.36619772367581382433e-01 };
+        constexpr double kPiOver2Part1{ 1.57079632673412561417e+00 };
+        constexpr double kPiOver2Part2{ 6.07710050630396597660e-11 };
+        constexpr double kPiOver2Part3{ 2.02226624871116645580e-21 };
+        constexpr double kPiOver2Tail{ 8.47842766036889956997e-32 };
+
+        const auto shifted{ Ops::MulAdd(x, c(kTwoOverPi), c(kRoundMagic)) };
+        const auto n{ Ops::Sub(shifted, c(kRoundMagic)) };
+        auto quadrant{ Ops::SubBits(Ops::AsBits(shifted), Ops::AsBits(c(kRoundMagic))) };
+
+        if constexpr (Cosine)
+        {
+            quadrant = Ops::AddBits(quadrant, Ops::BroadcastBits(1));
+        }
+
+        // r = x - n pi / 2 as high + low; the first subtraction is exact, the others keep their rounding error
+        const auto TwoDifference{ [](auto a, auto b, auto& error) {
+            const auto difference{ Ops_::Sub(a, b) };
+            const auto virtualB{ Ops_::Sub(a, difference) };
+            error = Ops_::Add(Ops_::Sub(a, Ops_::Add(difference, virtualB)), Ops_::Sub(virtualB, b));
+            return difference;
+        } };
+
+        const auto first{ Ops::Sub(x, Ops::Mul(n, c(kPiOver2Part1))) };
+        typename Ops::Value error2{}, error3{};
+        const auto second{ TwoDifference(first, Ops::Mul(n, c(kPiOver2Part2)), error2) };
+        const auto high{ TwoDifference(second, Ops::Mul(n, c(kPiOver2Part3)), error3) };
+        const auto low{ Ops::Sub(Ops::Add(error2, error3), Ops::Mul(n, c(kPiOver2Tail))) };
+
+        // Minimax polynomials on [-pi/4, pi/4] from FreeBSD's k_sin.c and k_cos.c
+        const auto z{ Ops::Mul(high, high) };
+
+        auto sr{ c(1.58969099521155010221e-10) };
+        sr = Ops::MulAdd(sr, z, c(-2.50507602534068634195e-08));
+        sr = Ops::MulAdd(sr, z, c(2.75573137070700676789e-06));
+        sr = Ops::MulAdd(sr, z, c(-1.98412698298579493134e-04));
+        sr = Ops::MulAdd(sr, z, c(8.33333333332248946124e-03));
+
+        const auto v{ Ops::Mul(z, high) };
+        const auto sinInner{ Ops::Sub(Ops::Mul(z, Ops::Sub(Ops::Mul(c(0.5), low), Ops::Mul(v, sr))), low) };
+        const auto sine{ Ops::Sub(high, Ops::Sub(sinInner, Ops::Mul(v, c(-1.66666666666666324348e-01)))) };
+
+        auto cr{ c(-1.13596475577881948265e-11) };
+        cr = Ops::MulAdd(cr, z, c(2.08757232129817482790e-09));
+        cr = Ops::MulAdd(cr, z, c(-2.75573143513906633035e-07));
+        cr = Ops::MulAdd(cr, z, c(2.48015872894767294178e-05));
+        cr = Ops::MulAdd(cr, z, c(-1.38888888888741095749e-03));
+        cr = Ops::MulAdd(cr, z, c(4.16666666666666019037e-02));
+        cr = Ops::Mul(cr, z);
+
+        const auto halfZ{ Ops::Mul(c(0.5), z) };
+        const auto w{ Ops::Sub(c(1.0), halfZ) };
+        const auto cosTail{ Ops::Sub(Ops::Mul(z, cr), Ops::Mul(high, low)) };
+        const auto cosine{ Ops::Add(w, Ops::Add(Ops::Sub(Ops::Sub(c(1.0), w), halfZ), cosTail)) };
+
+        // Odd quadrants swap sine and cosine, quadrants 2 and 3 flip the sign
+        const auto swapped{ Ops::Select(Ops::LowBitSet(quadrant), cosine, sine) };
+        const auto sign{ Ops::template ShiftLeft<62>(Ops::AndBits(quadrant, Ops::BroadcastBits(2))) };
+
+        return Ops::FromBits(Ops::XorBits(Ops::AsBits(swapped), sign));
+    }
+
+    struct SinKernel
+    {
+        template <typename Ops>
+        static typename Ops::Value Apply(typename Ops::Value x) noexcept { return SinCos<Ops, false>(x); }
+
+        static double Fallback(double x) noexcept { return std::sin(x); }
+    };
+
+    struct CosKernel
+    {
+        template <typename Ops>
+        static typename Ops::Value Apply(typename Ops::Value x) noexcept { return SinCos<Ops, true>(x); }
+
+        static double Fallback(double x) noexcept { return std::cos(x); }
+    };
+
+    struct SqrtKernel
+    {
+        template <typename Ops>
+        static typename Ops::Value Apply(typename Ops::Value x) noexcept { return Ops::Sqrt(x); }
+    };
+
+    template <typename Kernel>
+    concept HasFallback = requires(double x) { Kernel::Fallback(x); };
+
+    template <typename Kernel>
+    double ApplyScalar(double x) noexcept
+    {
+        if constexpr (HasFallback<Kernel>)
+        {
+            if (!(std::fabs(x) <= kMaxReducedArgument)) [[unlikely]]
+            {
+                return Kernel::Fallback(x);
+            }
+        }
+
+        return Kernel::template Apply<ScalarOps>(x);
+    }
+
+    template <typename Ops, typename Kernel>
+    void Map(const double* input, double* output, std::size_t count) noexcept
+    {
+        std::size_t i{};
+
+        for (; i + Ops::kWidth <= count; i += Ops::kWidth)
+        {
+            const auto x{ Ops::Load(input + i) };
+            const auto y{ Kernel::template Apply<Ops>(x) };
+
+            if constexpr (HasFallback<Kernel>)
+            {
+                if (Ops::Any(Ops::Greater(Abs<Ops>(x), Ops::Broadcast(kMaxReducedArgument)))) [[unlikely]]
+                {
+                    // The arguments are kept aside, output may be the input buffer.
+                    double lanes[Ops::kWidth];
+                    Ops::Store(lanes, x);
+                    Ops::Store(output + i, y);
+
+                    for (std::size_t lane{}; lane < Ops::kWidth; ++lane)
+                    {
+                        if (std::fabs(lanes[lane]) > kMaxReducedArgument)
+                        {
+                            output[i + lane] = Kernel::Fallback(lanes[lane]);
+                        }
+                    }
+
+                    continue;
+                }
+            }
+
+            Ops::Store(output + i, y);
+        }
+
+        for (; i < count; ++i)
+        {
+            output[i] = ApplyScalar<Kernel>(input[i]);
+        }
+    }
+
+    // Same convention as std::fmin / std::fmax: a NaN operand yields the other one.
+    template <typename Ops, bool Minimum>
+    typename Ops::Value MinMax(typename Ops::Value a, typename Ops::Value b) noexcept
+    {
+        const auto result{ Minimum ? Ops::Select(Ops::Less(b, a), b, a) : Ops::Select(Ops::Greater(b, a), b, a) };
+        return Ops::Select(Ops::IsNaN(a), b, result);
+    }
+
+    template <typename Ops, bool Minimum>
+    void MapMinMax(const double* first, const double* second, double* output, std::size_t count) noexcept
+    {
+        std::size_t i{};
+
+        for (; i + Ops::kWidth <= count; i += Ops::kWidth)
+        {
+            Ops::Store(output + i, MinMax<Ops, Minimum>(Ops::Load(first + i), Ops::Load(second + i)));
+        }
+
+        for (; i < count; ++i)
+        {
+            output[i] = MinMax<ScalarOps, Minimum>(first[i], second[i]);
+        }
+    }
+
+    // One level of the pairwise reduction: values[i] = values[2i] op values[2i + 1], an odd last value moves down unchanged.
+    // Works in place, every store lands below the values still to be loaded. Returns the new count.
+    template <typename Ops, bool Product>
+    std::size_t ReducePairs(double* values, std::size_t count) noexcept
+    {
+        const auto pairs{ count / 2 };
+        std::size_t i{};
+
+        for (; i + Ops::kWidth <= pairs; i += Ops::kWidth)
+        {
+            typename Ops::Value even{};
+            typename Ops::Value odd{};
+            Ops::Deinterleave(Ops::Load(values + 2 * i), Ops::Load(values + 2 * i + Ops::kWidth), even, odd);
+
+            Ops::Store(values + i, Product ? Ops::Mul(even, odd) : Ops::Add(even, odd));
+        }
+
+        for (; i < pairs; ++i)
+        {
+            values[i] = Product ? values[2 * i] * values[2 * i + 1] : values[2 * i] + values[2 * i + 1];
+        }
+
+        if (count % 2 != 0)
+        {
+            values[pairs] = values[count - 1];
+        }
+
+        return pairs + count % 2;
+    }
+}
+}
\ No newline at end of file
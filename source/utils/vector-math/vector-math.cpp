@@ -0,0 +1,307 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "vector-math.hpp"
+#include "vector-math-dispatch.hpp"
+#include "vector-math-kernels.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <thread>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace Utils::VectorMath::Detail
+{
+namespace
+{
+#ifdef __SSE2__
+    struct SSE2Ops
+    {
+        using Value = __m128d;
+        using Bits = __m128i;
+        using Mask = __m128d;
+
+        static constexpr std::size_t kWidth{ 2 };
+
+        static Value Load(const double* source) noexcept { return _mm_loadu_pd(source); }
+        static void Store(double* destination, Value value) noexcept { _mm_storeu_pd(destination, value); }
+        static Value Broadcast(double value) noexcept { return _mm_set1_pd(value); }
+        static Bits BroadcastBits(std::uint64_t value) noexcept { return _mm_set1_epi64x(static_cast<long long>(value)); }
+
+        static Value Add(Value a, Value b) noexcept { return _mm_add_pd(a, b); }
+        static Value Sub(Value a, Value b) noexcept { return _mm_sub_pd(a, b); }
+        static Value Mul(Value a, Value b) noexcept { return _mm_mul_pd(a, b); }
+        static Value Div(Value a, Value b) noexcept { return _mm_div_pd(a, b); }
+        static Value MulAdd(Value a, Value b, Value c) noexcept { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+        static Value Sqrt(Value a) noexcept { return _mm_sqrt_pd(a); }
+
+        static Bits AsBits(Value a) noexcept { return _mm_castpd_si128(a); }
+        static Value FromBits(Bits a) noexcept { return _mm_castsi128_pd(a); }
+        static Bits AddBits(Bits a, Bits b) noexcept { return _mm_add_epi64(a, b); }
+        static Bits SubBits(Bits a, Bits b) noexcept { return _mm_sub_epi64(a, b); }
+        static Bits AndBits(Bits a, Bits b) noexcept { return _mm_and_si128(a, b); }
+        static Bits OrBits(Bits a, Bits b) noexcept { return _mm_or_si128(a, b); }
+        static Bits XorBits(Bits a, Bits b) noexcept { return _mm_xor_si128(a, b); }
+        template <int Shift> static Bits ShiftLeft(Bits a) noexcept { return _mm_slli_epi64(a, Shift); }
+        template <int Shift> static Bits ShiftRight(Bits a) noexcept { return _mm_srli_epi64(a, Shift); }
+
+        static Mask Less(Value a, Value b) noexcept { return _mm_cmplt_pd(a, b); }
+        static Mask Greater(Value a, Value b) noexcept { return _mm_cmpgt_pd(a, b); }
+        static Mask Equal(Value a, Value b) noexcept { return _mm_cmpeq_pd(a, b); }
+        static Mask IsNaN(Value a) noexcept { return _mm_cmpunord_pd(a, a); }
+        static Mask Or(Mask a, Mask b) noexcept { return _mm_or_pd(a, b); }
+        static Mask And(Mask a, Mask b) noexcept { return _mm_and_pd(a, b); }
+        static Mask LowBitSet(Bits a) noexcept { return _mm_castsi128_pd(_mm_sub_epi64(_mm_setzero_si128(), _mm_and_si128(a, _mm_set1_epi64x(1)))); }
+        static Value Select(Mask mask, Value a, Value b) noexcept { return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b)); }
+        static bool Any(Mask mask) noexcept { return _mm_movemask_pd(mask) != 0; }
+
+        static void Deinterleave(Value a, Value b, Value& even, Value& odd) noexcept
+        {
+            even = _mm_unpacklo_pd(a, b);
+            odd = _mm_unpackhi_pd(a, b);
+        }
+    };
+
+    using BaselineOps = SSE2Ops;
+    constexpr const char* kBaselineName{ "sse2" };
+#else
+    using BaselineOps = ScalarOps;
+    constexpr const char* kBaselineName{ "scalar" };
+#endif
+
+    template <typename Kernel>
+    void UnaryBaseline(const double* input, double* output, std::size_t count) noexcept
+    {
+        Map<BaselineOps, Kernel>(input, output, count);
+    }
+
+    template <bool Minimum>
+    void BinaryBaseline(const double* first, const double* second, double* output, std::size_t count) noexcept
+    {
+        MapMinMax<BaselineOps, Minimum>(first, second, output, count);
+    }
+
+    constexpr BatchTable kBaselineTable{
+        .mName = kBaselineName,
+        .mSin = &UnaryBaseline<SinKernel>,
+        .mCos = &UnaryBaseline<CosKernel>,
+        .mExp = &UnaryBaseline<ExpKernel>,
+        .mLog = &UnaryBaseline<LogKernel>,
+        .mSqrt = &UnaryBaseline<SqrtKernel>,
+        .mMin = &BinaryBaseline<true>,
+        .mMax = &BinaryBaseline<false>,
+        .mSumPairs = &ReducePairs<BaselineOps, false>,
+        .mMultiplyPairs = &ReducePairs<BaselineOps, true>,
+    };
+
+    const BatchTable& SelectTable() noexcept
+    {
+#ifdef VECTOR_MATH_HAS_AVX2
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        {
+            return GetAVX2Table();
+        }
+#endif
+        return kBaselineTable;
+    }
+
+    const BatchTable& GetTable() noexcept
+    {
+        static const BatchTable& table{ SelectTable() };
+        return table;
+    }
+
+    // Every thread reduces at least this many values, below it starting threads costs more than it saves.
+    constexpr std::size_t kMinValuesPerThread{ std::size_t{ 1 } << 16 };
+
+    template <bool Product>
+    double Reduce(std::span<double> values, std::size_t max_threads) noexcept
+    {
+        const auto reduce_pairs{ Product ? GetTable().mMultiplyPairs : GetTable().mSumPairs };
+
+        auto ReduceAll = [reduce_pairs](double* first, std::size_t count)
+        {
+            while (count > 1)
+            {
+                count = reduce_pairs(first, count);
+            }
+        };
+
+        auto count{ std::size(values) };
+        if (count == 0)
+        {
+            return Product ? 1.0 : 0.0;
+        }
+
+        if (max_threads == 0)
+        {
+            max_threads = std::thread::hardware_concurrency();
+        }
+
+        const auto thread_count{ std::min(max_threads, count / kMinValuesPerThread) };
+
+        if (thread_count >= 2)
+        {
+            // Chunks of 2^k values starting at multiples of 2^k are whole subtrees of the level by level 
+            // reduction, so reducing them separately gives the same result bit for bit.
+            const auto chunk_size{ std::bit_ceil((count + thread_count - 1) / thread_count) };
+            const auto chunk_count{ (count + chunk_size - 1) / chunk_size };
+
+            auto ReduceChunk = [&ReduceAll, &values, chunk_size, count](std::size_t chunk)
+            {
+                const auto begin{ chunk * chunk_size };
+                ReduceAll(std::data(values) + begin, std::min(chunk_size, count - begin));
+            };
+
+            std::vector<std::thread> workers{};
+
+            try
+            {
+                workers.reserve(chunk_count - 1);
+                for (std::size_t chunk{ 1 }; chunk < chunk_count; ++chunk)
+                {
+                    workers.emplace_back(ReduceChunk, chunk);
+                }
+            }
+            catch (...)
+            {
+                // Chunks without a thread are reduced here, the result does not change.
+            }
+
+            for (std::size_t chunk{ std::size(workers) + 1 }; chunk < chunk_count; ++chunk)
+            {
+                ReduceChunk(chunk);
+            }
+
+            ReduceChunk(0);
+
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+
+            for (std::size_t chunk{ 1 }; chunk < chunk_count; ++chunk)
+            {
+                values[chunk] = values[chunk * chunk_size];
+            }
+
+            count = chunk_count;
+        }
+
+        ReduceAll(std::data(values), count);
+        return values[0];
+    }
+}
+}
+
+namespace Utils::VectorMath
+{
+    double Sin(double x) noexcept
+    {
+        return Detail::ApplyScalar<Detail::SinKernel>(x);
+    }
+
+    double Cos(double x) noexcept
+    {
+        return Detail::ApplyScalar<Detail::CosKernel>(x);
+    }
+
+    double Exp(double x) noexcept
+    {
+        return Detail::ApplyScalar<Detail::ExpKernel>(x);
+    }
+
+    double Log(double x) noexcept
+    {
+        return Detail::ApplyScalar<Detail::LogKernel>(x);
+    }
+
+    double Sqrt(double x) noexcept
+    {
+        return Detail::ApplyScalar<Detail::SqrtKernel>(x);
+    }
+
+    double Min(double first, double second) noexcept
+    {
+        return Detail::MinMax<Detail::ScalarOps, true>(first, second);
+    }
+
+    double Max(double first, double second) noexcept
+    {
+        return Detail::MinMax<Detail::ScalarOps, false>(first, second);
+    }
+
+    void Sin(std::span<const double> input, std::span<double> output) noexcept
+    {
+        Detail::GetTable().mSin(input.data(), output.data(), std::min(input.size(), output.size()));
+    }
+
+    void Cos(std::span<const double> input, std::span<double> output) noexcept
+    {
+        Detail::GetTable().mCos(input.data(), output.data(), std::min(input.size(), output.size()));
+    }
+
+    void Exp(std::span<const double> input, std::span<double> output) noexcept
+    {
+        Detail::GetTable().mExp(input.data(), output.data(), std::min(input.size(), output.size()));
+    }
+
+    void Log(std::span<const double> input, std::span<double> output) noexcept
+    {
+        Detail::GetTable().mLog(input.data(), output.data(), std::min(input.size(), output.size()));
+    }
+
+    void Sqrt(std::span<const double> input, std::span<double> output) noexcept
+    {
+        Detail::GetTable().mSqrt(input.data(), output.data(), std::min(input.size(), output.size()));
+    }
+
+    void Min(std::span<const double> first, std::span<const double> second, std::span<double> output) noexcept
+    {
+        Detail::GetTable().mMin(first.data(), second.data(), output.data(), std::min({ first.size(), second.size(), output.size() }));
+    }
+
+    void Max(std::span<const double> first, std::span<const double> second, std::span<double> output) noexcept
+    {
+        Detail::GetTable().mMax(first.data(), second.data(), output.data(), std::min({ first.size(), second.size(), output.size() }));
+    }
+
+    double PairwiseSum(std::span<double> values, std::size_t max_threads) noexcept
+    {
+        return Detail::Reduce<false>(values, max_threads);
+    }
+
+    double PairwiseProduct(std::span<double> values, std::size_t max_threads) noexcept
+    {
+        return Detail::Reduce<true>(values, max_threads);
+    }
+
+    const char* GetBatchImplementation() noexcept
+    {
+        return Detail::GetTable().mName;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+    Elementary functions with polynomial approximations, one implementation shared by 
+    the scalar entry points and the batch ones (SSE2 / AVX2+FMA, chosen at run time, scalar tail).
+
+    Maximum error against the correctly rounded result, measured on random arguments:
+        Exp   <= 1 ulp    (normal results, subnormal results may lose one more bit)
+        Log   <= 1 ulp
+        Sin   <= 1 ulp    |x| <= 2^19, larger arguments are delegated to the C library
+        Cos   <= 1 ulp    |x| <= 2^19, larger arguments are delegated to the C library
+        Sqrt  correctly rounded
+        Min, Max exact
+
+    The batch and scalar results may differ in the last bit, the AVX2 path fuses multiply-adds.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+namespace Utils::VectorMath
+{
+    [[nodiscard]] double Sin(double x) noexcept;
+    [[nodiscard]] double Cos(double x) noexcept;
+    [[nodiscard]] double Exp(double x) noexcept;
+    [[nodiscard]] double Log(double x) noexcept;
+    [[nodiscard]] double Sqrt(double x) noexcept;
+    [[nodiscard]] double Min(double first, double second) noexcept;
+    [[nodiscard]] double Max(double first, double second) noexcept;
+
+    // output[i] = F(input[i]) for i < size(input), output must be at least as large as input and may be the same buffer.
+    void Sin(std::span<const double> input, std::span<double> output) noexcept;
+    void Cos(std::span<const double> input, std::span<double> output) noexcept;
+    void Exp(std::span<const double> input, std::span<double> output) noexcept;
+    void Log(std::span<const double> input, std::span<double> output) noexcept;
+    void Sqrt(std::span<const double> input, std::span<double> output) noexcept;
+    void Min(std::span<const double> first, std::span<const double> second, std::span<double> output) noexcept;
+    void Max(std::span<const double> first, std::span<const double> second, std::span<double> output) noexcept;
+
+    // Pairwise reduction, level by level: ((v0 + v1) + (v2 + v3)) + ..., an odd last value joins one level later.
+    // The rounding error grows with log2 of the size instead of the size. The values are overwritten.
+    // Large arrays are split over up to max_threads threads (0: one per hardware thread), 
+    // along subtrees of the same reduction, so the result does not depend on the thread count.
+    // Empty input gives 0 for the sum and 1 for the product.
+    [[nodiscard]] double PairwiseSum(std::span<double> values, std::size_t max_threads = 0) noexcept;
+    [[nodiscard]] double PairwiseProduct(std::span<double> values, std::size_t max_threads = 0) noexcept;
+
+    // Name of the batch implementation picked for this CPU: "avx2", "sse2" or "scalar".
+    [[nodiscard]] const char* GetBatchImplementation() noexcept;
+}
\ No newline at end of file
@@ -49,6 +49,8 @@ Rectangle {
 
         onExpressionChanged: function (expression) {
             _calcKeyboard.showAllClear(expression === "") // show AC if expression is empty
+
+            mathEvaluatorController.PreviewAsync(expression) // live preview while typing, arrives via the Connections block below
         }
     }
 
@@ -67,6 +69,25 @@ Rectangle {
         textSize: 40
     }
 
+    Connections {
+        target: mathEvaluatorController
+
+        function onResultReady(result, text) {
+            _calcResultScreen.currentResult = text
+
+            _calcKeyboard.isCalculated = true
+            _calcKeyboard.showAllClear(true)
+        }
+
+        function onPreviewReady(result) {
+            _calcResultScreen.currentResult = mathEvaluatorController.FormatNumber(result)
+        }
+
+        function onErrorOccurred(message) {
+            console.log("Error: ", message)
+        }
+    }
+
     CalcKeyboard {
         id: _calcKeyboard
 
@@ -92,15 +113,7 @@ Rectangle {
             } else if (name === "sign") {
                 _calcScreen.changeSign()
             } else if (name === "equal") {
-                if (!mathEvaluatorController.Evaluate(_calcScreen.currentExpression)) {
-                    let msg = mathEvaluatorController.GetErrorMessage()
-                    console.log("Error: ", msg)
-                } else {
-                    _calcResultScreen.currentResult = mathEvaluatorController.GetResult()
-                    
-                    isCalculated = true
-                    _calcKeyboard.showAllClear(true)
-                }
+                mathEvaluatorController.EvaluateAsync(_calcScreen.currentExpression) // result arrives via the Connections block above
             } else {
                 _calcScreen.addCharacter(value)
             }